@@ -4,12 +4,14 @@
 #include "MRUtilityKit.h"
 #include "MRUtilityKitBPLibrary.h"
 #include "MRUtilityKitGeometry.h"
+#include "MRUtilityKitProceduralMesh.h"
 #include "MRUtilityKitSubsystem.h"
 #include "MRUtilityKitSerializationHelpers.h"
 #include "MRUtilityKitSeatsComponent.h"
 #include "MRUtilityKitRoom.h"
 #include "OculusXRAnchorTypes.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
 
 #define LOCTEXT_NAMESPACE "MRUKAnchor"
 
@@ -49,12 +51,13 @@ bool AMRUKAnchor::LoadFromData(UMRUKAnchorData* AnchorData)
 	const FString Semantics = FString::Join(SemanticClassifications, TEXT("-"));
 	UE_LOG(LogMRUK, Log, TEXT("SpatialAnchor label is %s"), *Semantics);
 
-	if (PlaneBounds != AnchorData->PlaneBounds)
+	if (PlaneBounds != AnchorData->PlaneBounds || PlaneBoundary2D != AnchorData->PlaneBoundary2D)
 	{
 		Changed = true;
 	}
 	PlaneBounds = AnchorData->PlaneBounds;
 	PlaneBoundary2D = AnchorData->PlaneBoundary2D;
+	BoundaryGridBuilt = false;
 
 	if (VolumeBounds != AnchorData->VolumeBounds)
 	{
@@ -87,30 +90,32 @@ bool AMRUKAnchor::IsPositionInBoundary(const FVector2D& Position)
 		return false;
 	}
 
-	int Intersections = 0;
+	return GetBoundaryGrid().IsInside(Position);
+}
 
-	for (int i = 1; i <= PlaneBoundary2D.Num(); i++)
+void AMRUKAnchor::IsPositionInBoundaryBatch(const TArray<FVector2D>& Positions, TArray<bool>& OutInBoundary)
+{
+	if (PlaneBoundary2D.IsEmpty())
 	{
-		const FVector2D P1 = PlaneBoundary2D[i - 1];
-		const FVector2D P2 = PlaneBoundary2D[i % PlaneBoundary2D.Num()];
-		if (Position.Y > FMath::Min(P1.Y, P2.Y) && Position.Y <= FMath::Max(P1.Y, P2.Y))
+		OutInBoundary.Init(false, Positions.Num());
+		return;
+	}
+
+	GetBoundaryGrid().IsInside(Positions, OutInBoundary);
+}
+
+const FMRUKPolygonGrid& AMRUKAnchor::GetBoundaryGrid()
+{
+	if (!BoundaryGridBuilt.load(std::memory_order_acquire))
+	{
+		FScopeLock Lock(&BoundaryGridLock);
+		if (!BoundaryGridBuilt.load(std::memory_order_relaxed))
 		{
-			if (Position.X <= FMath::Max(P1.X, P2.X))
-			{
-				if (P1.Y != P2.Y)
-				{
-					const auto Frac = (Position.Y - P1.Y) / (P2.Y - P1.Y);
-					const auto XIntersection = P1.X + Frac * (P2.X - P1.X);
-					if (P1.X == P2.X || Position.X <= XIntersection)
-					{
-						Intersections++;
-					}
-				}
-			}
+			BoundaryGrid.Build(PlaneBoundary2D);
+			BoundaryGridBuilt.store(true, std::memory_order_release);
 		}
 	}
-
-	return Intersections % 2 == 1;
+	return BoundaryGrid;
 }
 
 FVector AMRUKAnchor::GenerateRandomPositionOnPlane()
@@ -307,6 +312,12 @@ void AMRUKAnchor::AttachProceduralMesh(TArray<FMRUKPlaneUV> PlaneUVAdjustments,
 	ProceduralMeshComponent->SetupAttachment(RootComponent);
 	ProceduralMeshComponent->RegisterComponent();
 
+	if (GetDefault<UMRUKSettings>()->EnableAsyncProceduralMeshGeneration)
+	{
+		GenerateProceduralAnchorMeshAsync(ProceduralMeshComponent, PlaneUVAdjustments, CutHoleLabels, false, GenerateCollision, 0.0, ProceduralMaterial);
+		return;
+	}
+
 	GenerateProceduralAnchorMesh(ProceduralMeshComponent, PlaneUVAdjustments, CutHoleLabels, false, GenerateCollision);
 
 	for (int32 SectionIndex = 0; SectionIndex < ProceduralMeshComponent->GetNumSections(); ++SectionIndex)
@@ -317,107 +328,53 @@ void AMRUKAnchor::AttachProceduralMesh(TArray<FMRUKPlaneUV> PlaneUVAdjustments,
 
 void AMRUKAnchor::GenerateProceduralAnchorMesh(UProceduralMeshComponent* ProceduralMesh, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume, bool GenerateCollision, double Offset)
 {
-	int SectionIndex = 0;
-	if (VolumeBounds.IsValid)
+	// A mesh that is still being generated in the background for this component must not replace this one later on
+	const UGameInstance* GameInstance = GetGameInstance();
+	if (UMRUKSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UMRUKSubsystem>() : nullptr)
+	{
+		Subsystem->GetProceduralMeshQueue().Cancel(ProceduralMesh);
+	}
+
+	const FMRUKProceduralMeshInput Input = CreateProceduralMeshInput(PlaneUVAdjustments, CutHoleLabels, PreferVolume, Offset);
+	MRUKProceduralMesh::Apply(*ProceduralMesh, MRUKProceduralMesh::Generate(Input), GenerateCollision);
+}
+
+void AMRUKAnchor::GenerateProceduralAnchorMeshAsync(UProceduralMeshComponent* ProceduralMesh, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume, bool GenerateCollision, double Offset, UMaterialInterface* Material)
+{
+	const UGameInstance* GameInstance = GetGameInstance();
+	UMRUKSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UMRUKSubsystem>() : nullptr;
+	if (!Subsystem)
 	{
-		TArray<FVector> Vertices;
-		TArray<int32> Triangles;
-		TArray<FVector> Normals;
-		TArray<FVector2D> UVs;
-		TArray<FLinearColor> Colors;	   // Currently unused
-		TArray<FProcMeshTangent> Tangents; // Currently unused
-		constexpr int32 NumVertices = 24;
-		constexpr int32 NumTriangles = 12;
-		Vertices.Reserve(NumVertices);
-		Triangles.Reserve(3 * NumTriangles);
-		Normals.Reserve(NumVertices);
-		UVs.Reserve(NumVertices);
-
-		FBox VolumeBoundsOffset(VolumeBounds.Min - Offset, VolumeBounds.Max + Offset);
-		for (int i = 0; i < 3; i++)
+		// Without the subsystem there is nobody to commit the mesh later on
+		GenerateProceduralAnchorMesh(ProceduralMesh, PlaneUVAdjustments, CutHoleLabels, PreferVolume, GenerateCollision, Offset);
+		for (int32 SectionIndex = 0; SectionIndex < ProceduralMesh->GetNumSections(); ++SectionIndex)
 		{
-			for (int j = 0; j < 2; j++)
-			{
-				FVector Normal = FVector::ZeroVector;
-				if (j == 0)
-				{
-					Normal[i] = -1.0f;
-				}
-				else
-				{
-					Normal[i] = 1.0f;
-				}
-				auto BaseIndex = Vertices.Num();
-				FVector Vertex;
-				Vertex[i] = VolumeBoundsOffset[j][i];
-				for (int k = 0; k < 2; k++)
-				{
-					for (int l = 0; l < 2; l++)
-					{
-						Vertex[(i + 1) % 3] = VolumeBoundsOffset[k][(i + 1) % 3];
-						Vertex[(i + 2) % 3] = VolumeBoundsOffset[l][(i + 2) % 3];
-						Vertices.Push(Vertex);
-						Normals.Push(Normal);
-						// The 4 side faces of the cube should have their 0, 0 at the top left corner
-						// when viewed from the outside.
-						// The top face should have UVs that are consistent with planes to avoid Z fighting
-						// in case a plane and volume overlap (e.g. in the case of the desk).
-						FVector2D UV;
-						switch (i)
-						{
-							case 0:
-								UV = FVector2D(1 - k, 1 - l);
-								break;
-							case 1:
-								UV = FVector2D(k, l);
-								break;
-							case 2:
-								UV = FVector2D(1 - l, k);
-								break;
-							default:
-								ensure(0);
-						}
-						if (j == 0)
-						{
-							UV.X = 1 - UV.X;
-						}
-						UVs.Push(UV);
-					}
-				}
-				if (j == 1)
-				{
-					Triangles.Push(BaseIndex);
-					Triangles.Push(BaseIndex + 1);
-					Triangles.Push(BaseIndex + 2);
-					Triangles.Push(BaseIndex + 2);
-					Triangles.Push(BaseIndex + 1);
-					Triangles.Push(BaseIndex + 3);
-				}
-				else
-				{
-					Triangles.Push(BaseIndex);
-					Triangles.Push(BaseIndex + 2);
-					Triangles.Push(BaseIndex + 1);
-					Triangles.Push(BaseIndex + 1);
-					Triangles.Push(BaseIndex + 2);
-					Triangles.Push(BaseIndex + 3);
-				}
-			}
+			ProceduralMesh->SetMaterial(SectionIndex, Material);
 		}
-
-		ProceduralMesh->CreateMeshSection_LinearColor(SectionIndex++, Vertices, Triangles, Normals, UVs, Colors, Tangents, GenerateCollision);
+		return;
 	}
+
+	Subsystem->GetProceduralMeshQueue().Enqueue(ProceduralMesh, CreateProceduralMeshInput(PlaneUVAdjustments, CutHoleLabels, PreferVolume, Offset), GenerateCollision, Material);
+}
+
+FMRUKProceduralMeshInput AMRUKAnchor::CreateProceduralMeshInput(const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume, double Offset) const
+{
+	FMRUKProceduralMeshInput Input;
+	Input.VolumeBounds = VolumeBounds;
+	Input.PlaneBounds = PlaneBounds;
+	Input.PlaneUVAdjustments = PlaneUVAdjustments;
+	Input.PreferVolume = PreferVolume;
+	Input.Offset = Offset;
+
 	if (PlaneBounds.bIsValid && !(VolumeBounds.IsValid && PreferVolume))
 	{
-		TArray<TArray<FVector2f>> Polygons;
-
 		TArray<FVector2f> PlaneBoundary;
 		PlaneBoundary.Reserve(PlaneBoundary2D.Num());
 		for (const auto Point : PlaneBoundary2D)
 		{
 			PlaneBoundary.Push(FVector2f(Point));
 		}
-		Polygons.Push(PlaneBoundary);
+		Input.Polygons.Push(MoveTemp(PlaneBoundary));
 
 		if (!CutHoleLabels.IsEmpty())
 		{
@@ -441,64 +398,12 @@ void AMRUKAnchor::GenerateProceduralAnchorMesh(UProceduralMeshComponent* Procedu
 				{
 					HoleBoundary.Push(FVector2f(ChildPositionLS.Y, ChildPositionLS.Z) + FVector2f(ChildAnchor->PlaneBoundary2D[I]));
 				}
-				Polygons.Push(HoleBoundary);
+				Input.Polygons.Push(MoveTemp(HoleBoundary));
 			}
 		}
-
-		TArray<FVector2D> MeshVertices;
-		TArray<int32> MeshIndices;
-		MRUKTriangulatePolygon(Polygons, MeshVertices, MeshIndices);
-
-		TArray<FVector> Vertices;
-		TArray<FVector> Normals;
-		TArray<FVector2D> UV0s;
-		TArray<FVector2D> UV1s;
-		TArray<FVector2D> UV2s;
-		TArray<FVector2D> UV3s;
-		TArray<FLinearColor> Colors; // Currently unused
-		TArray<FProcMeshTangent> Tangents;
-		const int32 NumVertices = MeshVertices.Num();
-		Normals.Reserve(NumVertices);
-		UV0s.Reserve(NumVertices);
-		UV1s.Reserve(NumVertices);
-		UV2s.Reserve(NumVertices);
-		UV3s.Reserve(NumVertices);
-		Tangents.Reserve(NumVertices);
-
-		static const FVector Normal = -FVector::XAxisVector;
-		const FVector NormalOffset = Normal * Offset;
-		auto BoundsSize = PlaneBounds.GetSize();
-		for (const auto& PlaneBoundaryVertex : MeshVertices)
-		{
-			const FVector Vertex = FVector(0, PlaneBoundaryVertex.X, PlaneBoundaryVertex.Y) + NormalOffset;
-			Vertices.Push(Vertex);
-			Normals.Push(Normal);
-			Tangents.Push(FProcMeshTangent(-FVector::YAxisVector, false));
-			auto U = (PlaneBoundaryVertex.X - PlaneBounds.Min.X) / BoundsSize.X;
-			auto V = 1 - (PlaneBoundaryVertex.Y - PlaneBounds.Min.Y) / BoundsSize.Y;
-			if (PlaneUVAdjustments.Num() == 0)
-			{
-				UV0s.Push(FVector2D(U, V));
-			}
-			if (PlaneUVAdjustments.Num() >= 1)
-			{
-				UV0s.Push(FVector2D(U, V) * PlaneUVAdjustments[0].Scale + PlaneUVAdjustments[0].Offset);
-			}
-			if (PlaneUVAdjustments.Num() >= 2)
-			{
-				UV1s.Push(FVector2D(U, V) * PlaneUVAdjustments[1].Scale + PlaneUVAdjustments[1].Offset);
-			}
-			if (PlaneUVAdjustments.Num() >= 3)
-			{
-				UV2s.Push(FVector2D(U, V) * PlaneUVAdjustments[2].Scale + PlaneUVAdjustments[2].Offset);
-			}
-			if (PlaneUVAdjustments.Num() >= 4)
-			{
-				UV3s.Push(FVector2D(U, V) * PlaneUVAdjustments[3].Scale + PlaneUVAdjustments[3].Offset);
-			}
-		}
-		ProceduralMesh->CreateMeshSection_LinearColor(SectionIndex++, Vertices, MeshIndices, Normals, UV0s, UV1s, UV2s, UV3s, Colors, Tangents, GenerateCollision);
 	}
+
+	return Input;
 }
 
 bool AMRUKAnchor::HasLabel(const FString& Label) const
@@ -781,6 +686,49 @@ TSharedRef<FJsonObject> AMRUKAnchor::JsonSerialize()
 	return JsonObject;
 }
 
+MRUKBinary::FAnchorRecord AMRUKAnchor::BinarySerialize(TArray<uint8>& OutBlobs)
+{
+	MRUKBinary::FAnchorRecord Record;
+	Record.UUID = AnchorUUID;
+	Record.SemanticClassifications = SemanticClassifications;
+	Record.Transform = GetTransform();
+	Record.PlaneBounds = PlaneBounds;
+	Record.PlaneBoundary2D = PlaneBoundary2D;
+	Record.VolumeBounds = VolumeBounds;
+
+	if (this == Room->GlobalMeshAnchor)
+	{
+		TArray<UProceduralMeshComponent*> ProcMeshComponents;
+		GetComponents<UProceduralMeshComponent>(ProcMeshComponents);
+		for (const auto& ProcMeshComponent : ProcMeshComponents)
+		{
+			if (ProcMeshComponent && ProcMeshComponent->ComponentHasTag("GlobalMesh"))
+			{
+				ensure(ProcMeshComponent->GetNumSections() == 1);
+
+				const auto ProcMeshSection = ProcMeshComponent->GetProcMeshSection(0);
+
+				TArray<FVector> Positions;
+				Positions.Reserve(ProcMeshSection->ProcVertexBuffer.Num());
+				for (const auto& Vertex : ProcMeshSection->ProcVertexBuffer)
+				{
+					Positions.Add(Vertex.Position);
+				}
+
+				// Indices are stored as int32 since that is what UProceduralMeshComponent::CreateMeshSection() expects
+				static_assert(sizeof(int32) == sizeof(ProcMeshSection->ProcIndexBuffer[0]));
+				Record.GlobalMesh.NumPositions = Positions.Num();
+				Record.GlobalMesh.NumIndices = ProcMeshSection->ProcIndexBuffer.Num();
+				Record.GlobalMesh.PositionsOffset = MRUKBinary::AppendBlob(OutBlobs, Positions.GetData(), Positions.NumBytes());
+				Record.GlobalMesh.IndicesOffset = MRUKBinary::AppendBlob(OutBlobs, ProcMeshSection->ProcIndexBuffer.GetData(), ProcMeshSection->ProcIndexBuffer.NumBytes());
+				break;
+			}
+		}
+	}
+
+	return Record;
+}
+
 void AMRUKAnchor::EndPlay(EEndPlayReason::Type Reason)
 {
 	if (Interior)
@@ -29,6 +29,12 @@ namespace
 		ProceduralMeshComponent->RegisterComponent();
 		Actor->AddInstanceComponent(ProceduralMeshComponent);
 
+		if (GetDefault<UMRUKSettings>()->EnableAsyncProceduralMeshGeneration)
+		{
+			Anchor->GenerateProceduralAnchorMeshAsync(ProceduralMeshComponent, PlaneUVAdjustments, CutHoleLabels, false, true, 0.0, Material);
+			return Actor;
+		}
+
 		Anchor->GenerateProceduralAnchorMesh(ProceduralMeshComponent, PlaneUVAdjustments, CutHoleLabels, false, true);
 
 		for (int32 SectionIndex = 0; SectionIndex < ProceduralMeshComponent->GetNumSections(); ++SectionIndex)
@@ -94,7 +100,18 @@ void AMRUKAnchorActorSpawner::OnRoomUpdated(AMRUKRoom* Room)
 		// we only want to update the one room we created
 		return;
 	}
-	SpawnActors(Room);
+
+	// Changes of single anchors have already been applied in OnAnchorChanged(). Only respawn
+	// the whole room if one of the changes affected other anchors as well.
+	if (RoomsToRespawn.Remove(Room) > 0)
+	{
+		RoomsPatched.Remove(Room);
+		SpawnActors(Room);
+	}
+	else if (RoomsPatched.Remove(Room) > 0)
+	{
+		OnActorsSpawned.Broadcast(Room);
+	}
 }
 
 void AMRUKAnchorActorSpawner::OnRoomRemoved(AMRUKRoom* Room)
@@ -102,6 +119,71 @@ void AMRUKAnchorActorSpawner::OnRoomRemoved(AMRUKRoom* Room)
 	RemoveActors(Room);
 }
 
+void AMRUKAnchorActorSpawner::OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change)
+{
+	if (Change == EMRUKAnchorChange::Pose)
+	{
+		// Spawned actors are attached to the anchor and follow it
+		return;
+	}
+
+	AMRUKRoom* Room = Anchor->Room;
+	TArray<AActor*>* Actors = SpawnedActors.Find(Room);
+	if (!Actors || RoomsToRespawn.Contains(Room))
+	{
+		return;
+	}
+	if (!CanUpdateAnchorIncrementally(Anchor))
+	{
+		RoomsToRespawn.Add(Room);
+		return;
+	}
+
+	if (Change != EMRUKAnchorChange::Created)
+	{
+		Actors->RemoveAll([Anchor](AActor* Actor) {
+			if (IsValid(Actor) && Actor->GetAttachParentActor() == Anchor)
+			{
+				Actor->Destroy();
+				return true;
+			}
+			return false;
+		});
+	}
+	if (Change != EMRUKAnchorChange::Removed)
+	{
+		if (AActor* Actor = SpawnProceduralMeshForAnchorIfNeeded(Anchor))
+		{
+			Actors->Push(Actor);
+		}
+		SpawnLabelActorsForAnchor(Anchor, FRandomStream(LastSeed), *Actors);
+	}
+	RoomsPatched.Add(Room);
+}
+
+bool AMRUKAnchorActorSpawner::CanUpdateAnchorIncrementally(const AMRUKAnchor* Anchor) const
+{
+	// A blueprint that overrides the spawning of the room may rely on all anchors being spawned together
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AMRUKAnchorActorSpawner, SpawnAnchorActorsInRoom)))
+	{
+		return false;
+	}
+
+	// The procedural meshes of the walls share their UVs, and anchors that cut holes change the procedural mesh of their parent
+	if (Anchor->HasLabel(FMRUKLabels::Floor) || Anchor->HasLabel(FMRUKLabels::Ceiling) || Anchor->HasLabel(FMRUKLabels::WallFace) || Anchor->HasLabel(FMRUKLabels::InvisibleWallFace))
+	{
+		return false;
+	}
+	for (const FString& Label : CutHoleLabels)
+	{
+		if (Anchor->HasLabel(Label))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 void AMRUKAnchorActorSpawner::RemoveActors(AMRUKRoom* Room)
 {
 	if (!IsValid(Room))
@@ -122,6 +204,9 @@ void AMRUKAnchorActorSpawner::RemoveActors(AMRUKRoom* Room)
 		Actors->Empty();
 		SpawnedActors.Remove(Room);
 	}
+	Room->OnAnchorChanged.RemoveDynamic(this, &AMRUKAnchorActorSpawner::OnAnchorChanged);
+	RoomsToRespawn.Remove(Room);
+	RoomsPatched.Remove(Room);
 }
 
 bool AMRUKAnchorActorSpawner::ShouldAnchorFallbackToProceduralMesh(const FMRUKSpawnGroup& SpawnGroup) const
@@ -657,22 +742,27 @@ TArray<AActor*> AMRUKAnchorActorSpawner::SpawnAnchorActorsInRoom_Implementation(
 			continue;
 		}
 
-		for (const FString& Label : Anchor->SemanticClassifications)
+		SpawnLabelActorsForAnchor(Anchor, RandomStream, SpawnedActorsInRoom);
+	}
+
+	return SpawnedActorsInRoom;
+}
+
+void AMRUKAnchorActorSpawner::SpawnLabelActorsForAnchor(AMRUKAnchor* Anchor, const FRandomStream& RandomStream, TArray<AActor*>& OutActors)
+{
+	for (const FString& Label : Anchor->SemanticClassifications)
+	{
+		FMRUKSpawnGroup SpawnGroup{};
+		if (!ShouldSpawnActorForAnchor(Anchor, Label, SpawnGroup))
 		{
-			FMRUKSpawnGroup SpawnGroup{};
-			if (!ShouldSpawnActorForAnchor(Anchor, Label, SpawnGroup))
-			{
-				continue;
-			}
+			continue;
+		}
 
-			if (AActor* SpawnedActor = SpawnAnchorActorForLabel(Anchor, Label, SpawnGroup, RandomStream))
-			{
-				SpawnedActorsInRoom.Push(SpawnedActor);
-			}
+		if (AActor* SpawnedActor = SpawnAnchorActorForLabel(Anchor, Label, SpawnGroup, RandomStream))
+		{
+			OutActors.Push(SpawnedActor);
 		}
 	}
-
-	return SpawnedActorsInRoom;
 }
 
 void AMRUKAnchorActorSpawner::SpawnActors(AMRUKRoom* Room)
@@ -713,6 +803,7 @@ void AMRUKAnchorActorSpawner::SpawnActors(AMRUKRoom* Room)
 	LastSeed = RandomStream.GetCurrentSeed();
 	const TArray<AActor*>& Actors = SpawnAnchorActorsInRoom(Room, RandomStream);
 	SpawnedActors.Add(Room, Actors);
+	Room->OnAnchorChanged.AddUniqueDynamic(this, &AMRUKAnchorActorSpawner::OnAnchorChanged);
 
 	const auto Subsystem = GetGameInstance()->GetSubsystem<UMRUKSubsystem>();
 	Subsystem->OnRoomUpdated.AddUniqueDynamic(this, &AMRUKAnchorActorSpawner::OnRoomUpdated);
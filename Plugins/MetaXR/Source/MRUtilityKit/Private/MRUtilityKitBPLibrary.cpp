@@ -7,6 +7,7 @@
 #include "MRUtilityKitAnchor.h"
 #include "MRUtilityKitSubsystem.h"
 #include "MRUtilityKitSerializationHelpers.h"
+#include "MRUtilityKitBinarySerialization.h"
 #include "ProceduralMeshComponent.h"
 #include "VectorUtil.h"
 #include "Engine/World.h"
@@ -17,7 +18,7 @@
 
 #include "Engine/Texture2D.h"
 #include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
 
 namespace
 {
@@ -185,6 +186,61 @@ namespace
 
 		return Points;
 	}
+
+	bool ReadGlobalMeshJson(TJsonReader<>& Reader, EJsonNotation Notation, TArray<FVector>& OutPositions, TArray<int32>& OutIndices)
+	{
+		OutPositions.Reset();
+		OutIndices.Reset();
+		return MRUKReadJsonObject(Reader, Notation, [&](const FString& Identifier, EJsonNotation FieldNotation) {
+			if (Identifier == TEXT("Positions"))
+			{
+				return MRUKDeserialize(Reader, FieldNotation, OutPositions);
+			}
+			if (Identifier == TEXT("Indices"))
+			{
+				return MRUKReadJsonArray(Reader, FieldNotation, [&](EJsonNotation IndexNotation) {
+					if (IndexNotation != EJsonNotation::Number)
+					{
+						return false;
+					}
+					OutIndices.Add(static_cast<int32>(Reader.GetValueAsNumber()));
+					return true;
+				});
+			}
+			return MRUKSkipJsonValue(Reader, FieldNotation);
+		});
+	}
+
+	// Read a room from the JSON stream and the global mesh in it. The anchors of rooms with a different UUID are skipped.
+	bool ReadRoomGlobalMeshJson(TJsonReader<>& Reader, EJsonNotation Notation, const FOculusXRUUID& RoomUUID, TArray<FVector>& OutPositions, TArray<int32>& OutIndices, bool& OutFound)
+	{
+		FOculusXRUUID UUID;
+		bool HasUUID = false;
+		bool HasGlobalMesh = false;
+		const bool Success = MRUKReadJsonObject(Reader, Notation, [&](const FString& Identifier, EJsonNotation FieldNotation) {
+			if (Identifier == TEXT("UUID"))
+			{
+				HasUUID = true;
+				return MRUKDeserialize(Reader, FieldNotation, UUID);
+			}
+			if (Identifier != TEXT("Anchors") || (HasUUID && UUID != RoomUUID))
+			{
+				return MRUKSkipJsonValue(Reader, FieldNotation);
+			}
+			return MRUKReadJsonArray(Reader, FieldNotation, [&](EJsonNotation AnchorNotation) {
+				return MRUKReadJsonObject(Reader, AnchorNotation, [&](const FString& AnchorIdentifier, EJsonNotation AnchorFieldNotation) {
+					if (AnchorIdentifier != TEXT("GlobalMesh") || HasGlobalMesh)
+					{
+						return MRUKSkipJsonValue(Reader, AnchorFieldNotation);
+					}
+					HasGlobalMesh = true;
+					return ReadGlobalMeshJson(Reader, AnchorFieldNotation, OutPositions, OutIndices);
+				});
+			});
+		});
+		OutFound = Success && HasGlobalMesh && UUID == RoomUUID;
+		return Success;
+	}
 } // namespace
 
 UMRUKLoadFromDevice* UMRUKLoadFromDevice::LoadSceneFromDeviceAsync(const UObject* WorldContext
@@ -255,65 +311,92 @@ bool UMRUKBPLibrary::LoadGlobalMeshFromJsonString(const FString& JsonString, FOc
 {
 	ensure(OutProceduralMesh);
 
-	TSharedPtr<FJsonValue> JsonValue;
-	auto JsonReader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(JsonReader, JsonValue))
+	// Stream through the JSON and only keep the positions and indices of the global mesh of the room.
+	// Parsing stops as soon as the global mesh has been found.
+	TArray<FVector> Positions;
+	TArray<int32> Indices;
+	bool Found = false;
+	const auto JsonReader = TJsonReaderFactory<>::CreateFromView(JsonString);
+	EJsonNotation Notation;
+	const bool Success = JsonReader->ReadNext(Notation) && MRUKReadJsonObject(*JsonReader, Notation, [&](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier != TEXT("Rooms"))
+		{
+			return MRUKSkipJsonValue(*JsonReader, FieldNotation);
+		}
+		return MRUKReadJsonArray(*JsonReader, FieldNotation, [&](EJsonNotation RoomNotation) {
+			return ReadRoomGlobalMeshJson(*JsonReader, RoomNotation, AnchorUUID, Positions, Indices, Found) && !Found;
+		});
+	});
+
+	if (Found)
 	{
-		UE_LOG(LogMRUK, Warning, TEXT("Could not deserialize global mesh JSON data"));
+		TArray<FVector> EmptyNormals;
+		TArray<FVector2D> EmptyUV;
+		TArray<FColor> EmptyVertexColors;
+		TArray<FProcMeshTangent> EmptyTangents;
+		OutProceduralMesh->CreateMeshSection(0, Positions, Indices, EmptyNormals, EmptyUV, EmptyVertexColors, EmptyTangents, LoadCollision);
+
+		return true;
+	}
+
+	if (!Success && !JsonReader->GetErrorMessage().IsEmpty())
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("Could not deserialize global mesh JSON data: %s"), *JsonReader->GetErrorMessage());
 		return false;
 	}
 
-	auto JsonObject = JsonValue->AsObject();
+	UE_LOG(LogMRUK, Warning, TEXT("Could not find global mesh in room"));
+
+	return false;
+}
+
+bool UMRUKBPLibrary::LoadGlobalMeshFromBinaryFile(const FString& FilePath, FOculusXRUUID AnchorUUID, UProceduralMeshComponent* OutProceduralMesh, bool LoadCollision)
+{
+	ensure(OutProceduralMesh);
 
-	// Find room
-	auto RoomsJson = JsonObject->GetArrayField(TEXT("Rooms"));
-	for (const auto& RoomJson : RoomsJson)
+	MRUKBinary::FMappedFile File;
+	if (!File.Open(FilePath))
 	{
-		auto RoomObject = RoomJson->AsObject();
-		FOculusXRUUID RoomUUID;
-		MRUKDeserialize(*RoomObject->GetField<EJson::None>(TEXT("UUID")), RoomUUID);
-		if (RoomUUID == AnchorUUID)
-		{
-			// Find global mesh anchor
-			auto AnchorsJson = RoomObject->GetArrayField(TEXT("Anchors"));
-			for (const auto& AnchorJson : AnchorsJson)
-			{
-				auto AnchorObject = AnchorJson->AsObject();
-				if (AnchorObject->HasField(TEXT("GlobalMesh")))
-				{
-					auto GlobalMeshObject = AnchorObject->GetField<EJson::Object>(TEXT("GlobalMesh"))->AsObject();
+		return false;
+	}
 
-					auto PositionsJson = GlobalMeshObject->GetArrayField(TEXT("Positions"));
-					TArray<FVector> Positions;
-					Positions.Reserve(PositionsJson.Num());
-					for (const auto& PositionJson : PositionsJson)
-					{
-						FVector Position;
-						MRUKDeserialize(*PositionJson, Position);
-						Positions.Push(Position);
-					}
+	const TConstArrayView<uint8> Data = File.GetData();
+	if (!MRUKBinary::IsBinaryScene(Data))
+	{
+		UE_LOG(LogMRUK, Log, TEXT("%s is not a binary scene file, trying to load it as JSON"), *FilePath);
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, Data.GetData(), Data.Num());
+		return LoadGlobalMeshFromJsonString(JsonString, AnchorUUID, OutProceduralMesh, LoadCollision);
+	}
 
-					auto IndicesJson = GlobalMeshObject->GetArrayField(TEXT("Indices"));
-					TArray<int32> Indices;
-					Indices.Reserve(IndicesJson.Num());
-					for (const auto& IndexJson : IndicesJson)
-					{
-						double Index;
-						MRUKDeserialize(*IndexJson, Index);
-						Indices.Push((int32)Index);
-					}
+	MRUKBinary::FHeader Header;
+	TArray<MRUKBinary::FRoomRecord> Rooms;
+	if (!MRUKBinary::ReadScene(Data, Header, Rooms))
+	{
+		return false;
+	}
 
-					TArray<FVector> EmptyNormals;
-					TArray<FVector2D> EmptyUV;
-					TArray<FColor> EmptyVertexColors;
-					TArray<FProcMeshTangent> EmptyTangents;
-					OutProceduralMesh->CreateMeshSection(0, Positions, Indices, EmptyNormals, EmptyUV, EmptyVertexColors, EmptyTangents, LoadCollision);
+	const MRUKBinary::FRoomRecord* Room = Rooms.FindByPredicate([&AnchorUUID](const MRUKBinary::FRoomRecord& Record) { return Record.UUID == AnchorUUID; });
+	if (Room)
+	{
+		for (const auto& Anchor : Room->Anchors)
+		{
+			TConstArrayView<FVector> PositionsView;
+			TConstArrayView<int32> IndicesView;
+			if (MRUKBinary::GetGlobalMesh(Data, Header, Anchor.GlobalMesh, PositionsView, IndicesView))
+			{
+				// CreateMeshSection() only takes arrays, the data is copied as a whole without touching every element
+				const TArray<FVector> Positions(PositionsView);
+				const TArray<int32> Indices(IndicesView);
 
-					return true;
-				}
-			}
+				TArray<FVector> EmptyNormals;
+				TArray<FVector2D> EmptyUV;
+				TArray<FColor> EmptyVertexColors;
+				TArray<FProcMeshTangent> EmptyTangents;
+				OutProceduralMesh->CreateMeshSection(0, Positions, Indices, EmptyNormals, EmptyUV, EmptyVertexColors, EmptyTangents, LoadCollision);
 
-			break;
+				return true;
+			}
 		}
 	}
 
@@ -0,0 +1,284 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitBVH.h"
+
+namespace
+{
+	double SurfaceArea(const FBox& Box)
+	{
+		const FVector Size = Box.GetSize();
+		return 2.0 * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+	}
+
+	// Slab test of a ray against an axis aligned box.
+	// InvDirection is the component wise reciprocal of the ray direction.
+	bool RayIntersectsBox(const FVector& Origin, const FVector& InvDirection, const bool (&Parallel)[3], double MaxDist, const FBox& Box)
+	{
+		double DistNear = 0.0;
+		double DistFar = MaxDist;
+		for (int i = 0; i < 3; ++i)
+		{
+			if (Parallel[i])
+			{
+				// The ray is parallel to this slab, it can only hit if the origin is inside of it
+				if (Origin[i] < Box.Min[i] || Origin[i] > Box.Max[i])
+				{
+					return false;
+				}
+				continue;
+			}
+			double Dist1 = (Box.Min[i] - Origin[i]) * InvDirection[i];
+			double Dist2 = (Box.Max[i] - Origin[i]) * InvDirection[i];
+			if (Dist1 > Dist2)
+			{
+				Swap(Dist1, Dist2);
+			}
+			DistNear = FMath::Max(DistNear, Dist1);
+			DistFar = FMath::Min(DistFar, Dist2);
+			if (DistNear > DistFar)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+} // namespace
+
+void FMRUKAnchorBVH::Reset()
+{
+	Nodes.Empty();
+	FreeNodes.Empty();
+	Root = INDEX_NONE;
+	AnchorToNode.Empty();
+	UnboundedAnchors.Empty();
+}
+
+void FMRUKAnchorBVH::InsertOrUpdate(AMRUKAnchor* Anchor, const FBox& Bounds, int32 SortKey)
+{
+	check(Anchor);
+
+	if (!Bounds.IsValid)
+	{
+		Remove(Anchor);
+		UnboundedAnchors.Add(Anchor, SortKey);
+		return;
+	}
+	UnboundedAnchors.Remove(Anchor);
+
+	if (const int32* Found = AnchorToNode.Find(Anchor))
+	{
+		FNode& Leaf = Nodes[*Found];
+		Leaf.SortKey = SortKey;
+		if (Leaf.Bounds.Min.Equals(Bounds.Min) && Leaf.Bounds.Max.Equals(Bounds.Max))
+		{
+			// Nothing moved, no need to touch the tree
+			return;
+		}
+		const int32 LeafIndex = *Found;
+		RemoveLeaf(LeafIndex);
+		Nodes[LeafIndex].Bounds = Bounds;
+		InsertLeaf(LeafIndex);
+		return;
+	}
+
+	const int32 LeafIndex = AllocateNode();
+	FNode& Leaf = Nodes[LeafIndex];
+	Leaf.Bounds = Bounds;
+	Leaf.Anchor = Anchor;
+	Leaf.SortKey = SortKey;
+	AnchorToNode.Add(Anchor, LeafIndex);
+	InsertLeaf(LeafIndex);
+}
+
+void FMRUKAnchorBVH::Remove(AMRUKAnchor* Anchor)
+{
+	if (UnboundedAnchors.Remove(Anchor) > 0)
+	{
+		return;
+	}
+
+	int32 LeafIndex = INDEX_NONE;
+	if (AnchorToNode.RemoveAndCopyValue(Anchor, LeafIndex))
+	{
+		RemoveLeaf(LeafIndex);
+		FreeNode(LeafIndex);
+	}
+}
+
+void FMRUKAnchorBVH::QueryRay(const FVector& Origin, const FVector& Direction, float MaxDist, FCandidateArray& OutCandidates) const
+{
+	OutCandidates.Reset();
+
+	TArray<TPair<int32, AMRUKAnchor*>, TInlineAllocator<32>> Hits;
+	for (const auto& [Anchor, SortKey] : UnboundedAnchors)
+	{
+		Hits.Emplace(SortKey, Anchor);
+	}
+
+	if (Root != INDEX_NONE)
+	{
+		// MaxDist is a distance, so the ray parameter only matches it for a unit direction. Without a
+		// direction nothing can be culled, the anchors decide on their own what such a ray hits.
+		const FVector UnitDirection = Direction.GetSafeNormal();
+		const bool bCull = !UnitDirection.IsZero();
+		FVector InvDirection;
+		bool Parallel[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			Parallel[i] = FMath::Abs(UnitDirection[i]) < UE_KINDA_SMALL_NUMBER;
+			InvDirection[i] = Parallel[i] ? 0.0 : 1.0 / UnitDirection[i];
+		}
+		const double MaxRayDist = MaxDist <= 0.0f ? UE_BIG_NUMBER : MaxDist;
+
+		TArray<int32, TInlineAllocator<64>> Stack;
+		Stack.Push(Root);
+		while (!Stack.IsEmpty())
+		{
+			const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+			if (bCull && !RayIntersectsBox(Origin, InvDirection, Parallel, MaxRayDist, Node.Bounds))
+			{
+				continue;
+			}
+			if (Node.IsLeaf())
+			{
+				Hits.Emplace(Node.SortKey, Node.Anchor);
+			}
+			else
+			{
+				Stack.Push(Node.Children[0]);
+				Stack.Push(Node.Children[1]);
+			}
+		}
+	}
+
+	// Return candidates in a stable order so that results match a linear scan over the anchors
+	Hits.Sort([](const TPair<int32, AMRUKAnchor*>& A, const TPair<int32, AMRUKAnchor*>& B) { return A.Key < B.Key; });
+	OutCandidates.Reserve(Hits.Num());
+	for (const auto& Hit : Hits)
+	{
+		OutCandidates.Push(Hit.Value);
+	}
+}
+
+FBox FMRUKAnchorBVH::GetBounds() const
+{
+	return Root != INDEX_NONE ? Nodes[Root].Bounds : FBox(ForceInit);
+}
+
+int32 FMRUKAnchorBVH::AllocateNode()
+{
+	if (!FreeNodes.IsEmpty())
+	{
+		const int32 Index = FreeNodes.Pop(EAllowShrinking::No);
+		Nodes[Index] = FNode{};
+		return Index;
+	}
+	return Nodes.AddDefaulted();
+}
+
+void FMRUKAnchorBVH::FreeNode(int32 Index)
+{
+	Nodes[Index] = FNode{};
+	FreeNodes.Push(Index);
+}
+
+void FMRUKAnchorBVH::InsertLeaf(int32 Leaf)
+{
+	if (Root == INDEX_NONE)
+	{
+		Root = Leaf;
+		Nodes[Root].Parent = INDEX_NONE;
+		return;
+	}
+
+	// Find the best sibling for the new leaf by descending the tree and picking the
+	// child that causes the smallest increase in surface area.
+	const FBox LeafBounds = Nodes[Leaf].Bounds;
+	int32 Index = Root;
+	while (!Nodes[Index].IsLeaf())
+	{
+		const FNode& Node = Nodes[Index];
+		const double Area = SurfaceArea(Node.Bounds);
+		const double CombinedArea = SurfaceArea(Node.Bounds + LeafBounds);
+
+		// Cost of creating a new parent for this node and the new leaf
+		const double Cost = 2.0 * CombinedArea;
+		// Minimum cost of pushing the leaf further down the tree
+		const double InheritanceCost = 2.0 * (CombinedArea - Area);
+
+		double ChildCosts[2];
+		for (int i = 0; i < 2; ++i)
+		{
+			const FNode& Child = Nodes[Node.Children[i]];
+			const double ChildCombinedArea = SurfaceArea(Child.Bounds + LeafBounds);
+			ChildCosts[i] = (Child.IsLeaf() ? ChildCombinedArea : ChildCombinedArea - SurfaceArea(Child.Bounds)) + InheritanceCost;
+		}
+
+		if (Cost < ChildCosts[0] && Cost < ChildCosts[1])
+		{
+			break;
+		}
+		Index = ChildCosts[0] < ChildCosts[1] ? Node.Children[0] : Node.Children[1];
+	}
+
+	const int32 Sibling = Index;
+	const int32 OldParent = Nodes[Sibling].Parent;
+	const int32 NewParent = AllocateNode();
+	Nodes[NewParent].Parent = OldParent;
+	Nodes[NewParent].Bounds = LeafBounds + Nodes[Sibling].Bounds;
+	Nodes[NewParent].Children[0] = Sibling;
+	Nodes[NewParent].Children[1] = Leaf;
+	Nodes[Sibling].Parent = NewParent;
+	Nodes[Leaf].Parent = NewParent;
+
+	if (OldParent == INDEX_NONE)
+	{
+		Root = NewParent;
+	}
+	else
+	{
+		FNode& Parent = Nodes[OldParent];
+		Parent.Children[Parent.Children[0] == Sibling ? 0 : 1] = NewParent;
+		Refit(OldParent);
+	}
+}
+
+void FMRUKAnchorBVH::RemoveLeaf(int32 Leaf)
+{
+	if (Leaf == Root)
+	{
+		Root = INDEX_NONE;
+		return;
+	}
+
+	const int32 Parent = Nodes[Leaf].Parent;
+	const int32 GrandParent = Nodes[Parent].Parent;
+	const int32 Sibling = Nodes[Parent].Children[0] == Leaf ? Nodes[Parent].Children[1] : Nodes[Parent].Children[0];
+
+	if (GrandParent == INDEX_NONE)
+	{
+		Root = Sibling;
+		Nodes[Sibling].Parent = INDEX_NONE;
+		FreeNode(Parent);
+	}
+	else
+	{
+		// Replace the parent with the sibling and shrink the bounds of the ancestors
+		FNode& GrandParentNode = Nodes[GrandParent];
+		GrandParentNode.Children[GrandParentNode.Children[0] == Parent ? 0 : 1] = Sibling;
+		Nodes[Sibling].Parent = GrandParent;
+		FreeNode(Parent);
+		Refit(GrandParent);
+	}
+	Nodes[Leaf].Parent = INDEX_NONE;
+}
+
+void FMRUKAnchorBVH::Refit(int32 Index)
+{
+	while (Index != INDEX_NONE)
+	{
+		FNode& Node = Nodes[Index];
+		Node.Bounds = Nodes[Node.Children[0]].Bounds + Nodes[Node.Children[1]].Bounds;
+		Index = Node.Parent;
+	}
+}
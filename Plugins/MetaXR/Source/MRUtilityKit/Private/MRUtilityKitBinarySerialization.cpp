@@ -0,0 +1,248 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitBinarySerialization.h"
+#include "MRUtilityKit.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// Vectors and transforms are always written as doubles so the format doesn't depend on the engine version
+
+	void SerializeVector(FArchive& Ar, FVector& Vector)
+	{
+		Ar << Vector.X << Vector.Y << Vector.Z;
+	}
+
+	void SerializeVector2D(FArchive& Ar, FVector2D& Vector)
+	{
+		Ar << Vector.X << Vector.Y;
+	}
+
+	void SerializeTransform(FArchive& Ar, FTransform& Transform)
+	{
+		FVector Translation = Transform.GetTranslation();
+		FQuat Rotation = Transform.GetRotation();
+		FVector Scale = Transform.GetScale3D();
+		SerializeVector(Ar, Translation);
+		Ar << Rotation.X << Rotation.Y << Rotation.Z << Rotation.W;
+		SerializeVector(Ar, Scale);
+		if (Ar.IsLoading())
+		{
+			Transform = FTransform(Rotation, Translation, Scale);
+		}
+	}
+
+	void SerializeBox2D(FArchive& Ar, FBox2D& Box)
+	{
+		uint8 IsValid = Box.bIsValid ? 1 : 0;
+		Ar << IsValid;
+		if (IsValid)
+		{
+			SerializeVector2D(Ar, Box.Min);
+			SerializeVector2D(Ar, Box.Max);
+		}
+		Box.bIsValid = IsValid != 0;
+	}
+
+	void SerializeBox(FArchive& Ar, FBox& Box)
+	{
+		uint8 IsValid = Box.IsValid ? 1 : 0;
+		Ar << IsValid;
+		if (IsValid)
+		{
+			SerializeVector(Ar, Box.Min);
+			SerializeVector(Ar, Box.Max);
+		}
+		Box.IsValid = IsValid;
+	}
+
+	template <typename T>
+	bool IsBlobInRange(TConstArrayView<uint8> Data, int64 Offset, int64 Num)
+	{
+		return Offset >= 0 && Num >= 0 && Offset % alignof(T) == 0 && Offset + Num * static_cast<int64>(sizeof(T)) <= Data.Num();
+	}
+} // namespace
+
+namespace MRUKBinary
+{
+	FArchive& operator<<(FArchive& Ar, FHeader& Header)
+	{
+		Ar << Header.Magic << Header.Version << Header.BlobsOffset << Header.NumRooms;
+		return Ar;
+	}
+
+	FArchive& operator<<(FArchive& Ar, FGlobalMeshBlob& Blob)
+	{
+		Ar << Blob.NumPositions << Blob.NumIndices << Blob.PositionsOffset << Blob.IndicesOffset;
+		return Ar;
+	}
+
+	FArchive& operator<<(FArchive& Ar, FAnchorRecord& Record)
+	{
+		Ar << Record.UUID;
+		Ar << Record.SemanticClassifications;
+		SerializeTransform(Ar, Record.Transform);
+		SerializeBox2D(Ar, Record.PlaneBounds);
+
+		int32 NumBoundaryPoints = Record.PlaneBoundary2D.Num();
+		Ar << NumBoundaryPoints;
+		if (Ar.IsLoading())
+		{
+			if (NumBoundaryPoints < 0 || NumBoundaryPoints * static_cast<int64>(sizeof(FVector2D)) > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return Ar;
+			}
+			Record.PlaneBoundary2D.SetNumUninitialized(NumBoundaryPoints);
+		}
+		for (FVector2D& Point : Record.PlaneBoundary2D)
+		{
+			SerializeVector2D(Ar, Point);
+		}
+
+		SerializeBox(Ar, Record.VolumeBounds);
+		Ar << Record.GlobalMesh;
+		return Ar;
+	}
+
+	FArchive& operator<<(FArchive& Ar, FRoomRecord& Record)
+	{
+		Ar << Record.UUID;
+		Ar << Record.RoomLayout.FloorUuid;
+		Ar << Record.RoomLayout.CeilingUuid;
+		Ar << Record.RoomLayout.WallsUuid;
+		Ar << Record.Anchors;
+		return Ar;
+	}
+
+	int64 AppendBlob(TArray<uint8>& Blobs, const void* Data, int64 Size)
+	{
+		const int32 Offset = Align(Blobs.Num(), BlobAlignment);
+		Blobs.SetNumZeroed(Offset);
+		Blobs.Append(static_cast<const uint8*>(Data), static_cast<int32>(Size));
+		return Offset;
+	}
+
+	TArray<uint8> WriteScene(TArray<FRoomRecord>& Rooms, const TArray<uint8>& Blobs)
+	{
+		TArray<uint8> Data;
+		FMemoryWriter Writer(Data);
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.NumRooms = Rooms.Num();
+		Writer << Header;
+		for (FRoomRecord& Room : Rooms)
+		{
+			Writer << Room;
+		}
+
+		// Patch the header now that the location of the blobs is known
+		Header.BlobsOffset = Align(Data.Num(), BlobAlignment);
+		Writer.Seek(0);
+		Writer << Header;
+
+		Data.SetNumZeroed(static_cast<int32>(Header.BlobsOffset));
+		Data.Append(Blobs);
+		return Data;
+	}
+
+	bool IsBinaryScene(TConstArrayView<uint8> Data)
+	{
+		uint32 DataMagic = 0;
+		if (Data.Num() < static_cast<int32>(sizeof(DataMagic)))
+		{
+			return false;
+		}
+		FMemory::Memcpy(&DataMagic, Data.GetData(), sizeof(DataMagic));
+		return DataMagic == Magic;
+	}
+
+	bool ReadScene(TConstArrayView<uint8> Data, FHeader& OutHeader, TArray<FRoomRecord>& OutRooms)
+	{
+		if (!IsBinaryScene(Data))
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Data is not a binary MRUK scene"));
+			return false;
+		}
+
+		FMemoryReaderView Reader(Data);
+		Reader << OutHeader;
+		if (OutHeader.Version != Version)
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Unsupported binary scene version %u, expected %u"), OutHeader.Version, Version);
+			return false;
+		}
+		if (Reader.IsError() || OutHeader.NumRooms < 0 || OutHeader.BlobsOffset < Reader.Tell() || OutHeader.BlobsOffset > Data.Num())
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Binary scene header is corrupt"));
+			return false;
+		}
+
+		OutRooms.SetNum(OutHeader.NumRooms);
+		for (FRoomRecord& Room : OutRooms)
+		{
+			Reader << Room;
+			if (Reader.IsError())
+			{
+				UE_LOG(LogMRUK, Warning, TEXT("Binary scene data is corrupt"));
+				OutRooms.Empty();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool GetGlobalMesh(TConstArrayView<uint8> Data, const FHeader& Header, const FGlobalMeshBlob& Blob, TConstArrayView<FVector>& OutPositions, TConstArrayView<int32>& OutIndices)
+	{
+		if (!Blob.IsValid())
+		{
+			return false;
+		}
+
+		const int64 PositionsOffset = Header.BlobsOffset + Blob.PositionsOffset;
+		const int64 IndicesOffset = Header.BlobsOffset + Blob.IndicesOffset;
+		if (!IsBlobInRange<FVector>(Data, PositionsOffset, Blob.NumPositions) || !IsBlobInRange<int32>(Data, IndicesOffset, Blob.NumIndices))
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Global mesh blob is outside of the binary scene data"));
+			return false;
+		}
+
+		OutPositions = MakeArrayView(reinterpret_cast<const FVector*>(Data.GetData() + PositionsOffset), Blob.NumPositions);
+		OutIndices = MakeArrayView(reinterpret_cast<const int32*>(Data.GetData() + IndicesOffset), Blob.NumIndices);
+		return true;
+	}
+
+	bool FMappedFile::Open(const FString& FilePath)
+	{
+		MappedRegion.Reset();
+		MappedHandle.Reset();
+		FallbackData.Empty();
+		Data = {};
+
+		MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+		if (MappedHandle && MappedHandle->GetFileSize() > 0 && MappedHandle->GetFileSize() <= MAX_int32)
+		{
+			MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+			if (MappedRegion)
+			{
+				Data = MakeArrayView(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+				return true;
+			}
+		}
+		MappedHandle.Reset();
+
+		// Memory mapping is not supported everywhere, read the file into memory instead
+		if (!FFileHelper::LoadFileToArray(FallbackData, *FilePath))
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Could not read file %s"), *FilePath);
+			return false;
+		}
+		Data = FallbackData;
+		return true;
+	}
+} // namespace MRUKBinary
@@ -8,6 +8,9 @@
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Blob Shadow Ground Traces"), STAT_MRUKBlobShadowGroundTraces, STATGROUP_MRUK);
 
 UMRUKBlobShadowComponent::UMRUKBlobShadowComponent()
 {
@@ -62,19 +65,129 @@ void UMRUKBlobShadowComponent::BeginPlay()
 	SetUsingAbsoluteRotation(true);
 	SetUsingAbsoluteScale(true);
 
+	GroundTraceDelegate.BindUObject(this, &UMRUKBlobShadowComponent::OnGroundTraceCompleted);
+
 	// Compute size and position once
+	ConsumeDirty();
 	UpdatePlaneSizeAndPosition();
+
+	if (UpdateMode == EMRUKBlobShadowUpdateMode::Batched)
+	{
+		SetComponentTickEnabled(false);
+		GetWorld()->GetSubsystem<UMRUKBlobShadowSubsystem>()->Register(this);
+	}
+}
+
+void UMRUKBlobShadowComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UpdateMode == EMRUKBlobShadowUpdateMode::Batched)
+	{
+		if (UMRUKBlobShadowSubsystem* Subsystem = GetWorld()->GetSubsystem<UMRUKBlobShadowSubsystem>())
+		{
+			Subsystem->Unregister(this);
+		}
+	}
+	GroundTraceDelegate.Unbind();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMRUKBlobShadowComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Update component size and position every frame
-	UpdatePlaneSizeAndPosition();
+	// Update component size and position every frame, or only if something changed
+	if (UpdateMode == EMRUKBlobShadowUpdateMode::EveryFrame || ConsumeDirty())
+	{
+		UpdatePlaneSizeAndPosition();
+	}
+}
+
+void UMRUKBlobShadowComponent::SetUpdateMode(EMRUKBlobShadowUpdateMode NewUpdateMode)
+{
+	if (UpdateMode == NewUpdateMode)
+	{
+		return;
+	}
+	UpdateMode = NewUpdateMode;
+	Dirty = true;
+
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+	UMRUKBlobShadowSubsystem* Subsystem = GetWorld()->GetSubsystem<UMRUKBlobShadowSubsystem>();
+	if (UpdateMode == EMRUKBlobShadowUpdateMode::Batched)
+	{
+		SetComponentTickEnabled(false);
+		Subsystem->Register(this);
+	}
+	else
+	{
+		Subsystem->Unregister(this);
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UMRUKBlobShadowComponent::MarkDirty()
+{
+	Dirty = true;
+}
+
+bool UMRUKBlobShadowComponent::ConsumeDirty()
+{
+	const AActor* Actor = GetOwner();
+
+	FUpdateState State;
+	State.OwnerTransform = Actor->GetActorTransform();
+	// Use the bounds that the components keep up to date anyway instead of computing them again like in ComputeOwner2DBounds()
+	Actor->ForEachComponent<UPrimitiveComponent>(true, [&](const UPrimitiveComponent* InPrimComp) {
+		if (InPrimComp->IsRegistered() && !InPrimComp->IsEditorOnly() && !InPrimComp->bUseAttachParentBound && !InPrimComp->IsA<UMRUKBlobShadowComponent>())
+		{
+			State.OwnerBounds += InPrimComp->Bounds.GetBox();
+		}
+	});
+	State.Roundness = Roundness;
+	State.Gradient = Gradient;
+	State.GradientPower = GradientPower;
+	State.ExtraExtent = ExtraExtent;
+	State.MaxVerticalDistance = MaxVerticalDistance;
+	State.FadeDistance = FadeDistance;
+
+	const bool Changed = Dirty
+		|| !State.OwnerTransform.Equals(LastUpdateState.OwnerTransform)
+		|| !State.OwnerBounds.Equals(LastUpdateState.OwnerBounds)
+		|| State.Roundness != LastUpdateState.Roundness
+		|| State.Gradient != LastUpdateState.Gradient
+		|| State.GradientPower != LastUpdateState.GradientPower
+		|| State.ExtraExtent != LastUpdateState.ExtraExtent
+		|| State.MaxVerticalDistance != LastUpdateState.MaxVerticalDistance
+		|| State.FadeDistance != LastUpdateState.FadeDistance;
+
+	LastUpdateState = State;
+	Dirty = false;
+	return Changed;
 }
 
 void UMRUKBlobShadowComponent::UpdatePlaneSizeAndPosition()
+{
+	FVector TraceStart;
+	FVector TraceEnd;
+	float TraceRadius;
+	UpdatePlaneSize(TraceStart, TraceEnd, TraceRadius);
+
+	// Sphere trace to the ground
+	FHitResult Hit;
+	TArray<AActor*> ActorsToIgnore;
+	ActorsToIgnore.Add(GetOwner());
+	const bool bHasHit = UKismetSystemLibrary::SphereTraceSingle(this, TraceStart, TraceEnd, TraceRadius, TraceTypeQuery1,
+		true, ActorsToIgnore, EDrawDebugTrace::None, Hit, true);
+	INC_DWORD_STAT(STAT_MRUKBlobShadowGroundTraces);
+
+	UpdatePlanePosition(bHasHit, Hit);
+}
+
+void UMRUKBlobShadowComponent::UpdatePlaneSize(FVector& OutTraceStart, FVector& OutTraceEnd, float& OutTraceRadius)
 {
 	FVector Origin;
 	FVector2D Extent;
@@ -84,13 +197,16 @@ void UMRUKBlobShadowComponent::UpdatePlaneSizeAndPosition()
 	Extent += FVector2D::UnitVector * ExtraExtent; // Additional extent
 	SetWorldScale3D(FVector(Extent * 0.02f, 1.f)); // Plane mesh is 100x100, multiplying by 0.02f to match the correct size when scaling
 	SetWorldRotation(FRotator(0.f, Yaw, 0.f));
+	PlaneExtent = Extent;
 
-	// Sphere trace to the ground
-	FHitResult Hit;
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(GetOwner());
-	const bool bHasHit = UKismetSystemLibrary::SphereTraceSingle(this, Origin, Origin + FVector::DownVector * MaxVerticalDistance, Extent.Length() * 0.5f, TraceTypeQuery1,
-		true, ActorsToIgnore, EDrawDebugTrace::None, Hit, true);
+	OutTraceStart = Origin;
+	OutTraceEnd = Origin + FVector::DownVector * MaxVerticalDistance;
+	OutTraceRadius = Extent.Length() * 0.5f;
+}
+
+void UMRUKBlobShadowComponent::UpdatePlanePosition(bool bHasHit, const FHitResult& Hit)
+{
+	const FVector2D& Extent = PlaneExtent;
 	float Opacity = 0.f;
 	if (bHasHit)
 	{
@@ -121,6 +237,19 @@ void UMRUKBlobShadowComponent::UpdatePlaneSizeAndPosition()
 	}
 }
 
+void UMRUKBlobShadowComponent::OnGroundTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Handle != PendingGroundTrace)
+	{
+		// A newer trace has been issued in the meantime
+		return;
+	}
+	PendingGroundTrace = FTraceHandle();
+
+	const FHitResult* Hit = FHitResult::GetFirstBlockingHit(Datum.OutHits);
+	UpdatePlanePosition(Hit != nullptr, Hit ? *Hit : FHitResult());
+}
+
 void UMRUKBlobShadowComponent::ComputeOwner2DBounds(FVector& Origin, FVector2D& Extent, double& Yaw) const
 {
 	const AActor* Actor = GetOwner();
@@ -148,3 +277,45 @@ void UMRUKBlobShadowComponent::ComputeOwner2DBounds(FVector& Origin, FVector2D&
 	Extent = FVector2D(ProjectedExtent);
 	Yaw = Transform.GetRotation().Rotator().Yaw;
 }
+
+void UMRUKBlobShadowSubsystem::Register(UMRUKBlobShadowComponent* BlobShadow)
+{
+	BlobShadows.AddUnique(BlobShadow);
+}
+
+void UMRUKBlobShadowSubsystem::Unregister(UMRUKBlobShadowComponent* BlobShadow)
+{
+	BlobShadows.Remove(BlobShadow);
+	BlobShadow->PendingGroundTrace = FTraceHandle();
+}
+
+void UMRUKBlobShadowSubsystem::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	const ECollisionChannel TraceChannel = UEngineTypes::ConvertToCollisionChannel(TraceTypeQuery1);
+
+	// The sizes are updated right away, only the traces to the ground are deferred
+	int32 NumTraces = 0;
+	BlobShadows.RemoveAll([](const TWeakObjectPtr<UMRUKBlobShadowComponent>& BlobShadow) { return !BlobShadow.IsValid(); });
+	for (const TWeakObjectPtr<UMRUKBlobShadowComponent>& WeakBlobShadow : BlobShadows)
+	{
+		UMRUKBlobShadowComponent* BlobShadow = WeakBlobShadow.Get();
+		if (!BlobShadow->ConsumeDirty())
+		{
+			continue;
+		}
+
+		FVector TraceStart;
+		FVector TraceEnd;
+		float TraceRadius;
+		BlobShadow->UpdatePlaneSize(TraceStart, TraceEnd, TraceRadius);
+
+		// Same parameters as UKismetSystemLibrary::SphereTraceSingle in UMRUKBlobShadowComponent::UpdatePlaneSizeAndPosition()
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(MRUKBlobShadowGroundTrace), true, BlobShadow->GetOwner());
+		Params.bReturnPhysicalMaterial = true;
+		BlobShadow->PendingGroundTrace = World->AsyncSweepByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, FQuat::Identity, TraceChannel,
+			FCollisionShape::MakeSphere(TraceRadius), Params, FCollisionResponseParams::DefaultResponseParam, &BlobShadow->GroundTraceDelegate);
+		++NumTraces;
+	}
+	INC_DWORD_STAT_BY(STAT_MRUKBlobShadowGroundTraces, NumTraces);
+}
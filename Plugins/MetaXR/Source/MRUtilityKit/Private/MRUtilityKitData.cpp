@@ -10,7 +10,6 @@
 #include "Engine/GameInstance.h"
 #include "GameFramework/WorldSettings.h"
 #include "Serialization/JsonReader.h"
-#include "Serialization/JsonSerializer.h"
 
 AMRUKLocalizer::AMRUKLocalizer()
 {
@@ -98,24 +97,47 @@ void UMRUKAnchorData::LoadFromDevice(const FOculusXRAnchorsDiscoverResult& Ancho
 	}
 }
 
-void UMRUKAnchorData::LoadFromJson(const FJsonValue& Value)
+bool UMRUKAnchorData::LoadFromJson(TJsonReader<>& Reader, EJsonNotation Notation)
 {
-	const auto Object = Value.AsObject();
-	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("UUID")), SpaceQuery.UUID);
-	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("SemanticClassifications")), SemanticClassifications);
-	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("Transform")), Transform);
-	if (const auto JsonValue = Object->TryGetField(TEXT("PlaneBounds")))
-	{
-		MRUKDeserialize(*JsonValue, PlaneBounds);
-	}
-	if (const auto JsonValue = Object->TryGetField(TEXT("PlaneBoundary2D")))
-	{
-		MRUKDeserialize(*JsonValue, PlaneBoundary2D);
-	}
-	if (const auto JsonValue = Object->TryGetField(TEXT("VolumeBounds")))
-	{
-		MRUKDeserialize(*JsonValue, VolumeBounds);
-	}
+	NeedAnchorLocalization = false;
+	return MRUKReadJsonObject(Reader, Notation, [this, &Reader](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("UUID"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, SpaceQuery.UUID);
+		}
+		if (Identifier == TEXT("SemanticClassifications"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, SemanticClassifications);
+		}
+		if (Identifier == TEXT("Transform"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Transform);
+		}
+		if (Identifier == TEXT("PlaneBounds"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, PlaneBounds);
+		}
+		if (Identifier == TEXT("PlaneBoundary2D"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, PlaneBoundary2D);
+		}
+		if (Identifier == TEXT("VolumeBounds"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, VolumeBounds);
+		}
+		// The global mesh is loaded separately with AMRUKRoom::LoadGlobalMeshFromJsonString()
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+}
+
+void UMRUKAnchorData::LoadFromBinary(const MRUKBinary::FAnchorRecord& Record)
+{
+	SpaceQuery.UUID = Record.UUID;
+	SemanticClassifications = Record.SemanticClassifications;
+	Transform = Record.Transform;
+	PlaneBounds = Record.PlaneBounds;
+	PlaneBoundary2D = Record.PlaneBoundary2D;
+	VolumeBounds = Record.VolumeBounds;
 	NeedAnchorLocalization = false;
 }
 
@@ -147,18 +169,48 @@ void UMRUKRoomData::LoadFromDevice(const FOculusXRAnchorsDiscoverResult& Anchors
 	}
 }
 
-void UMRUKRoomData::LoadFromJson(const FJsonValue& Value)
+bool UMRUKRoomData::LoadFromJson(TJsonReader<>& Reader, EJsonNotation Notation)
 {
-	const auto Object = Value.AsObject();
-	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("UUID")), SpaceQuery.UUID);
-	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("RoomLayout")), RoomLayout);
-	auto AnchorsJson = Object->GetArrayField(TEXT("Anchors"));
-	for (const auto& AnchorJson : AnchorsJson)
+	const bool Success = MRUKReadJsonObject(Reader, Notation, [this, &Reader](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("UUID"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, SpaceQuery.UUID);
+		}
+		if (Identifier == TEXT("RoomLayout"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, RoomLayout);
+		}
+		if (Identifier == TEXT("Anchors"))
+		{
+			return MRUKReadJsonArray(Reader, FieldNotation, [this, &Reader](EJsonNotation AnchorNotation) {
+				auto AnchorQuery = NewObject<UMRUKAnchorData>(this);
+				AnchorsData.Push(AnchorQuery);
+				if (!AnchorQuery->LoadFromJson(Reader, AnchorNotation))
+				{
+					return false;
+				}
+				RoomLayout.RoomObjectUUIDs.Add(AnchorQuery->SpaceQuery.UUID);
+				return true;
+			});
+		}
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+	FinishQuery(Success);
+	return Success;
+}
+
+void UMRUKRoomData::LoadFromBinary(const MRUKBinary::FRoomRecord& Record)
+{
+	SpaceQuery.UUID = Record.UUID;
+	RoomLayout = Record.RoomLayout;
+	AnchorsData.Reserve(Record.Anchors.Num());
+	RoomLayout.RoomObjectUUIDs.Reserve(Record.Anchors.Num());
+	for (const auto& AnchorRecord : Record.Anchors)
 	{
 		auto AnchorQuery = NewObject<UMRUKAnchorData>(this);
 		AnchorsData.Push(AnchorQuery);
+		AnchorQuery->LoadFromBinary(AnchorRecord);
 		RoomLayout.RoomObjectUUIDs.Add(AnchorQuery->SpaceQuery.UUID);
-		AnchorQuery->LoadFromJson(*AnchorJson);
 	}
 	FinishQuery(true);
 }
@@ -249,42 +301,81 @@ void UMRUKSceneData::LoadFromDevice()
 
 void UMRUKSceneData::LoadFromJson(const FString& Json)
 {
-	TSharedPtr<FJsonValue> Value;
-	const TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(Json);
-	if (!FJsonSerializer::Deserialize(JsonReader, Value))
+	// The JSON is streamed and every room is created as soon as it has been read. Count the parsing
+	// itself as one more room so that the scene is not completed before the end of the JSON is reached.
+	NumRoomsLeftToInitialize = 1;
+	int32 NumRooms = 0;
+
+	const auto JsonReader = TJsonReaderFactory<>::CreateFromView(Json);
+	EJsonNotation Notation;
+	const bool Success = JsonReader->ReadNext(Notation) && MRUKReadJsonObject(*JsonReader, Notation, [this, &JsonReader, &NumRooms](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier != TEXT("Rooms"))
+		{
+			return MRUKSkipJsonValue(*JsonReader, FieldNotation);
+		}
+		return MRUKReadJsonArray(*JsonReader, FieldNotation, [this, &JsonReader, &NumRooms](EJsonNotation RoomNotation) {
+			auto RoomQuery = NewObject<UMRUKRoomData>(this);
+			RoomsData.Push(RoomQuery);
+			RoomQuery->OnComplete.AddDynamic(this, &UMRUKSceneData::RoomQueryComplete);
+			++NumRooms;
+			++NumRoomsLeftToInitialize;
+			return RoomQuery->LoadFromJson(*JsonReader, RoomNotation);
+		});
+	});
+
+	if (!Success)
 	{
-		UE_LOG(LogMRUK, Warning, TEXT("Could not deserialize JSON scene data: %s"), *JsonReader->GetErrorMessage());
-		FinishQuery(false);
+		const FString& ErrorMessage = JsonReader->GetErrorMessage();
+		UE_LOG(LogMRUK, Warning, TEXT("Could not deserialize JSON scene data: %s"), ErrorMessage.IsEmpty() ? TEXT("Unexpected layout") : *ErrorMessage);
+		RoomQueryComplete(false);
 		return;
 	}
 
-	const auto Object = Value->AsObject();
-	auto RoomsJson = Object->GetArrayField(TEXT("Rooms"));
-
 #if WITH_EDITOR
 	if (OculusXRTelemetry::IsActive())
 	{
 		MRUKTelemetry::FLoadSceneFromJsonMarker()
 			.Start()
-			.AddAnnotation("NumRooms", TCHAR_TO_ANSI(*FString::FromInt(RoomsJson.Num())))
-			.End(RoomsJson.Num() > 0 ? OculusXRTelemetry::EAction::Success : OculusXRTelemetry::EAction::Fail);
+			.AddAnnotation("NumRooms", TCHAR_TO_ANSI(*FString::FromInt(NumRooms)))
+			.End(NumRooms > 0 ? OculusXRTelemetry::EAction::Success : OculusXRTelemetry::EAction::Fail);
 	}
 #endif
 
-	if (RoomsJson.IsEmpty())
+	if (NumRooms == 0)
 	{
 		UE_LOG(LogMRUK, Warning, TEXT("Could not find Rooms in JSON"));
+		RoomQueryComplete(false);
+		return;
+	}
+	UE_LOG(LogMRUK, Log, TEXT("Found %d rooms in JSON"), NumRooms);
+	RoomQueryComplete(true);
+}
+
+void UMRUKSceneData::LoadFromBinary(TConstArrayView<uint8> Data)
+{
+	MRUKBinary::FHeader Header;
+	TArray<MRUKBinary::FRoomRecord> Rooms;
+	if (!MRUKBinary::ReadScene(Data, Header, Rooms))
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("Could not read binary scene data"));
+		FinishQuery(false);
+		return;
+	}
+
+	if (Rooms.IsEmpty())
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("Could not find rooms in binary scene data"));
 		FinishQuery(false);
 		return;
 	}
-	NumRoomsLeftToInitialize = RoomsJson.Num();
-	UE_LOG(LogMRUK, Log, TEXT("Found %d rooms in JSON"), NumRoomsLeftToInitialize);
-	for (const auto& RoomJson : RoomsJson)
+	NumRoomsLeftToInitialize = Rooms.Num();
+	UE_LOG(LogMRUK, Log, TEXT("Found %d rooms in binary scene data"), NumRoomsLeftToInitialize);
+	for (const auto& Room : Rooms)
 	{
 		auto RoomQuery = NewObject<UMRUKRoomData>(this);
 		RoomsData.Push(RoomQuery);
 		RoomQuery->OnComplete.AddDynamic(this, &UMRUKSceneData::RoomQueryComplete);
-		RoomQuery->LoadFromJson(*RoomJson);
+		RoomQuery->LoadFromBinary(Room);
 	}
 }
 
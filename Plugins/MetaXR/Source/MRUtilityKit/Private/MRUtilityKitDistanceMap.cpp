@@ -0,0 +1,254 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitDistanceMap.h"
+#include "Async/ParallelFor.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	constexpr int32 SimdWidth = 4;
+	// Number of columns or rows that are processed by a single task
+	constexpr int32 LinesPerTask = 64;
+	// Distance in pixels that is used for pixels without any seed. Large enough to never be the minimum and
+	// small enough that its square still fits into a float.
+	constexpr float NoSeedDistance = 1e10f;
+
+	/**
+	 * Vertical pass of the distance transform. Every pixel of Distances has to be either zero for seed pixels or
+	 * NoSeedDistance. Afterwards every pixel contains the distance to the closest seed in the same column.
+	 */
+	void ComputeColumnDistances(float* Distances, int32 Resolution)
+	{
+		const int32 NumTasks = FMath::DivideAndRoundUp(Resolution, LinesPerTask);
+		ParallelFor(NumTasks, [Distances, Resolution](int32 Task) {
+			const int32 FirstColumn = Task * LinesPerTask;
+			const int32 LastColumn = FMath::Min(FirstColumn + LinesPerTask, Resolution);
+			const VectorRegister4Float One = VectorOneFloat();
+			for (int32 Y = 1; Y < Resolution; ++Y)
+			{
+				const float* Previous = Distances + (Y - 1) * Resolution;
+				float* Current = Distances + Y * Resolution;
+				for (int32 X = FirstColumn; X < LastColumn; X += SimdWidth)
+				{
+					VectorStore(VectorMin(VectorLoad(Current + X), VectorAdd(VectorLoad(Previous + X), One)), Current + X);
+				}
+			}
+			for (int32 Y = Resolution - 2; Y >= 0; --Y)
+			{
+				const float* Next = Distances + (Y + 1) * Resolution;
+				float* Current = Distances + Y * Resolution;
+				for (int32 X = FirstColumn; X < LastColumn; X += SimdWidth)
+				{
+					VectorStore(VectorMin(VectorLoad(Current + X), VectorAdd(VectorLoad(Next + X), One)), Current + X);
+				}
+			}
+		});
+	}
+
+	/**
+	 * Horizontal pass of the distance transform. Computes the lower envelope of the parabolas rooted at the
+	 * column distances of each row (Felzenszwalb and Huttenlocher). Afterwards every pixel contains the squared
+	 * distance to the closest seed.
+	 */
+	void ComputeRowDistances(float* Distances, int32 Resolution)
+	{
+		const int32 NumTasks = FMath::DivideAndRoundUp(Resolution, LinesPerTask);
+		ParallelFor(NumTasks, [Distances, Resolution](int32 Task) {
+			TArray<double> SquaredDistances;
+			SquaredDistances.SetNumUninitialized(Resolution);
+			// Roots of the parabolas that are part of the envelope and the positions where they start
+			TArray<int32> Roots;
+			Roots.SetNumUninitialized(Resolution);
+			TArray<double> Starts;
+			Starts.SetNumUninitialized(Resolution + 1);
+
+			const int32 FirstRow = Task * LinesPerTask;
+			const int32 LastRow = FMath::Min(FirstRow + LinesPerTask, Resolution);
+			for (int32 Y = FirstRow; Y < LastRow; ++Y)
+			{
+				float* Row = Distances + Y * Resolution;
+				int32 K = INDEX_NONE;
+				for (int32 Q = 0; Q < Resolution; ++Q)
+				{
+					SquaredDistances[Q] = static_cast<double>(Row[Q]) * Row[Q];
+					if (Row[Q] >= NoSeedDistance)
+					{
+						// Without a seed in this column the parabola can never be part of the envelope
+						continue;
+					}
+					if (K == INDEX_NONE)
+					{
+						K = 0;
+						Roots[0] = Q;
+						Starts[0] = -UE_DOUBLE_BIG_NUMBER;
+						Starts[1] = UE_DOUBLE_BIG_NUMBER;
+						continue;
+					}
+					double Intersection;
+					while (true)
+					{
+						const int32 R = Roots[K];
+						Intersection = ((SquaredDistances[Q] + Q * Q) - (SquaredDistances[R] + R * R)) / (2.0 * (Q - R));
+						if (Intersection > Starts[K])
+						{
+							break;
+						}
+						--K;
+					}
+					++K;
+					Roots[K] = Q;
+					Starts[K] = Intersection;
+					Starts[K + 1] = UE_DOUBLE_BIG_NUMBER;
+				}
+
+				if (K == INDEX_NONE)
+				{
+					// No seed in the whole row, the column pass already left every pixel at NoSeedDistance
+					for (int32 X = 0; X < Resolution; ++X)
+					{
+						Row[X] = NoSeedDistance * NoSeedDistance;
+					}
+					continue;
+				}
+
+				K = 0;
+				for (int32 X = 0; X < Resolution; ++X)
+				{
+					while (Starts[K + 1] < X)
+					{
+						++K;
+					}
+					const int32 R = Roots[K];
+					Row[X] = static_cast<float>((X - R) * (X - R) + SquaredDistances[R]);
+				}
+			}
+		});
+	}
+} // namespace
+
+void FMRUKDistanceMap::Init(int32 InResolution, double Size)
+{
+	Resolution = Align(FMath::Max(InResolution, 1), SimdWidth);
+	PixelSize = Size / Resolution;
+	Mask.Init(0, Resolution * Resolution);
+	Distances.Empty();
+}
+
+void FMRUKDistanceMap::FillPolygon(TConstArrayView<FVector2D> Polygon, bool Free)
+{
+	const int32 NumVertices = Polygon.Num();
+	if (NumVertices < 3)
+	{
+		return;
+	}
+
+	double MinY = UE_DOUBLE_BIG_NUMBER;
+	double MaxY = -UE_DOUBLE_BIG_NUMBER;
+	for (const FVector2D& Vertex : Polygon)
+	{
+		MinY = FMath::Min(MinY, Vertex.Y);
+		MaxY = FMath::Max(MaxY, Vertex.Y);
+	}
+	const int32 FirstRow = FMath::Max(FMath::CeilToInt32(MinY - 0.5), 0);
+	const int32 LastRow = FMath::Min(FMath::FloorToInt32(MaxY - 0.5), Resolution - 1);
+
+	const uint8 Value = Free ? 1 : 0;
+	TArray<double, TInlineAllocator<16>> Intersections;
+	for (int32 Y = FirstRow; Y <= LastRow; ++Y)
+	{
+		// Scanline through the pixel centers of the row. Edges are treated as half open so that vertices
+		// on the scanline are only counted once.
+		const double CenterY = Y + 0.5;
+		Intersections.Reset();
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const FVector2D& P1 = Polygon[i];
+			const FVector2D& P2 = Polygon[(i + 1) % NumVertices];
+			if ((P1.Y <= CenterY) != (P2.Y <= CenterY))
+			{
+				Intersections.Push(P1.X + (CenterY - P1.Y) / (P2.Y - P1.Y) * (P2.X - P1.X));
+			}
+		}
+		Intersections.Sort();
+
+		uint8* Row = Mask.GetData() + Y * Resolution;
+		for (int32 i = 0; i + 1 < Intersections.Num(); i += 2)
+		{
+			const int32 FirstColumn = FMath::Max(FMath::CeilToInt32(Intersections[i] - 0.5), 0);
+			const int32 LastColumn = FMath::Min(FMath::CeilToInt32(Intersections[i + 1] - 0.5), Resolution);
+			for (int32 X = FirstColumn; X < LastColumn; ++X)
+			{
+				Row[X] = Value;
+			}
+		}
+	}
+}
+
+void FMRUKDistanceMap::Build()
+{
+	const int32 NumPixels = Resolution * Resolution;
+	if (NumPixels == 0)
+	{
+		return;
+	}
+
+	// Free pixels need the distance to occupied space and vice versa. Both transforms are computed
+	// independently of each other and combined at the end.
+	TArray<float> ToOccupied;
+	TArray<float> ToFree;
+	ToOccupied.SetNumUninitialized(NumPixels);
+	ToFree.SetNumUninitialized(NumPixels);
+	for (int32 i = 0; i < NumPixels; ++i)
+	{
+		ToOccupied[i] = Mask[i] ? NoSeedDistance : 0.0f;
+		ToFree[i] = Mask[i] ? 0.0f : NoSeedDistance;
+	}
+
+	ComputeColumnDistances(ToOccupied.GetData(), Resolution);
+	ComputeColumnDistances(ToFree.GetData(), Resolution);
+	ComputeRowDistances(ToOccupied.GetData(), Resolution);
+	ComputeRowDistances(ToFree.GetData(), Resolution);
+
+	// Distances are measured between pixel centers. Subtract half a pixel so that the result approximates
+	// the distance to the border between free and occupied space. If there is no border at all the
+	// distance is clamped to the diagonal of the map.
+	const float MaxDistance = Resolution * UE_SQRT_2;
+	Distances.SetNumUninitialized(NumPixels);
+	ParallelFor(FMath::DivideAndRoundUp(NumPixels, LinesPerTask * Resolution), [this, &ToOccupied, &ToFree, NumPixels, MaxDistance](int32 Task) {
+		const int32 First = Task * LinesPerTask * Resolution;
+		const int32 Last = FMath::Min(First + LinesPerTask * Resolution, NumPixels);
+		for (int32 i = First; i < Last; ++i)
+		{
+			if (Mask[i])
+			{
+				Distances[i] = static_cast<float>((FMath::Min(FMath::Sqrt(ToOccupied[i]), MaxDistance) - 0.5f) * PixelSize);
+			}
+			else
+			{
+				Distances[i] = static_cast<float>(-(FMath::Min(FMath::Sqrt(ToFree[i]), MaxDistance) - 0.5f) * PixelSize);
+			}
+		}
+	});
+}
+
+float FMRUKDistanceMap::Sample(const FVector2D& PixelPosition) const
+{
+	if (!IsValid())
+	{
+		return 0.0f;
+	}
+
+	const double MaxPosition = Resolution - 1;
+	const double SampleX = FMath::Clamp(PixelPosition.X - 0.5, 0.0, MaxPosition);
+	const double SampleY = FMath::Clamp(PixelPosition.Y - 0.5, 0.0, MaxPosition);
+	const int32 X0 = FMath::Min(FMath::FloorToInt32(SampleX), Resolution - 1);
+	const int32 Y0 = FMath::Min(FMath::FloorToInt32(SampleY), Resolution - 1);
+	const int32 X1 = FMath::Min(X0 + 1, Resolution - 1);
+	const int32 Y1 = FMath::Min(Y0 + 1, Resolution - 1);
+	const float FracX = static_cast<float>(SampleX - X0);
+	const float FracY = static_cast<float>(SampleY - Y0);
+
+	const float Top = FMath::Lerp(Distances[X0 + Y0 * Resolution], Distances[X1 + Y0 * Resolution], FracX);
+	const float Bottom = FMath::Lerp(Distances[X0 + Y1 * Resolution], Distances[X1 + Y1 * Resolution], FracX);
+	return FMath::Lerp(Top, Bottom, FracY);
+}
@@ -9,12 +9,50 @@
 #include "Engine/CanvasRenderTarget2D.h"
 #include "Engine/Canvas.h"
 #include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
 #include "Engine/World.h"
 #include "Kismet/KismetRenderingLibrary.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialInterface.h"
 #include "UObject/ConstructorHelpers.h"
 
+namespace
+{
+	// Andrew's monotone chain. Returns the hull in counter clockwise order.
+	TArray<FVector2D> ComputeConvexHull(TArray<FVector2D> Points)
+	{
+		Points.Sort([](const FVector2D& A, const FVector2D& B) {
+			return A.X < B.X || (A.X == B.X && A.Y < B.Y);
+		});
+		const auto Cross = [](const FVector2D& O, const FVector2D& A, const FVector2D& B) {
+			return FVector2D::CrossProduct(A - O, B - O);
+		};
+
+		TArray<FVector2D> Hull;
+		Hull.Reserve(Points.Num() + 1);
+		for (const FVector2D& Point : Points)
+		{
+			while (Hull.Num() >= 2 && Cross(Hull[Hull.Num() - 2], Hull.Last(), Point) <= 0.0)
+			{
+				Hull.Pop(EAllowShrinking::No);
+			}
+			Hull.Push(Point);
+		}
+		const int32 LowerHullSize = Hull.Num() + 1;
+		for (int32 i = Points.Num() - 2; i >= 0; --i)
+		{
+			while (Hull.Num() >= LowerHullSize && Cross(Hull[Hull.Num() - 2], Hull.Last(), Points[i]) <= 0.0)
+			{
+				Hull.Pop(EAllowShrinking::No);
+			}
+			Hull.Push(Points[i]);
+		}
+		// The first point got added again at the end
+		Hull.Pop(EAllowShrinking::No);
+		return Hull;
+	}
+} // namespace
+
 AMRUKDistanceMapGenerator::AMRUKDistanceMapGenerator()
 {
 	// Create components
@@ -130,6 +168,16 @@ void AMRUKDistanceMapGenerator::BeginPlay()
 
 UTexture* AMRUKDistanceMapGenerator::CaptureDistanceMap()
 {
+	if (Backend == EMRUKDistanceMapBackend::CPU)
+	{
+		ComputeDistanceMapOnCPU();
+		if (UploadCPUDistanceMap)
+		{
+			UploadDistanceMapFromCPU();
+		}
+		return GetDistanceMap();
+	}
+
 	CaptureInitialSceneMask();
 	RenderDistanceMap();
 	return GetDistanceMap();
@@ -247,6 +295,115 @@ void AMRUKDistanceMapGenerator::RenderDistanceMap()
 	}
 }
 
+void AMRUKDistanceMapGenerator::ComputeDistanceMapOnCPU()
+{
+	CPUDistanceMap.Init(CPUResolution, SceneCapture2D->OrthoWidth);
+
+	// Use the same rooms as the mask meshes so that both backends see the same scene.
+	// Floors have to be rasterized first since scene volumes are placed on top of them.
+
+	TArray<FVector2D> Footprint;
+	for (const auto& [Room, Actors] : SpawnedMaskMeshes)
+	{
+		if (!IsValid(Room) || !Room->FloorAnchor)
+		{
+			continue;
+		}
+		const FTransform& FloorTransform = Room->FloorAnchor->GetActorTransform();
+		Footprint.Reset();
+		for (const FVector2D& Vertex : Room->FloorAnchor->PlaneBoundary2D)
+		{
+			Footprint.Push(WorldToDistanceMapPixel(FloorTransform.TransformPosition(FVector(0.0, Vertex.X, Vertex.Y))));
+		}
+		CPUDistanceMap.FillPolygon(Footprint, true);
+	}
+
+	for (const auto& [Room, Actors] : SpawnedMaskMeshes)
+	{
+		if (!IsValid(Room))
+		{
+			continue;
+		}
+		for (const AMRUKAnchor* Anchor : Room->AllAnchors)
+		{
+			if (!Anchor || !Anchor->VolumeBounds.IsValid)
+			{
+				continue;
+			}
+			const FTransform& AnchorTransform = Anchor->GetActorTransform();
+			FVector Corners[8];
+			Anchor->VolumeBounds.GetVertices(Corners);
+			Footprint.Reset();
+			for (const FVector& Corner : Corners)
+			{
+				Footprint.Push(WorldToDistanceMapPixel(AnchorTransform.TransformPosition(Corner)));
+			}
+			CPUDistanceMap.FillPolygon(ComputeConvexHull(Footprint), false);
+		}
+	}
+
+	CPUDistanceMap.Build();
+}
+
+void AMRUKDistanceMapGenerator::UploadDistanceMapFromCPU()
+{
+	const int32 Resolution = CPUDistanceMap.GetResolution();
+	if (!CPUDistanceMapTexture || CPUDistanceMapTexture->GetSizeX() != Resolution)
+	{
+		CPUDistanceMapTexture = UTexture2D::CreateTransient(Resolution, Resolution, PF_R32_FLOAT);
+		CPUDistanceMapTexture->Filter = TF_Bilinear;
+		CPUDistanceMapTexture->AddressX = TA_Clamp;
+		CPUDistanceMapTexture->AddressY = TA_Clamp;
+		CPUDistanceMapTexture->SRGB = 0;
+	}
+
+	const TArray<float>& Distances = CPUDistanceMap.GetDistances();
+	FTexture2DMipMap& Mip = CPUDistanceMapTexture->GetPlatformData()->Mips[0];
+	float* Data = static_cast<float*>(Mip.BulkData.Lock(LOCK_READ_WRITE));
+	for (int32 i = 0; i < Distances.Num(); ++i)
+	{
+		Data[i] = ApplyGenerationMode(Distances[i]);
+	}
+	Mip.BulkData.Unlock();
+
+	CPUDistanceMapTexture->UpdateResource();
+}
+
+float AMRUKDistanceMapGenerator::ApplyGenerationMode(float SignedDistance) const
+{
+	switch (DistanceMapGenerationMode)
+	{
+		case EMRUKDistanceMapGenerationMode::FreeSpace:
+			return FMath::Max(SignedDistance, 0.0f);
+		case EMRUKDistanceMapGenerationMode::OccupiedSpace:
+			return FMath::Max(-SignedDistance, 0.0f);
+		case EMRUKDistanceMapGenerationMode::AllSpace:
+		case EMRUKDistanceMapGenerationMode::None:
+			break;
+	}
+	return SignedDistance;
+}
+
+FVector2D AMRUKDistanceMapGenerator::WorldToDistanceMapPixel(const FVector& WorldPosition) const
+{
+	// The scene capture looks along its X axis. Its Y axis points to the right of the image and its Z axis to the top.
+	const FVector LocalPosition = SceneCapture2D->GetComponentTransform().InverseTransformPositionNoScale(WorldPosition);
+	const double Resolution = CPUDistanceMap.GetResolution();
+	return FVector2D(
+		(LocalPosition.Y / SceneCapture2D->OrthoWidth + 0.5) * Resolution,
+		(-LocalPosition.Z / SceneCapture2D->OrthoWidth + 0.5) * Resolution);
+}
+
+float AMRUKDistanceMapGenerator::SampleDistance(const FVector& WorldPosition) const
+{
+	if (!CPUDistanceMap.IsValid())
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("Make sure to first compute the distance map by calling CaptureDistanceMap() with the CPU backend"));
+		return 0.0f;
+	}
+	return ApplyGenerationMode(CPUDistanceMap.Sample(WorldToDistanceMapPixel(WorldPosition)));
+}
+
 void AMRUKDistanceMapGenerator::OnRoomCreated(AMRUKRoom* Room)
 {
 	if (SpawnMode == EMRUKSpawnMode::CurrentRoomOnly && GetGameInstance()->GetSubsystem<UMRUKSubsystem>()->GetCurrentRoom() != Room)
@@ -267,7 +424,35 @@ void AMRUKDistanceMapGenerator::OnRoomUpdated(AMRUKRoom* Room)
 		return;
 	}
 
-	CreateMaskMeshesForRoom(Room);
+	// The mask meshes of changed anchors have already been replaced in OnAnchorChanged(), and the
+	// other mask meshes are attached to their anchors. Only the distance map has to be captured again.
+	OnReady.Broadcast();
+}
+
+void AMRUKDistanceMapGenerator::OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change)
+{
+	TArray<AActor*>* Actors = SpawnedMaskMeshes.Find(Anchor->Room);
+	if (Change == EMRUKAnchorChange::Pose || !Actors)
+	{
+		return;
+	}
+
+	if (Change != EMRUKAnchorChange::Created)
+	{
+		Actors->RemoveAll([this, Anchor](AActor* Actor) {
+			if (IsValid(Actor) && Actor->GetAttachParentActor() == Anchor)
+			{
+				SceneCapture2D->ShowOnlyActors.Remove(Actor);
+				Actor->Destroy();
+				return true;
+			}
+			return false;
+		});
+	}
+	if (Change != EMRUKAnchorChange::Removed && (Anchor->VolumeBounds.IsValid || Anchor == Anchor->Room->FloorAnchor))
+	{
+		Actors->Push(CreateMaskMeshOfAnchor(Anchor));
+	}
 }
 
 void AMRUKDistanceMapGenerator::CreateMaskMeshesForRoom(AMRUKRoom* Room)
@@ -308,6 +493,7 @@ void AMRUKDistanceMapGenerator::CreateMaskMeshesForRoom(AMRUKRoom* Room)
 	}
 
 	SpawnedMaskMeshes.Add(Room, SpawnedActors);
+	Room->OnAnchorChanged.AddUniqueDynamic(this, &AMRUKDistanceMapGenerator::OnAnchorChanged);
 
 	const auto Subsystem = GetGameInstance()->GetSubsystem<UMRUKSubsystem>();
 	Subsystem->OnRoomRemoved.AddUniqueDynamic(this, &AMRUKDistanceMapGenerator::RemoveMaskMeshesFromRoom);
@@ -384,6 +570,14 @@ AActor* AMRUKDistanceMapGenerator::UpdateMaskMeshOfAnchor(AMRUKAnchor* Anchor)
 
 UTexture* AMRUKDistanceMapGenerator::GetDistanceMap() const
 {
+	if (Backend == EMRUKDistanceMapBackend::CPU)
+	{
+		if (!CPUDistanceMapTexture)
+		{
+			UE_LOG(LogMRUK, Warning, TEXT("Make sure to enable UploadCPUDistanceMap and to call CaptureDistanceMap() first"));
+		}
+		return CPUDistanceMapTexture;
+	}
 	return GetDistanceMapRenderTarget();
 }
 
@@ -424,4 +618,5 @@ void AMRUKDistanceMapGenerator::RemoveMaskMeshesFromRoom(AMRUKRoom* Room)
 		Actors->Empty();
 		SpawnedMaskMeshes.Remove(Room);
 	}
+	Room->OnAnchorChanged.RemoveDynamic(this, &AMRUKDistanceMapGenerator::OnAnchorChanged);
 }
@@ -54,21 +54,6 @@ void AMRUKGuardianSpawner::SpawnGuardians(AMRUKRoom* Room)
 	Subsystem->OnRoomUpdated.AddUniqueDynamic(this, &AMRUKGuardianSpawner::OnRoomUpdated);
 	Subsystem->OnRoomRemoved.AddUniqueDynamic(this, &AMRUKGuardianSpawner::OnRoomRemoved);
 
-	const auto SpawnGuardian = [this](AMRUKAnchor* Anchor, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments) {
-		// Create guardian actor
-		const auto GuardianActor = GetWorld()->SpawnActor<AMRUKGuardian>();
-		GuardianActor->AttachToComponent(Anchor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-		GuardianActor->SetActorHiddenInGame(IsHidden());
-
-		// Generate procedural mesh
-		const auto ProceduralMesh = NewObject<UProceduralMeshComponent>(GuardianActor, TEXT("GuardianMesh"));
-		Anchor->GenerateProceduralAnchorMesh(ProceduralMesh, PlaneUVAdjustments, {}, true, false, 0.01);
-		ProceduralMesh->SetMaterial(0, DynamicGuardianMaterial);
-		GuardianActor->CreateGuardian(ProceduralMesh);
-
-		return GuardianActor;
-	};
-
 	TArray<AMRUKGuardian*> SpawnedActors;
 
 	// Attach procedural meshes to the walls first because they are connected.
@@ -94,6 +79,23 @@ void AMRUKGuardianSpawner::SpawnGuardians(AMRUKRoom* Room)
 	}
 
 	SpawnedGuardians.Add(Room, SpawnedActors);
+	Room->OnAnchorChanged.AddUniqueDynamic(this, &AMRUKGuardianSpawner::OnAnchorChanged);
+}
+
+AMRUKGuardian* AMRUKGuardianSpawner::SpawnGuardian(AMRUKAnchor* Anchor, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments)
+{
+	// Create guardian actor
+	const auto GuardianActor = GetWorld()->SpawnActor<AMRUKGuardian>();
+	GuardianActor->AttachToComponent(Anchor->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	GuardianActor->SetActorHiddenInGame(IsHidden());
+
+	// Generate procedural mesh
+	const auto ProceduralMesh = NewObject<UProceduralMeshComponent>(GuardianActor, TEXT("GuardianMesh"));
+	Anchor->GenerateProceduralAnchorMesh(ProceduralMesh, PlaneUVAdjustments, {}, true, false, 0.01);
+	ProceduralMesh->SetMaterial(0, DynamicGuardianMaterial);
+	GuardianActor->CreateGuardian(ProceduralMesh);
+
+	return GuardianActor;
 }
 
 void AMRUKGuardianSpawner::SetGridDensity(double Density)
@@ -215,7 +217,51 @@ void AMRUKGuardianSpawner::OnRoomUpdated(AMRUKRoom* Room)
 		// we only want to update the one room we created
 		return;
 	}
-	SpawnGuardians(Room);
+
+	// Changes of single anchors have already been applied in OnAnchorChanged()
+	if (RoomsToRespawn.Remove(Room) > 0)
+	{
+		SpawnGuardians(Room);
+	}
+}
+
+void AMRUKGuardianSpawner::OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change)
+{
+	AMRUKRoom* Room = Anchor->Room;
+	TArray<AMRUKGuardian*>* Guardians = SpawnedGuardians.Find(Room);
+	if (Change == EMRUKAnchorChange::Pose || !Guardians || RoomsToRespawn.Contains(Room))
+	{
+		// Guardians are attached to their anchor and follow it
+		return;
+	}
+
+	if (Anchor->HasLabel(FMRUKLabels::Floor) || Anchor->HasLabel(FMRUKLabels::Ceiling))
+	{
+		// The floor and ceiling don't have a guardian
+		return;
+	}
+	if (Room->IsWallAnchor(Anchor) || Anchor->HasLabel(FMRUKLabels::WallFace))
+	{
+		// The guardians of the walls are connected through their UVs
+		RoomsToRespawn.Add(Room);
+		return;
+	}
+
+	if (Change != EMRUKAnchorChange::Created)
+	{
+		Guardians->RemoveAll([Anchor](AMRUKGuardian* Guardian) {
+			if (IsValid(Guardian) && Guardian->GetAttachParentActor() == Anchor)
+			{
+				Guardian->Destroy();
+				return true;
+			}
+			return false;
+		});
+	}
+	if (Change != EMRUKAnchorChange::Removed)
+	{
+		Guardians->Push(SpawnGuardian(Anchor, {}));
+	}
 }
 
 void AMRUKGuardianSpawner::OnRoomRemoved(AMRUKRoom* Room)
@@ -237,4 +283,9 @@ void AMRUKGuardianSpawner::DestroyGuardians(AMRUKRoom* Room)
 		Actors->Empty();
 		SpawnedGuardians.Remove(Room);
 	}
+	if (IsValid(Room))
+	{
+		Room->OnAnchorChanged.RemoveDynamic(this, &AMRUKGuardianSpawner::OnAnchorChanged);
+	}
+	RoomsToRespawn.Remove(Room);
 }
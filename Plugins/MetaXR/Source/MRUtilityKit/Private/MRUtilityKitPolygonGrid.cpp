@@ -0,0 +1,203 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitPolygonGrid.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+	// Upper limit for the number of rows so that huge boundaries don't allocate excessive memory
+	constexpr int32 MaxRows = 1024;
+	constexpr int32 SimdWidth = 4;
+} // namespace
+
+void FMRUKPolygonGrid::Build(TConstArrayView<FVector2D> Boundary)
+{
+	Reset();
+
+	const int32 NumVertices = Boundary.Num();
+	if (NumVertices == 0)
+	{
+		return;
+	}
+
+	TArray<FEdge> BoundaryEdges;
+	BoundaryEdges.Reserve(NumVertices);
+	MinY = UE_BIG_NUMBER;
+	MaxY = -UE_BIG_NUMBER;
+	for (int32 i = 1; i <= NumVertices; ++i)
+	{
+		const FVector2D P1 = Boundary[i - 1];
+		const FVector2D P2 = Boundary[i % NumVertices];
+		// Horizontal edges can never be crossed by the horizontal ray of the test
+		if (P1.Y == P2.Y)
+		{
+			continue;
+		}
+		FEdge& Edge = BoundaryEdges.AddDefaulted_GetRef();
+		Edge.MinY = FMath::Min(P1.Y, P2.Y);
+		Edge.MaxY = FMath::Max(P1.Y, P2.Y);
+		Edge.MaxX = FMath::Max(P1.X, P2.X);
+		Edge.X1 = P1.X;
+		Edge.Y1 = P1.Y;
+		Edge.DX = P2.X - P1.X;
+		Edge.DY = P2.Y - P1.Y;
+		MinY = FMath::Min(MinY, Edge.MinY);
+		MaxY = FMath::Max(MaxY, Edge.MaxY);
+	}
+
+	if (BoundaryEdges.IsEmpty())
+	{
+		MinY = MaxY = 0.0;
+		return;
+	}
+
+	const int32 NumRows = FMath::Clamp(BoundaryEdges.Num(), 1, MaxRows);
+	InvRowHeight = NumRows / (MaxY - MinY);
+	RowStarts.Init(0, NumRows + 1);
+
+	// Count the edges per row first so that all rows can be stored in a single array
+	for (const FEdge& Edge : BoundaryEdges)
+	{
+		for (int32 Row = GetRow(Edge.MinY); Row <= GetRow(Edge.MaxY); ++Row)
+		{
+			++RowStarts[Row + 1];
+		}
+	}
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		RowStarts[Row + 1] += RowStarts[Row];
+	}
+
+	Edges.SetNumUninitialized(RowStarts[NumRows]);
+	TArray<int32> RowEnds(RowStarts.GetData(), NumRows);
+	for (const FEdge& Edge : BoundaryEdges)
+	{
+		for (int32 Row = GetRow(Edge.MinY); Row <= GetRow(Edge.MaxY); ++Row)
+		{
+			Edges[RowEnds[Row]++] = Edge;
+		}
+	}
+}
+
+void FMRUKPolygonGrid::Reset()
+{
+	Edges.Reset();
+	RowStarts.Reset();
+	MinY = 0.0;
+	MaxY = 0.0;
+	InvRowHeight = 0.0;
+}
+
+int32 FMRUKPolygonGrid::GetRow(double Y) const
+{
+	return FMath::Clamp(static_cast<int32>((Y - MinY) * InvRowHeight), 0, RowStarts.Num() - 2);
+}
+
+bool FMRUKPolygonGrid::IsInside(const FVector2D& Position) const
+{
+	// Every edge that can be crossed lies within the Y range of the polygon. This also filters out NaNs.
+	if (!(Position.Y > MinY && Position.Y <= MaxY))
+	{
+		return false;
+	}
+
+	const int32 Row = GetRow(Position.Y);
+	int32 Intersections = 0;
+	for (int32 EdgeIndex = RowStarts[Row]; EdgeIndex < RowStarts[Row + 1]; ++EdgeIndex)
+	{
+		const FEdge& Edge = Edges[EdgeIndex];
+		if (Position.Y > Edge.MinY && Position.Y <= Edge.MaxY && Position.X <= Edge.MaxX)
+		{
+			const auto Frac = (Position.Y - Edge.Y1) / Edge.DY;
+			const auto XIntersection = Edge.X1 + Frac * Edge.DX;
+			if (Position.X <= XIntersection)
+			{
+				Intersections++;
+			}
+		}
+	}
+	return Intersections % 2 == 1;
+}
+
+void FMRUKPolygonGrid::IsInside(TConstArrayView<FVector2D> Positions, TArray<bool>& OutInside) const
+{
+	const int32 NumPositions = Positions.Num();
+	OutInside.Init(false, NumPositions);
+	if (Edges.IsEmpty())
+	{
+		return;
+	}
+
+	// Sort the positions by row with a counting sort so that the positions of a group share the same edges
+	const int32 NumRows = RowStarts.Num() - 1;
+	TArray<int32> PositionRows;
+	PositionRows.SetNumUninitialized(NumPositions);
+	TArray<int32> RowOffsets;
+	RowOffsets.Init(0, NumRows + 1);
+	for (int32 i = 0; i < NumPositions; ++i)
+	{
+		const FVector2D& Position = Positions[i];
+		PositionRows[i] = Position.Y > MinY && Position.Y <= MaxY ? GetRow(Position.Y) : INDEX_NONE;
+		if (PositionRows[i] != INDEX_NONE)
+		{
+			++RowOffsets[PositionRows[i] + 1];
+		}
+	}
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		RowOffsets[Row + 1] += RowOffsets[Row];
+	}
+	TArray<int32> SortedPositions;
+	SortedPositions.SetNumUninitialized(RowOffsets[NumRows]);
+	{
+		TArray<int32> RowEnds(RowOffsets.GetData(), NumRows);
+		for (int32 i = 0; i < NumPositions; ++i)
+		{
+			if (PositionRows[i] != INDEX_NONE)
+			{
+				SortedPositions[RowEnds[PositionRows[i]]++] = i;
+			}
+		}
+	}
+
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		const FEdge* RowEdges = Edges.GetData() + RowStarts[Row];
+		const int32 NumRowEdges = RowStarts[Row + 1] - RowStarts[Row];
+		for (int32 First = RowOffsets[Row]; First < RowOffsets[Row + 1]; First += SimdWidth)
+		{
+			const int32 NumLanes = FMath::Min(SimdWidth, RowOffsets[Row + 1] - First);
+
+			// Unused lanes repeat the last position, their results are ignored
+			alignas(32) double Xs[SimdWidth];
+			alignas(32) double Ys[SimdWidth];
+			for (int32 Lane = 0; Lane < SimdWidth; ++Lane)
+			{
+				const FVector2D& Position = Positions[SortedPositions[First + FMath::Min(Lane, NumLanes - 1)]];
+				Xs[Lane] = Position.X;
+				Ys[Lane] = Position.Y;
+			}
+			const VectorRegister4Double X = VectorLoadAligned(Xs);
+			const VectorRegister4Double Y = VectorLoadAligned(Ys);
+
+			// Instead of counting the intersections only track whether the count is odd
+			VectorRegister4Double Odd = VectorZeroDouble();
+			for (int32 EdgeIndex = 0; EdgeIndex < NumRowEdges; ++EdgeIndex)
+			{
+				const FEdge& Edge = RowEdges[EdgeIndex];
+				VectorRegister4Double Mask = VectorBitwiseAnd(VectorCompareGT(Y, VectorSetFloat1(Edge.MinY)), VectorCompareLE(Y, VectorSetFloat1(Edge.MaxY)));
+				Mask = VectorBitwiseAnd(Mask, VectorCompareLE(X, VectorSetFloat1(Edge.MaxX)));
+				const VectorRegister4Double Frac = VectorDivide(VectorSubtract(Y, VectorSetFloat1(Edge.Y1)), VectorSetFloat1(Edge.DY));
+				const VectorRegister4Double XIntersection = VectorAdd(VectorSetFloat1(Edge.X1), VectorMultiply(Frac, VectorSetFloat1(Edge.DX)));
+				Mask = VectorBitwiseAnd(Mask, VectorCompareLE(X, XIntersection));
+				Odd = VectorBitwiseXor(Odd, Mask);
+			}
+
+			const uint32 OddBits = VectorMaskBits(Odd);
+			for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+			{
+				OutInside[SortedPositions[First + Lane]] = (OddBits & (1u << Lane)) != 0;
+			}
+		}
+	}
+}
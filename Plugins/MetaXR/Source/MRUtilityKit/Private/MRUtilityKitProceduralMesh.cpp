@@ -0,0 +1,256 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitProceduralMesh.h"
+#include "MRUtilityKitGeometry.h"
+#include "Materials/MaterialInterface.h"
+
+namespace MRUKProceduralMesh
+{
+	namespace
+	{
+		void GenerateVolume(const FMRUKProceduralMeshInput& Input, FMRUKProceduralMeshSection& Section)
+		{
+			TArray<FVector>& Vertices = Section.Vertices;
+			TArray<int32>& Triangles = Section.Triangles;
+			TArray<FVector>& Normals = Section.Normals;
+			TArray<FVector2D>& UVs = Section.UV0s;
+			constexpr int32 NumVertices = 24;
+			constexpr int32 NumTriangles = 12;
+			Vertices.Reserve(NumVertices);
+			Triangles.Reserve(3 * NumTriangles);
+			Normals.Reserve(NumVertices);
+			UVs.Reserve(NumVertices);
+
+			FBox VolumeBoundsOffset(Input.VolumeBounds.Min - Input.Offset, Input.VolumeBounds.Max + Input.Offset);
+			for (int i = 0; i < 3; i++)
+			{
+				for (int j = 0; j < 2; j++)
+				{
+					FVector Normal = FVector::ZeroVector;
+					if (j == 0)
+					{
+						Normal[i] = -1.0f;
+					}
+					else
+					{
+						Normal[i] = 1.0f;
+					}
+					auto BaseIndex = Vertices.Num();
+					FVector Vertex;
+					Vertex[i] = VolumeBoundsOffset[j][i];
+					for (int k = 0; k < 2; k++)
+					{
+						for (int l = 0; l < 2; l++)
+						{
+							Vertex[(i + 1) % 3] = VolumeBoundsOffset[k][(i + 1) % 3];
+							Vertex[(i + 2) % 3] = VolumeBoundsOffset[l][(i + 2) % 3];
+							Vertices.Push(Vertex);
+							Normals.Push(Normal);
+							// The 4 side faces of the cube should have their 0, 0 at the top left corner
+							// when viewed from the outside.
+							// The top face should have UVs that are consistent with planes to avoid Z fighting
+							// in case a plane and volume overlap (e.g. in the case of the desk).
+							FVector2D UV;
+							switch (i)
+							{
+								case 0:
+									UV = FVector2D(1 - k, 1 - l);
+									break;
+								case 1:
+									UV = FVector2D(k, l);
+									break;
+								case 2:
+									UV = FVector2D(1 - l, k);
+									break;
+								default:
+									ensure(0);
+							}
+							if (j == 0)
+							{
+								UV.X = 1 - UV.X;
+							}
+							UVs.Push(UV);
+						}
+					}
+					if (j == 1)
+					{
+						Triangles.Push(BaseIndex);
+						Triangles.Push(BaseIndex + 1);
+						Triangles.Push(BaseIndex + 2);
+						Triangles.Push(BaseIndex + 2);
+						Triangles.Push(BaseIndex + 1);
+						Triangles.Push(BaseIndex + 3);
+					}
+					else
+					{
+						Triangles.Push(BaseIndex);
+						Triangles.Push(BaseIndex + 2);
+						Triangles.Push(BaseIndex + 1);
+						Triangles.Push(BaseIndex + 1);
+						Triangles.Push(BaseIndex + 2);
+						Triangles.Push(BaseIndex + 3);
+					}
+				}
+			}
+		}
+
+		void GeneratePlane(const FMRUKProceduralMeshInput& Input, FMRUKProceduralMeshSection& Section)
+		{
+			TArray<FVector2D> MeshVertices;
+			MRUKTriangulatePolygon(Input.Polygons, MeshVertices, Section.Triangles);
+
+			const int32 NumVertices = MeshVertices.Num();
+			const TArray<FMRUKPlaneUV>& PlaneUVAdjustments = Input.PlaneUVAdjustments;
+			Section.Vertices.Reserve(NumVertices);
+			Section.Normals.Reserve(NumVertices);
+			Section.UV0s.Reserve(NumVertices);
+			Section.UV1s.Reserve(PlaneUVAdjustments.Num() >= 2 ? NumVertices : 0);
+			Section.UV2s.Reserve(PlaneUVAdjustments.Num() >= 3 ? NumVertices : 0);
+			Section.UV3s.Reserve(PlaneUVAdjustments.Num() >= 4 ? NumVertices : 0);
+			Section.Tangents.Reserve(NumVertices);
+
+			static const FVector Normal = -FVector::XAxisVector;
+			const FVector NormalOffset = Normal * Input.Offset;
+			const FBox2D& PlaneBounds = Input.PlaneBounds;
+			const auto BoundsSize = PlaneBounds.GetSize();
+			for (const auto& PlaneBoundaryVertex : MeshVertices)
+			{
+				const FVector Vertex = FVector(0, PlaneBoundaryVertex.X, PlaneBoundaryVertex.Y) + NormalOffset;
+				Section.Vertices.Push(Vertex);
+				Section.Normals.Push(Normal);
+				Section.Tangents.Push(FProcMeshTangent(-FVector::YAxisVector, false));
+				auto U = (PlaneBoundaryVertex.X - PlaneBounds.Min.X) / BoundsSize.X;
+				auto V = 1 - (PlaneBoundaryVertex.Y - PlaneBounds.Min.Y) / BoundsSize.Y;
+				if (PlaneUVAdjustments.Num() == 0)
+				{
+					Section.UV0s.Push(FVector2D(U, V));
+				}
+				if (PlaneUVAdjustments.Num() >= 1)
+				{
+					Section.UV0s.Push(FVector2D(U, V) * PlaneUVAdjustments[0].Scale + PlaneUVAdjustments[0].Offset);
+				}
+				if (PlaneUVAdjustments.Num() >= 2)
+				{
+					Section.UV1s.Push(FVector2D(U, V) * PlaneUVAdjustments[1].Scale + PlaneUVAdjustments[1].Offset);
+				}
+				if (PlaneUVAdjustments.Num() >= 3)
+				{
+					Section.UV2s.Push(FVector2D(U, V) * PlaneUVAdjustments[2].Scale + PlaneUVAdjustments[2].Offset);
+				}
+				if (PlaneUVAdjustments.Num() >= 4)
+				{
+					Section.UV3s.Push(FVector2D(U, V) * PlaneUVAdjustments[3].Scale + PlaneUVAdjustments[3].Offset);
+				}
+			}
+		}
+	} // namespace
+
+	TArray<FMRUKProceduralMeshSection> Generate(const FMRUKProceduralMeshInput& Input)
+	{
+		TArray<FMRUKProceduralMeshSection> Sections;
+		if (Input.VolumeBounds.IsValid)
+		{
+			GenerateVolume(Input, Sections.AddDefaulted_GetRef());
+		}
+		if (Input.PlaneBounds.bIsValid && !(Input.VolumeBounds.IsValid && Input.PreferVolume))
+		{
+			GeneratePlane(Input, Sections.AddDefaulted_GetRef());
+		}
+		return Sections;
+	}
+
+	void Apply(UProceduralMeshComponent& ProceduralMesh, const TArray<FMRUKProceduralMeshSection>& Sections, bool GenerateCollision)
+	{
+		const TArray<FLinearColor> Colors; // Currently unused
+		for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); ++SectionIndex)
+		{
+			const FMRUKProceduralMeshSection& Section = Sections[SectionIndex];
+			ProceduralMesh.CreateMeshSection_LinearColor(SectionIndex, Section.Vertices, Section.Triangles, Section.Normals, Section.UV0s, Section.UV1s, Section.UV2s, Section.UV3s, Colors, Section.Tangents, GenerateCollision);
+		}
+	}
+} // namespace MRUKProceduralMesh
+
+void FMRUKProceduralMeshQueue::Enqueue(UProceduralMeshComponent* ProceduralMesh, FMRUKProceduralMeshInput&& Input, bool GenerateCollision, UMaterialInterface* Material)
+{
+	Cancel(ProceduralMesh);
+
+	FPendingMesh& PendingMesh = PendingMeshes.AddDefaulted_GetRef();
+	PendingMesh.ProceduralMesh = ProceduralMesh;
+	PendingMesh.Material = Material;
+	PendingMesh.GenerateCollision = GenerateCollision;
+	PendingMesh.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Input = MoveTemp(Input)]() {
+		return MRUKProceduralMesh::Generate(Input);
+	});
+}
+
+int32 FMRUKProceduralMeshQueue::Commit(double BudgetSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumCommitted = 0;
+	int32 Index = 0;
+	while (Index < PendingMeshes.Num())
+	{
+		if (NumCommitted > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+		if (!PendingMeshes[Index].Task.IsCompleted())
+		{
+			++Index;
+			continue;
+		}
+		Commit(PendingMeshes[Index]);
+		PendingMeshes.RemoveAt(Index, 1, EAllowShrinking::No);
+		++NumCommitted;
+	}
+	return NumCommitted;
+}
+
+void FMRUKProceduralMeshQueue::Flush()
+{
+	for (const FPendingMesh& PendingMesh : PendingMeshes)
+	{
+		PendingMesh.Task.Wait();
+		Commit(PendingMesh);
+	}
+	PendingMeshes.Empty();
+}
+
+void FMRUKProceduralMeshQueue::Cancel(const UProceduralMeshComponent* ProceduralMesh)
+{
+	// Meshes are only enqueued once per component, so there is at most one to drop. The task keeps running in the
+	// background, its result just isn't used.
+	const int32 Index = PendingMeshes.IndexOfByPredicate([ProceduralMesh](const FPendingMesh& PendingMesh) { return PendingMesh.ProceduralMesh == ProceduralMesh; });
+	if (Index != INDEX_NONE)
+	{
+		PendingMeshes.RemoveAt(Index, 1, EAllowShrinking::No);
+	}
+}
+
+void FMRUKProceduralMeshQueue::CancelAll()
+{
+	for (const FPendingMesh& PendingMesh : PendingMeshes)
+	{
+		PendingMesh.Task.Wait();
+	}
+	PendingMeshes.Empty();
+}
+
+void FMRUKProceduralMeshQueue::Commit(const FPendingMesh& PendingMesh)
+{
+	UProceduralMeshComponent* ProceduralMesh = PendingMesh.ProceduralMesh.Get();
+	if (!ProceduralMesh)
+	{
+		// The component got destroyed while the mesh was being generated
+		return;
+	}
+
+	const TArray<FMRUKProceduralMeshSection>& Sections = PendingMesh.Task.GetResult();
+	MRUKProceduralMesh::Apply(*ProceduralMesh, Sections, PendingMesh.GenerateCollision);
+
+	UMaterialInterface* Material = PendingMesh.Material.Get();
+	for (int32 SectionIndex = 0; SectionIndex < Sections.Num(); ++SectionIndex)
+	{
+		ProceduralMesh->SetMaterial(SectionIndex, Material);
+	}
+}
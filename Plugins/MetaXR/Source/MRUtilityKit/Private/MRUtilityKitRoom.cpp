@@ -10,6 +10,7 @@
 #include "GameFramework/Pawn.h"
 #include "GameFramework/WorldSettings.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "MRUtilityKitRoom"
 
@@ -116,6 +117,7 @@ void AMRUKRoom::EndPlay(EEndPlayReason::Type Reason)
 	for (const auto& Anchor : AllAnchors)
 	{
 		OnAnchorRemoved.Broadcast(Anchor);
+		OnAnchorChanged.Broadcast(Anchor, EMRUKAnchorChange::Removed);
 		Anchor->Destroy();
 	}
 
@@ -141,6 +143,7 @@ void AMRUKRoom::LoadFromData(UMRUKRoomData* RoomData)
 
 	TArray<TObjectPtr<AMRUKAnchor>> AnchorsCreated;
 	TArray<TObjectPtr<AMRUKAnchor>> AnchorsUpdated;
+	TArray<TObjectPtr<AMRUKAnchor>> AnchorsMoved;
 
 	for (const auto& AnchorData : RoomData->AnchorsData)
 	{
@@ -152,10 +155,15 @@ void AMRUKRoom::LoadFromData(UMRUKRoomData* RoomData)
 		{
 			Anchor = *AnchorFound;
 			UE_LOG(LogMRUK, Log, TEXT("Update existing anchor in room"));
+			const FTransform OldTransform = Anchor->GetActorTransform();
 			if (Anchor->LoadFromData(AnchorData))
 			{
 				AnchorsUpdated.Push(Anchor);
 			}
+			else if (!OldTransform.Equals(Anchor->GetActorTransform()))
+			{
+				AnchorsMoved.Push(Anchor);
+			}
 			AnchorsToRemove.Remove(Anchor);
 		}
 		else
@@ -171,19 +179,28 @@ void AMRUKRoom::LoadFromData(UMRUKRoomData* RoomData)
 	UE_LOG(LogMRUK, Log, TEXT("Destroy %d old anchors"), AnchorsToRemove.Num());
 	for (auto& OldAnchor : AnchorsToRemove)
 	{
+		AnchorBVH.Remove(OldAnchor);
 		OnAnchorRemoved.Broadcast(OldAnchor);
+		OnAnchorChanged.Broadcast(OldAnchor, EMRUKAnchorChange::Removed);
 		OldAnchor->Destroy();
 	}
 
 	InitializeRoom();
 
+	UE_LOG(LogMRUK, Log, TEXT("Room update: %d anchors created, %d updated, %d moved"), AnchorsCreated.Num(), AnchorsUpdated.Num(), AnchorsMoved.Num());
 	for (auto& Anchor : AnchorsUpdated)
 	{
 		OnAnchorUpdated.Broadcast(Anchor);
+		OnAnchorChanged.Broadcast(Anchor, EMRUKAnchorChange::Geometry);
+	}
+	for (auto& Anchor : AnchorsMoved)
+	{
+		OnAnchorChanged.Broadcast(Anchor, EMRUKAnchorChange::Pose);
 	}
 	for (auto& Anchor : AnchorsCreated)
 	{
 		OnAnchorCreated.Broadcast(Anchor);
+		OnAnchorChanged.Broadcast(Anchor, EMRUKAnchorChange::Created);
 	}
 }
 
@@ -204,6 +221,22 @@ TSharedRef<FJsonObject> AMRUKRoom::JsonSerialize()
 	return JsonObject;
 }
 
+MRUKBinary::FRoomRecord AMRUKRoom::BinarySerialize(TArray<uint8>& OutBlobs)
+{
+	MRUKBinary::FRoomRecord Record;
+	Record.UUID = AnchorUUID;
+	Record.RoomLayout = RoomLayout;
+	Record.Anchors.Reserve(AllAnchors.Num());
+	for (const auto& Anchor : AllAnchors)
+	{
+		if (Anchor)
+		{
+			Record.Anchors.Add(Anchor->BinarySerialize(OutBlobs));
+		}
+	}
+	return Record;
+}
+
 bool AMRUKRoom::Corresponds(UMRUKRoomData* RoomData) const
 {
 	if (!RoomData)
@@ -280,6 +313,60 @@ void AMRUKRoom::AddAnchorToRoom(AMRUKAnchor* Anchor)
 	}
 
 	AllAnchors.Push(Anchor);
+
+	// The index in AllAnchors is used as sort key so that raycasts report hits in the same order as before
+	AnchorBVH.InsertOrUpdate(Anchor, ComputeAnchorBVHBounds(Anchor), AllAnchors.Num() - 1);
+}
+
+FBox AMRUKRoom::ComputeAnchorBVHBounds(const AMRUKAnchor* Anchor) const
+{
+	// The global mesh is tested with a line trace against its collision, there is nothing to cull it with
+	if (Anchor->HasLabel(FMRUKLabels::GlobalMesh))
+	{
+		return FBox(ForceInit);
+	}
+
+	FBox LocalBounds(ForceInit);
+	if (Anchor->PlaneBounds.bIsValid)
+	{
+		LocalBounds += FBox(FVector(0.0, Anchor->PlaneBounds.Min.X, Anchor->PlaneBounds.Min.Y), FVector(0.0, Anchor->PlaneBounds.Max.X, Anchor->PlaneBounds.Max.Y));
+	}
+	if (Anchor->VolumeBounds.IsValid)
+	{
+		LocalBounds += Anchor->VolumeBounds;
+	}
+	if (!LocalBounds.IsValid)
+	{
+		return LocalBounds;
+	}
+
+	// Anchor raycasts ignore scale, so do the same here
+	const FTransform AnchorTransform = Anchor->GetActorTransform();
+	const FTransform RoomTransform = GetActorTransform();
+	const FTransform AnchorToRoom = FTransform(AnchorTransform.GetRotation(), AnchorTransform.GetTranslation())
+										.GetRelativeTransform(FTransform(RoomTransform.GetRotation(), RoomTransform.GetTranslation()));
+
+	// Expand slightly so that planes don't end up with zero sized bounds and rays grazing an edge are not culled
+	return LocalBounds.TransformBy(AnchorToRoom).ExpandBy(0.1);
+}
+
+void AMRUKRoom::UpdateDistanceField()
+{
+	DistanceField.Reset();
+
+	const UMRUKSettings* Settings = GetDefault<UMRUKSettings>();
+	if (!Settings->EnableRoomDistanceField)
+	{
+		return;
+	}
+
+	DistanceField = GetGameInstance()->GetSubsystem<UMRUKSubsystem>()->GetOrBakeRoomDistanceField(this, Settings->RoomDistanceFieldVoxelSize);
+}
+
+FVector AMRUKRoom::WorldToDistanceFieldPosition(const FVector& WorldPosition) const
+{
+	// The distance field is baked in the space of the room
+	return GetActorTransform().InverseTransformPositionNoScale(WorldPosition);
 }
 
 void AMRUKRoom::InitializeRoom()
@@ -288,6 +375,7 @@ void AMRUKRoom::InitializeRoom()
 	ComputeAnchorHierarchy();
 	ComputeSeats();
 	ComputeRoomEdges();
+	UpdateDistanceField();
 	KeyWallAnchor = nullptr;
 }
 
@@ -524,6 +612,39 @@ bool AMRUKRoom::IsPositionInRoom(const FVector& Position, bool TestVerticalBound
 	return FloorAnchor->IsPositionInBoundary(FVector2D(LocalPos.Y, LocalPos.Z));
 }
 
+void AMRUKRoom::IsPositionInRoomBatch(const TArray<FVector>& Positions, TArray<bool>& OutInRoom, bool TestVerticalBounds)
+{
+	OutInRoom.Init(false, Positions.Num());
+	if (!FloorAnchor)
+	{
+		return;
+	}
+
+	// Only positions within the room bounds have to be tested against the floor boundary
+	const auto Transform = FloorAnchor->GetTransform();
+	TArray<int32> CandidateIndices;
+	TArray<FVector2D> LocalPositions;
+	CandidateIndices.Reserve(Positions.Num());
+	LocalPositions.Reserve(Positions.Num());
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		const FVector& Position = Positions[i];
+		if (TestVerticalBounds ? RoomBounds.IsInside(Position) : RoomBounds.IsInsideXY(Position))
+		{
+			const FVector LocalPos = Transform.InverseTransformPositionNoScale(Position);
+			CandidateIndices.Push(i);
+			LocalPositions.Push(FVector2D(LocalPos.Y, LocalPos.Z));
+		}
+	}
+
+	TArray<bool> InBoundary;
+	FloorAnchor->IsPositionInBoundaryBatch(LocalPositions, InBoundary);
+	for (int32 i = 0; i < CandidateIndices.Num(); ++i)
+	{
+		OutInRoom[CandidateIndices[i]] = InBoundary[i];
+	}
+}
+
 bool AMRUKRoom::GenerateRandomPositionInRoom(FVector& OutPosition, float MinDistanceToSurface, bool AvoidVolumes)
 {
 	return GenerateRandomPositionInRoomFromStream(OutPosition, FRandomStream(NAME_None), MinDistanceToSurface, AvoidVolumes);
@@ -715,8 +836,12 @@ bool AMRUKRoom::GenerateRandomPositionOnSurface(EMRUKSpawnLocation SpawnLocation
 
 AMRUKAnchor* AMRUKRoom::Raycast(const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, FMRUKHit& OutHit)
 {
+	const FTransform& RoomTransform = GetActorTransform();
+	FMRUKAnchorBVH::FCandidateArray Candidates;
+	AnchorBVH.QueryRay(RoomTransform.InverseTransformPositionNoScale(Origin), RoomTransform.InverseTransformVectorNoScale(Direction), MaxDist, Candidates);
+
 	AMRUKAnchor* HitComponent = nullptr;
-	for (const auto& Anchor : AllAnchors)
+	for (AMRUKAnchor* Anchor : Candidates)
 	{
 		if (!Anchor || !Anchor->PassesLabelFilter(LabelFilter))
 		{
@@ -736,8 +861,12 @@ AMRUKAnchor* AMRUKRoom::Raycast(const FVector& Origin, const FVector& Direction,
 
 bool AMRUKRoom::RaycastAll(const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors)
 {
+	const FTransform& RoomTransform = GetActorTransform();
+	FMRUKAnchorBVH::FCandidateArray Candidates;
+	AnchorBVH.QueryRay(RoomTransform.InverseTransformPositionNoScale(Origin), RoomTransform.InverseTransformVectorNoScale(Direction), MaxDist, Candidates);
+
 	bool HitAnything = false;
-	for (const auto& Anchor : AllAnchors)
+	for (AMRUKAnchor* Anchor : Candidates)
 	{
 		if (!Anchor || !Anchor->PassesLabelFilter(LabelFilter))
 		{
@@ -757,6 +886,58 @@ bool AMRUKRoom::RaycastAll(const FVector& Origin, const FVector& Direction, floa
 	return HitAnything;
 }
 
+bool AMRUKRoom::RaycastBatch(const TArray<FVector>& Origins, const TArray<FVector>& Directions, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors)
+{
+	if (Origins.Num() != Directions.Num())
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("RaycastBatch called with %d origins but %d directions"), Origins.Num(), Directions.Num());
+		return false;
+	}
+
+	const int32 NumRays = Origins.Num();
+	OutHits.SetNum(NumRays);
+	OutAnchors.Init(nullptr, NumRays);
+
+	// The global mesh is hit tested with a line trace against its collision which is done on the game thread
+	// afterwards. Everything else only reads the anchor geometry and can safely run in parallel.
+	constexpr int32 MeshComponentType = static_cast<int32>(EMRUKComponentType::Mesh);
+	const bool TestGlobalMesh = GlobalMeshAnchor && (LabelFilter.ComponentTypes & MeshComponentType) != 0 && GlobalMeshAnchor->PassesLabelFilter(LabelFilter);
+	FMRUKLabelFilter WorkerLabelFilter = LabelFilter;
+	WorkerLabelFilter.ComponentTypes &= ~MeshComponentType;
+
+	// Raycasts are cheap, make sure each task gets enough of them to be worth scheduling
+	constexpr int32 MinRaysPerTask = 32;
+	ParallelFor(TEXT("MRUKRaycastBatch"), NumRays, MinRaysPerTask, [&](int32 Index) {
+		OutHits[Index] = {};
+		OutAnchors[Index] = Raycast(Origins[Index], Directions[Index], MaxDist, WorkerLabelFilter, OutHits[Index]);
+	});
+
+	if (TestGlobalMesh)
+	{
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			float RayMaxDist = MaxDist;
+			if (OutAnchors[Index])
+			{
+				// Only accept global mesh hits that are closer than the hit that has already been found
+				if (OutHits[Index].HitDistance <= 0.0f)
+				{
+					continue;
+				}
+				RayMaxDist = OutHits[Index].HitDistance;
+			}
+			FMRUKHit Hit{};
+			if (GlobalMeshAnchor->Raycast(Origins[Index], Directions[Index], RayMaxDist, Hit, MeshComponentType) && (!OutAnchors[Index] || Hit.HitDistance < OutHits[Index].HitDistance))
+			{
+				OutHits[Index] = Hit;
+				OutAnchors[Index] = GlobalMeshAnchor;
+			}
+		}
+	}
+
+	return OutAnchors.ContainsByPredicate([](const AMRUKAnchor* Anchor) { return Anchor != nullptr; });
+}
+
 void AMRUKRoom::ClearRoom()
 {
 	RoomLayout = {};
@@ -776,6 +957,8 @@ void AMRUKRoom::ClearRoom()
 	FloorAnchor = nullptr;
 	CeilingAnchor = nullptr;
 	KeyWallAnchor = nullptr;
+	AnchorBVH.Reset();
+	DistanceField.Reset();
 }
 
 bool AMRUKRoom::DoesRoomHave(const TArray<FString>& Labels)
@@ -815,6 +998,27 @@ AMRUKAnchor* AMRUKRoom::TryGetClosestSurfacePosition(const FVector& WorldPositio
 	OutSurfacePosition = FVector::Zero();
 	AMRUKAnchor* ClosestAnchor = nullptr;
 
+	if (DistanceField && MaxDistance < DBL_MAX && LabelFilter.ExcludedLabels.IsEmpty())
+	{
+		// Use the distance field to find out cheaply if there is no surface within MaxDistance at all
+		TOptional<FMRUKRoomDistanceField::EChannel> Channel;
+		if (LabelFilter.IncludedLabels.IsEmpty())
+		{
+			Channel = FMRUKRoomDistanceField::EChannel::AllSurfaces;
+		}
+		else if (LabelFilter.IncludedLabels.Num() == 1 && LabelFilter.IncludedLabels[0] == FMRUKLabels::WallFace)
+		{
+			Channel = FMRUKRoomDistanceField::EChannel::WallFaces;
+		}
+
+		double Distance = 0.0;
+		if (Channel && DistanceField->Sample(*Channel, WorldToDistanceFieldPosition(WorldPosition), Distance) && Distance - DistanceField->GetMaxError() >= MaxDistance)
+		{
+			OutSurfaceDistance = MaxDistance;
+			return nullptr;
+		}
+	}
+
 	for (const auto& Anchor : AllAnchors)
 	{
 		if (!Anchor || !Anchor->PassesLabelFilter(LabelFilter))
@@ -838,6 +1042,16 @@ AMRUKAnchor* AMRUKRoom::TryGetClosestSurfacePosition(const FVector& WorldPositio
 
 AMRUKAnchor* AMRUKRoom::IsPositionInSceneVolume(const FVector& WorldPosition, bool TestVerticalBounds, double Tolerance)
 {
+	if (DistanceField && TestVerticalBounds)
+	{
+		// Use the distance field to find out cheaply if the position is too far away from every volume
+		double Distance = 0.0;
+		if (DistanceField->Sample(FMRUKRoomDistanceField::EChannel::SceneVolumes, WorldToDistanceFieldPosition(WorldPosition), Distance) && Distance - DistanceField->GetMaxError() > Tolerance)
+		{
+			return nullptr;
+		}
+	}
+
 	for (const auto& Anchor : AllAnchors)
 	{
 		if (!Anchor)
@@ -854,6 +1068,30 @@ AMRUKAnchor* AMRUKRoom::IsPositionInSceneVolume(const FVector& WorldPosition, bo
 	return nullptr;
 }
 
+double AMRUKRoom::GetDistanceToClosestSurface(const FVector& WorldPosition, bool ExactRefinement)
+{
+	double MaxDistance = 0.0;
+	double Distance = 0.0;
+	if (DistanceField && DistanceField->Sample(FMRUKRoomDistanceField::EChannel::AllSurfaces, WorldToDistanceFieldPosition(WorldPosition), Distance))
+	{
+		Distance = FMath::Max(Distance, 0.0);
+		if (!ExactRefinement)
+		{
+			return Distance;
+		}
+		// The closest surface can't be further away than the error of the distance field
+		MaxDistance = Distance + DistanceField->GetMaxError();
+	}
+
+	FVector SurfacePosition;
+	double SurfaceDistance = DBL_MAX;
+	if (!TryGetClosestSurfacePosition(WorldPosition, SurfacePosition, SurfaceDistance, {}, MaxDistance))
+	{
+		return MaxDistance > 0.0 ? Distance : DBL_MAX;
+	}
+	return SurfaceDistance;
+}
+
 AMRUKAnchor* AMRUKRoom::TryGetClosestSeatPose(const FVector& RayOrigin, const FVector& RayDirection, FTransform& OutSeatTransform)
 {
 	FTransform ClosestPose{};
@@ -1272,6 +1510,29 @@ bool AMRUKRoom::LoadGlobalMeshFromJsonString(const FString& JsonString, UMateria
 	return true;
 }
 
+bool AMRUKRoom::LoadGlobalMeshFromBinaryFile(const FString& FilePath, UMaterialInterface* Material)
+{
+	if (!GlobalMeshAnchor)
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("A global mesh can only be loaded from a binary file if it has a global mesh anchor. Please make sure you provide one."));
+		return false;
+	}
+
+	bool ProcMeshExisted = false;
+	UProceduralMeshComponent* ProcMesh = GetOrCreateGlobalMeshProceduralMeshComponent(ProcMeshExisted);
+
+	if (!UMRUKBPLibrary::LoadGlobalMeshFromBinaryFile(FilePath, AnchorUUID, ProcMesh, true))
+	{
+		UE_LOG(LogMRUK, Warning, TEXT("Failed loading global mesh from file %s"), *FilePath);
+		ProcMesh->DestroyComponent();
+		return false;
+	}
+
+	SetupGlobalMeshProceduralMeshComponent(*ProcMesh, ProcMeshExisted, Material);
+
+	return true;
+}
+
 FVector AMRUKRoom::ComputeCentroid(double Z)
 {
 	if (!FloorAnchor || !CeilingAnchor)
@@ -0,0 +1,179 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitRoomDistanceField.h"
+#include "MRUtilityKitRoom.h"
+#include "MRUtilityKitAnchor.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+	struct FAnchorShape
+	{
+		FTransform RoomToAnchor;
+		FBox2D PlaneBounds{ ForceInit };
+		FBox VolumeBounds{ ForceInit };
+		FVector VolumeCenter = FVector::ZeroVector;
+		FVector VolumeExtent = FVector::ZeroVector;
+		bool IsWallFace = false;
+	};
+} // namespace
+
+void FMRUKRoomDistanceField::Bake(const AMRUKRoom& Room, double InVoxelSize, int32 MaxResolution)
+{
+	for (auto& Channel : Distances)
+	{
+		Channel.Empty();
+	}
+	Bounds.Init();
+	Resolution = FIntVector::ZeroValue;
+
+	// Anchor queries ignore scale, so only rotation and translation are taken into account here as well
+	const FTransform& RoomTransform = Room.GetActorTransform();
+	const FTransform RoomRigidTransform(RoomTransform.GetRotation(), RoomTransform.GetTranslation());
+
+	FMRUKLabelFilter WallFaceFilter{};
+	WallFaceFilter.IncludedLabels = { FMRUKLabels::WallFace };
+
+	TArray<FAnchorShape> Shapes;
+	FBox ShapeBounds(ForceInit);
+	for (const auto& Anchor : Room.AllAnchors)
+	{
+		if (!Anchor || (!Anchor->PlaneBounds.bIsValid && !Anchor->VolumeBounds.IsValid))
+		{
+			continue;
+		}
+		const FTransform& AnchorTransform = Anchor->GetActorTransform();
+		const FTransform AnchorToRoom = FTransform(AnchorTransform.GetRotation(), AnchorTransform.GetTranslation()).GetRelativeTransform(RoomRigidTransform);
+
+		FAnchorShape& Shape = Shapes.AddDefaulted_GetRef();
+		Shape.RoomToAnchor = AnchorToRoom.Inverse();
+		Shape.PlaneBounds = Anchor->PlaneBounds;
+		Shape.VolumeBounds = Anchor->VolumeBounds;
+		Shape.IsWallFace = Anchor->PassesLabelFilter(WallFaceFilter);
+		if (Shape.VolumeBounds.IsValid)
+		{
+			Shape.VolumeBounds.GetCenterAndExtents(Shape.VolumeCenter, Shape.VolumeExtent);
+			ShapeBounds += Shape.VolumeBounds.TransformBy(AnchorToRoom);
+		}
+		if (Shape.PlaneBounds.bIsValid)
+		{
+			const FBox PlaneBox(FVector(0.0, Shape.PlaneBounds.Min.X, Shape.PlaneBounds.Min.Y), FVector(0.0, Shape.PlaneBounds.Max.X, Shape.PlaneBounds.Max.Y));
+			ShapeBounds += PlaneBox.TransformBy(AnchorToRoom);
+		}
+	}
+
+	if (Shapes.IsEmpty())
+	{
+		return;
+	}
+
+	// Make sure the grid, including the padding, fits into the max resolution
+	MaxResolution = FMath::Max(MaxResolution, 4);
+	VoxelSize = FMath::Max3(InVoxelSize, 1.0, ShapeBounds.GetSize().GetMax() / (MaxResolution - 3));
+	// Leave one voxel of padding around the anchors
+	Bounds = ShapeBounds.ExpandBy(VoxelSize);
+	const FVector Size = Bounds.GetSize();
+	Resolution.X = FMath::Clamp(FMath::CeilToInt32(Size.X / VoxelSize) + 1, 2, MaxResolution);
+	Resolution.Y = FMath::Clamp(FMath::CeilToInt32(Size.Y / VoxelSize) + 1, 2, MaxResolution);
+	Resolution.Z = FMath::Clamp(FMath::CeilToInt32(Size.Z / VoxelSize) + 1, 2, MaxResolution);
+	Bounds.Max = Bounds.Min + FVector(Resolution - FIntVector(1)) * VoxelSize;
+
+	// Every channel is 1-Lipschitz, so a trilinear interpolation can't be further off than the distance
+	// to the farthest corner of the voxel. Add a bit on top to account for storing the values as floats.
+	MaxError = UE_DOUBLE_SQRT_3 * VoxelSize + UE_KINDA_SMALL_NUMBER;
+
+	const int32 NumVoxels = Resolution.X * Resolution.Y * Resolution.Z;
+	for (auto& Channel : Distances)
+	{
+		Channel.SetNumUninitialized(NumVoxels);
+	}
+
+	float* AllSurfaces = Distances[static_cast<int32>(EChannel::AllSurfaces)].GetData();
+	float* WallFaces = Distances[static_cast<int32>(EChannel::WallFaces)].GetData();
+	float* SceneVolumes = Distances[static_cast<int32>(EChannel::SceneVolumes)].GetData();
+
+	ParallelFor(Resolution.Z, [&](int32 Z) {
+		for (int32 Y = 0; Y < Resolution.Y; ++Y)
+		{
+			for (int32 X = 0; X < Resolution.X; ++X)
+			{
+				const FVector Position = Bounds.Min + FVector(X, Y, Z) * VoxelSize;
+				double AllSurfacesDistance = FLT_MAX;
+				double WallFacesDistance = FLT_MAX;
+				double SceneVolumesDistance = FLT_MAX;
+				for (const FAnchorShape& Shape : Shapes)
+				{
+					const FVector LocalPosition = Shape.RoomToAnchor.TransformPositionNoScale(Position);
+					double SurfaceDistance = DBL_MAX;
+					if (Shape.PlaneBounds.bIsValid)
+					{
+						const FVector2D ClosestPoint = Shape.PlaneBounds.GetClosestPointTo(FVector2D(LocalPosition.Y, LocalPosition.Z));
+						SurfaceDistance = FVector::Distance(FVector(0.0, ClosestPoint.X, ClosestPoint.Y), LocalPosition);
+					}
+					if (Shape.VolumeBounds.IsValid)
+					{
+						SurfaceDistance = FMath::Min(SurfaceDistance, FMath::Sqrt(Shape.VolumeBounds.ComputeSquaredDistanceToPoint(LocalPosition)));
+						// This matches the tolerance test in AMRUKAnchor::IsPositionInVolumeBounds
+						const FVector AxisDistance = (LocalPosition - Shape.VolumeCenter).GetAbs() - Shape.VolumeExtent;
+						SceneVolumesDistance = FMath::Min(SceneVolumesDistance, AxisDistance.GetMax());
+					}
+					AllSurfacesDistance = FMath::Min(AllSurfacesDistance, SurfaceDistance);
+					if (Shape.IsWallFace)
+					{
+						WallFacesDistance = FMath::Min(WallFacesDistance, SurfaceDistance);
+					}
+				}
+				const int32 Index = X + Resolution.X * (Y + Resolution.Y * Z);
+				AllSurfaces[Index] = static_cast<float>(AllSurfacesDistance);
+				WallFaces[Index] = static_cast<float>(WallFacesDistance);
+				SceneVolumes[Index] = static_cast<float>(SceneVolumesDistance);
+			}
+		}
+	});
+}
+
+bool FMRUKRoomDistanceField::Sample(EChannel Channel, const FVector& RoomPosition, double& OutDistance) const
+{
+	if (!IsValid())
+	{
+		return false;
+	}
+
+	const FVector GridPosition = (RoomPosition - Bounds.Min) / VoxelSize;
+	if (GridPosition.X < 0.0 || GridPosition.Y < 0.0 || GridPosition.Z < 0.0
+		|| GridPosition.X > Resolution.X - 1 || GridPosition.Y > Resolution.Y - 1 || GridPosition.Z > Resolution.Z - 1)
+	{
+		return false;
+	}
+
+	const int32 X = FMath::Min(FMath::FloorToInt32(GridPosition.X), Resolution.X - 2);
+	const int32 Y = FMath::Min(FMath::FloorToInt32(GridPosition.Y), Resolution.Y - 2);
+	const int32 Z = FMath::Min(FMath::FloorToInt32(GridPosition.Z), Resolution.Z - 2);
+	const double FracX = GridPosition.X - X;
+	const double FracY = GridPosition.Y - Y;
+	const double FracZ = GridPosition.Z - Z;
+
+	const float* Data = Distances[static_cast<int32>(Channel)].GetData();
+	const int32 StrideY = Resolution.X;
+	const int32 StrideZ = Resolution.X * Resolution.Y;
+	const int32 Index = X + StrideY * Y + StrideZ * Z;
+
+	const double C00 = FMath::Lerp<double>(Data[Index], Data[Index + 1], FracX);
+	const double C10 = FMath::Lerp<double>(Data[Index + StrideY], Data[Index + StrideY + 1], FracX);
+	const double C01 = FMath::Lerp<double>(Data[Index + StrideZ], Data[Index + StrideZ + 1], FracX);
+	const double C11 = FMath::Lerp<double>(Data[Index + StrideY + StrideZ], Data[Index + StrideY + StrideZ + 1], FracX);
+	const double C0 = FMath::Lerp(C00, C10, FracY);
+	const double C1 = FMath::Lerp(C01, C11, FracY);
+	OutDistance = FMath::Lerp(C0, C1, FracZ);
+	return true;
+}
+
+SIZE_T FMRUKRoomDistanceField::GetAllocatedSize() const
+{
+	SIZE_T Size = 0;
+	for (const auto& Channel : Distances)
+	{
+		Size += Channel.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -17,18 +17,24 @@ TSharedPtr<FJsonValue> MRUKSerialize(const FOculusXRUUID& UUID)
 	return MakeShareable(new FJsonValueString(UUID.ToString()));
 }
 
-void MRUKDeserialize(const FJsonValue& Value, FOculusXRUUID& UUID)
+namespace
 {
-	const auto Hex = Value.AsString();
-	if (Hex.Len() == OCULUSXR_UUID_SIZE * 2)
-	{
-		HexToBytes(Hex, UUID.UUIDBytes);
-	}
-	else
+	bool HexToUUID(const FString& Hex, FOculusXRUUID& UUID)
 	{
+		if (Hex.Len() == OCULUSXR_UUID_SIZE * 2)
+		{
+			HexToBytes(Hex, UUID.UUIDBytes);
+			return true;
+		}
 		UE_LOG(LogJson, Error, TEXT("Json String '%s' is not of expected length %d when deserializing FOculusXRUUID"), *Hex, OCULUSXR_UUID_SIZE * 2);
 		UUID = FOculusXRUUID();
+		return false;
 	}
+} // namespace
+
+void MRUKDeserialize(const FJsonValue& Value, FOculusXRUUID& UUID)
+{
+	HexToUUID(Value.AsString(), UUID);
 }
 
 TSharedPtr<FJsonValue> MRUKSerialize(const double& Number)
@@ -59,3 +65,141 @@ void MRUKDeserialize(const FJsonValue& Value, FOculusXRRoomLayout& RoomLayout)
 	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("CeilingUuid")), RoomLayout.CeilingUuid);
 	MRUKDeserialize(*Object->GetField<EJson::None>(TEXT("WallsUuid")), RoomLayout.WallsUuid);
 }
+
+bool MRUKSkipJsonValue(TJsonReader<>& Reader, EJsonNotation Notation)
+{
+	switch (Notation)
+	{
+		case EJsonNotation::ObjectStart:
+		case EJsonNotation::ArrayStart:
+			break;
+		case EJsonNotation::ObjectEnd:
+		case EJsonNotation::ArrayEnd:
+		case EJsonNotation::Error:
+			return false;
+		default:
+			return true;
+	}
+
+	int32 Depth = 1;
+	while (Depth > 0 && Reader.ReadNext(Notation))
+	{
+		switch (Notation)
+		{
+			case EJsonNotation::ObjectStart:
+			case EJsonNotation::ArrayStart:
+				++Depth;
+				break;
+			case EJsonNotation::ObjectEnd:
+			case EJsonNotation::ArrayEnd:
+				--Depth;
+				break;
+			case EJsonNotation::Error:
+				return false;
+			default:
+				break;
+		}
+	}
+	return Depth == 0;
+}
+
+bool MRUKReadJsonObject(TJsonReader<>& Reader, EJsonNotation Notation, TFunctionRef<bool(const FString& Identifier, EJsonNotation Notation)> ReadField)
+{
+	if (Notation != EJsonNotation::ObjectStart)
+	{
+		return false;
+	}
+	while (Reader.ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ObjectEnd)
+		{
+			return true;
+		}
+		if (Notation == EJsonNotation::Error || !ReadField(Reader.GetIdentifier(), Notation))
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+bool MRUKReadJsonArray(TJsonReader<>& Reader, EJsonNotation Notation, TFunctionRef<bool(EJsonNotation Notation)> ReadItem)
+{
+	if (Notation != EJsonNotation::ArrayStart)
+	{
+		return false;
+	}
+	while (Reader.ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			return true;
+		}
+		if (Notation == EJsonNotation::Error || !ReadItem(Notation))
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+bool MRUKReadJsonNumbers(TJsonReader<>& Reader, EJsonNotation Notation, double* OutNumbers, int32 NumNumbers)
+{
+	if (Notation != EJsonNotation::ArrayStart)
+	{
+		return false;
+	}
+	for (int32 i = 0; i < NumNumbers; ++i)
+	{
+		if (!Reader.ReadNext(Notation) || Notation != EJsonNotation::Number)
+		{
+			return false;
+		}
+		OutNumbers[i] = Reader.GetValueAsNumber();
+	}
+	return Reader.ReadNext(Notation) && Notation == EJsonNotation::ArrayEnd;
+}
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FString& String)
+{
+	if (Notation != EJsonNotation::String)
+	{
+		return false;
+	}
+	String = Reader.GetValueAsString();
+	return true;
+}
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FOculusXRUUID& UUID)
+{
+	return Notation == EJsonNotation::String && HexToUUID(Reader.GetValueAsString(), UUID);
+}
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, double& Number)
+{
+	if (Notation != EJsonNotation::Number)
+	{
+		return false;
+	}
+	Number = Reader.GetValueAsNumber();
+	return true;
+}
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FOculusXRRoomLayout& RoomLayout)
+{
+	return MRUKReadJsonObject(Reader, Notation, [&Reader, &RoomLayout](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("FloorUuid"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, RoomLayout.FloorUuid);
+		}
+		if (Identifier == TEXT("CeilingUuid"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, RoomLayout.CeilingUuid);
+		}
+		if (Identifier == TEXT("WallsUuid"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, RoomLayout.WallsUuid);
+		}
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+}
@@ -12,6 +12,9 @@
 #include "OculusXRSceneEventDelegates.h"
 #include "OculusXRSceneFunctionLibrary.h"
 #include "Engine/Engine.h"
+#include "Misc/SecureHash.h"
+#include "Misc/FileHelper.h"
+#include "MRUtilityKitBinarySerialization.h"
 #include "Generated/MRUtilityKitShared.h"
 
 AMRUKAnchor* UMRUKSubsystem::Raycast(const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, FMRUKHit& OutHit)
@@ -52,6 +55,38 @@ bool UMRUKSubsystem::RaycastAll(const FVector& Origin, const FVector& Direction,
 	return HitAnything;
 }
 
+bool UMRUKSubsystem::RaycastBatch(const TArray<FVector>& Origins, const TArray<FVector>& Directions, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors)
+{
+	OutHits.SetNum(Origins.Num());
+	OutAnchors.Init(nullptr, Origins.Num());
+
+	bool HitAnything = false;
+	TArray<FMRUKHit> RoomHits;
+	TArray<AMRUKAnchor*> RoomAnchors;
+	for (const auto& Room : Rooms)
+	{
+		if (!Room)
+		{
+			continue;
+		}
+		if (!Room->RaycastBatch(Origins, Directions, MaxDist, LabelFilter, RoomHits, RoomAnchors))
+		{
+			continue;
+		}
+		HitAnything = true;
+		for (int32 Index = 0; Index < RoomAnchors.Num(); ++Index)
+		{
+			// Keep the closest hit across all rooms
+			if (RoomAnchors[Index] && (!OutAnchors[Index] || RoomHits[Index].HitDistance < OutHits[Index].HitDistance))
+			{
+				OutHits[Index] = RoomHits[Index];
+				OutAnchors[Index] = RoomAnchors[Index];
+			}
+		}
+	}
+	return HitAnything;
+}
+
 void UMRUKSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	const UMRUKSettings* Settings = GetMutableDefault<UMRUKSettings>();
@@ -62,6 +97,8 @@ void UMRUKSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UMRUKSubsystem::Deinitialize()
 {
+	// The components of pending meshes are going away with the world
+	ProceduralMeshQueue.CancelAll();
 	MRUKShared::FreeMRUKSharedLibrary();
 }
 
@@ -143,12 +180,12 @@ FString UMRUKSubsystem::SaveSceneToJsonString()
 	return Json;
 }
 
-void UMRUKSubsystem::LoadSceneFromJsonString(const FString& String)
+bool UMRUKSubsystem::BeginLoadSceneData(const TCHAR* Source)
 {
 	if (SceneData || SceneLoadStatus == EMRUKInitStatus::Busy)
 	{
-		UE_LOG(LogMRUK, Error, TEXT("Can't start loading a scene from JSON while the scene is already loading"));
-		return;
+		UE_LOG(LogMRUK, Error, TEXT("Can't start loading a scene from %s while the scene is already loading"), Source);
+		return false;
 	}
 
 	SceneData = NewObject<UMRUKSceneData>(this);
@@ -156,16 +193,92 @@ void UMRUKSubsystem::LoadSceneFromJsonString(const FString& String)
 	if (SceneLoadStatus == EMRUKInitStatus::Complete)
 	{
 		// Update the scene
-		UE_LOG(LogMRUK, Log, TEXT("Update scene from JSON"));
+		UE_LOG(LogMRUK, Log, TEXT("Update scene from %s"), Source);
 		SceneData->OnComplete.AddDynamic(this, &UMRUKSubsystem::UpdatedSceneDataLoadedComplete);
 	}
 	else
 	{
-		UE_LOG(LogMRUK, Log, TEXT("Load scene from JSON"));
+		UE_LOG(LogMRUK, Log, TEXT("Load scene from %s"), Source);
 		SceneData->OnComplete.AddDynamic(this, &UMRUKSubsystem::SceneDataLoadedComplete);
 	}
 	SceneLoadStatus = EMRUKInitStatus::Busy;
+	return true;
+}
+
+void UMRUKSubsystem::LoadSceneFromJsonString(const FString& String)
+{
+	TryLoadSceneFromJsonString(String);
+}
+
+bool UMRUKSubsystem::TryLoadSceneFromJsonString(const FString& String)
+{
+	if (!BeginLoadSceneData(TEXT("JSON")))
+	{
+		return false;
+	}
 	SceneData->LoadFromJson(String);
+	return true;
+}
+
+TArray<uint8> UMRUKSubsystem::SaveSceneToBinary()
+{
+	TArray<uint8> Blobs;
+	TArray<MRUKBinary::FRoomRecord> RoomRecords;
+	RoomRecords.Reserve(Rooms.Num());
+	for (const auto& Room : Rooms)
+	{
+		if (Room)
+		{
+			RoomRecords.Add(Room->BinarySerialize(Blobs));
+		}
+	}
+	return MRUKBinary::WriteScene(RoomRecords, Blobs);
+}
+
+bool UMRUKSubsystem::SaveSceneToBinaryFile(const FString& FilePath)
+{
+	if (!FFileHelper::SaveArrayToFile(SaveSceneToBinary(), *FilePath))
+	{
+		UE_LOG(LogMRUK, Error, TEXT("Could not write scene to %s"), *FilePath);
+		return false;
+	}
+	return true;
+}
+
+void UMRUKSubsystem::LoadSceneFromBinary(const TArray<uint8>& Data)
+{
+	LoadSceneFromBinaryView(Data);
+}
+
+bool UMRUKSubsystem::LoadSceneFromBinaryFile(const FString& FilePath)
+{
+	MRUKBinary::FMappedFile File;
+	if (!File.Open(FilePath))
+	{
+		return false;
+	}
+
+	const TConstArrayView<uint8> Data = File.GetData();
+	if (!MRUKBinary::IsBinaryScene(Data))
+	{
+		UE_LOG(LogMRUK, Log, TEXT("%s is not a binary scene file, trying to load it as JSON"), *FilePath);
+		FString JsonString;
+		FFileHelper::BufferToString(JsonString, Data.GetData(), Data.Num());
+		return TryLoadSceneFromJsonString(JsonString);
+	}
+
+	// The scene data copies everything it needs, so the file can be unmapped once this returns
+	return LoadSceneFromBinaryView(Data);
+}
+
+bool UMRUKSubsystem::LoadSceneFromBinaryView(TConstArrayView<uint8> Data)
+{
+	if (!BeginLoadSceneData(TEXT("binary")))
+	{
+		return false;
+	}
+	SceneData->LoadFromBinary(Data);
+	return true;
 }
 
 void UMRUKSubsystem::LoadSceneFromDevice()
@@ -479,6 +592,72 @@ FBox UMRUKSubsystem::GetActorClassBounds(TSubclassOf<AActor> Actor)
 	return Bounds;
 }
 
+TSharedPtr<const FMRUKRoomDistanceField> UMRUKSubsystem::GetOrBakeRoomDistanceField(AMRUKRoom* Room, double VoxelSize)
+{
+	// The distance field is baked in the space of the room, so the key only covers what the bake reads
+	// from the anchors. Their transforms relative to the room are stored as they are, so moving the
+	// room doesn't change the key. The global mesh isn't part of the field and isn't hashed either.
+	FSHA1 HashState;
+	const auto HashBytes = [&HashState](const void* Data, uint64 Size) { HashState.Update(static_cast<const uint8*>(Data), Size); };
+	const auto HashTransform = [&HashBytes](const FTransform& Transform) {
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Translation = Transform.GetTranslation();
+		const FVector Scale = Transform.GetScale3D();
+		HashBytes(&Rotation, sizeof(Rotation));
+		HashBytes(&Translation, sizeof(Translation));
+		HashBytes(&Scale, sizeof(Scale));
+	};
+
+	HashBytes(&VoxelSize, sizeof(VoxelSize));
+	// Anchors are placed relative to the room, a scaled room scales their positions in room space
+	const FVector RoomScale = Room->GetActorScale3D();
+	HashBytes(&RoomScale, sizeof(RoomScale));
+	for (const auto& Anchor : Room->AllAnchors)
+	{
+		if (!Anchor)
+		{
+			continue;
+		}
+		HashBytes(Anchor->AnchorUUID.UUIDBytes, sizeof(Anchor->AnchorUUID.UUIDBytes));
+		HashTransform(Anchor->GetRootComponent()->GetRelativeTransform());
+		for (const FString& Label : Anchor->SemanticClassifications)
+		{
+			HashBytes(*Label, (Label.Len() + 1) * sizeof(TCHAR));
+		}
+		// The bounds are hashed member by member, their padding bytes are undefined
+		const FBox2D& PlaneBounds = Anchor->PlaneBounds;
+		const bool bPlaneBoundsValid = PlaneBounds.bIsValid;
+		HashBytes(&PlaneBounds.Min, sizeof(PlaneBounds.Min));
+		HashBytes(&PlaneBounds.Max, sizeof(PlaneBounds.Max));
+		HashBytes(&bPlaneBoundsValid, sizeof(bPlaneBoundsValid));
+		HashBytes(Anchor->PlaneBoundary2D.GetData(), Anchor->PlaneBoundary2D.Num() * sizeof(FVector2D));
+		const FBox& VolumeBounds = Anchor->VolumeBounds;
+		const bool bVolumeBoundsValid = !!VolumeBounds.IsValid;
+		HashBytes(&VolumeBounds.Min, sizeof(VolumeBounds.Min));
+		HashBytes(&VolumeBounds.Max, sizeof(VolumeBounds.Max));
+		HashBytes(&bVolumeBoundsValid, sizeof(bVolumeBoundsValid));
+	}
+
+	FSHAHash Hash;
+	HashState.Final();
+	HashState.GetHash(Hash.Hash);
+	const FString CacheKey = Hash.ToString();
+
+	if (const auto Entry = RoomDistanceFieldCache.FindAndTouch(CacheKey))
+	{
+		return *Entry;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TSharedRef<FMRUKRoomDistanceField> DistanceField = MakeShared<FMRUKRoomDistanceField>();
+	DistanceField->Bake(*Room, VoxelSize);
+	UE_LOG(LogMRUK, Log, TEXT("Baked distance field %s for room '%s' in %.2f ms (%llu bytes)"), *DistanceField->GetResolution().ToString(), *Room->AnchorUUID.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0, static_cast<uint64>(DistanceField->GetAllocatedSize()));
+
+	// When the cache is full this evicts the distance field that was used the longest time ago
+	RoomDistanceFieldCache.Add(CacheKey, DistanceField);
+	return DistanceField;
+}
+
 void UMRUKSubsystem::SceneCaptureComplete(FOculusXRUInt64 RequestId, bool bSuccess)
 {
 	UE_LOG(LogMRUK, Log, TEXT("Scene capture complete Success==%d"), bSuccess);
@@ -539,6 +718,11 @@ void UMRUKSubsystem::FinishedLoading(bool Success)
 
 void UMRUKSubsystem::Tick(float DeltaTime)
 {
+	if (!ProceduralMeshQueue.IsEmpty())
+	{
+		ProceduralMeshQueue.Commit(GetDefault<UMRUKSettings>()->ProceduralMeshFrameBudget / 1000.0);
+	}
+
 	if (EnableWorldLock)
 	{
 		if (const auto Room = GetCurrentRoom())
@@ -566,6 +750,6 @@ void UMRUKSubsystem::Tick(float DeltaTime)
 
 bool UMRUKSubsystem::IsTickable() const
 {
-	return !HasAnyFlags(RF_BeginDestroyed) && IsValidChecked(this) && (EnableWorldLock);
+	return !HasAnyFlags(RF_BeginDestroyed) && IsValidChecked(this) && (EnableWorldLock || !ProceduralMeshQueue.IsEmpty());
 }
 
@@ -4,10 +4,12 @@
 
 #include "Modules/ModuleManager.h"
 #include "GameFramework/Actor.h"
+#include "Stats/Stats.h"
 
 #include "MRUtilityKit.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogMRUK, Log, All);
+DECLARE_STATS_GROUP(TEXT("MRUtilityKit"), STATGROUP_MRUK, STATCAT_Advanced);
 
 UENUM(BlueprintType)
 enum class EMRUKInitStatus : uint8
@@ -355,6 +357,37 @@ public:
 	 */
 	UPROPERTY(config, EditAnywhere, Category = "MR Utility Kit")
 	bool EnableWorldLock = true;
+
+	/**
+	 * When enabled a distance field of the anchors is baked for every room when it gets loaded or updated.
+	 * It speeds up closest surface and scene volume queries considerably, for example when generating random
+	 * positions in the room, at the cost of some memory and a longer load time.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "MR Utility Kit|Distance Field")
+	bool EnableRoomDistanceField = false;
+
+	/**
+	 * The size of a voxel of the room distance field in centimeters. Smaller values make the distance
+	 * field more precise but increase the memory usage and the time it takes to bake it.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "MR Utility Kit|Distance Field", meta = (ClampMin = "1.0", UIMin = "1.0", EditCondition = "EnableRoomDistanceField"))
+	float RoomDistanceFieldVoxelSize = 10.0f;
+
+	/**
+	 * When enabled the geometry of procedural anchor meshes, e.g. the ones created by AMRUKAnchorActorSpawner,
+	 * is generated on background tasks. Only the mesh sections are created on the game thread, spread over
+	 * multiple frames. This avoids a hitch when a room with many anchors gets loaded, but the meshes appear
+	 * a few frames later.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "MR Utility Kit|Procedural Mesh")
+	bool EnableAsyncProceduralMeshGeneration = false;
+
+	/**
+	 * How much time in milliseconds may be spent per frame on creating the sections of procedural meshes that
+	 * have been generated in the background. At least one mesh is created every frame.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "MR Utility Kit|Procedural Mesh", meta = (ClampMin = "0.0", UIMin = "0.0", EditCondition = "EnableAsyncProceduralMeshGeneration"))
+	float ProceduralMeshFrameBudget = 2.0f;
 };
 
 /**
@@ -400,6 +433,31 @@ enum class EMRUKSpawnMode : uint8
 	AllRooms
 };
 
+/**
+ * Describes how an anchor changed when the room got updated.
+ */
+UENUM(BlueprintType)
+enum class EMRUKAnchorChange : uint8
+{
+	/**
+	 * The anchor was added to the room.
+	 */
+	Created,
+	/**
+	 * The anchor is about to be removed from the room. It is still valid while the event is broadcast.
+	 */
+	Removed,
+	/**
+	 * The labels, plane or volume of the anchor changed. The pose may have changed as well.
+	 */
+	Geometry,
+	/**
+	 * Only the pose of the anchor changed, e.g. after the headset re-localized. Actors attached to
+	 * the anchor follow it automatically and don't need to be rebuilt.
+	 */
+	Pose,
+};
+
 /**
  * UE Module interface impelmentation
  */
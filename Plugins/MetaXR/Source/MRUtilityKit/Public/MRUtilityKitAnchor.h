@@ -4,7 +4,11 @@
 
 #include "GameFramework/Actor.h"
 #include "Dom/JsonObject.h"
+#include "MRUtilityKitBinarySerialization.h"
 #include "MRUtilityKitAnchorActorSpawner.h"
+#include "MRUtilityKitPolygonGrid.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
 
 #include "OculusXRAnchorTypes.h"
 #include "ProceduralMeshComponent.h"
@@ -12,6 +16,7 @@
 
 class AMRUKRoom;
 class UMRUKAnchorData;
+struct FMRUKProceduralMeshInput;
 
 /**
  * Represents an anchor in the Mixed Reality Utility Kit. This combines an Unreal actor with the scene anchor.
@@ -100,6 +105,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	bool IsPositionInBoundary(const FVector2D& Position);
 
+	/**
+	 * Check if multiple 2D positions are within the boundary of the plane. This is faster than calling
+	 * IsPositionInBoundary() for every position. The positions should be in the local coordinate system
+	 * NOT world coordinates.
+	 * @param Positions     The positions to check.
+	 * @param OutInBoundary Whether each position is within the boundary, in the same order as Positions.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	void IsPositionInBoundaryBatch(const TArray<FVector2D>& Positions, TArray<bool>& OutInBoundary);
+
 	/**
 	 * Generate a uniform random position within the boundary of the plane.
 	 * @return The random position in local coordinate space.
@@ -170,6 +185,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "PlaneUVAdjustments"))
 	void GenerateProceduralAnchorMesh(UProceduralMeshComponent* ProceduralMesh, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume = false, bool GenerateCollision = true, double Offset = 0.0);
 
+	/**
+	 * Same as GenerateProceduralAnchorMesh() but the geometry, including the triangulation of the plane, is generated
+	 * on a background task. Only the mesh sections are created on the game thread. This is spread over multiple frames
+	 * according to UMRUKSettings::ProceduralMeshFrameBudget to avoid hitches when many meshes get generated at once.
+	 * @param ProceduralMesh     The procedural mesh component that should be used to store the generated mesh.
+	 * @param PlaneUVAdjustments Scale and offset to apply to the UV texture coordinates.
+	 * @param CutHoleLabels		 Labels for which the generated mesh should have holes. Only works with planes.
+	 * @param GenerateCollision  Whether to generate collision geometry or not
+	 * @param Offset             A offset to make the procedural mesh slightly bigger or smaller than the anchors volume/plane.
+	 * @param Material           Material that gets applied to all sections of the mesh once it has been created.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "PlaneUVAdjustments"))
+	void GenerateProceduralAnchorMeshAsync(UProceduralMeshComponent* ProceduralMesh, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume = false, bool GenerateCollision = true, double Offset = 0.0, UMaterialInterface* Material = nullptr);
+
 	/**
 	 * Check if the anchor has the given label.
 	 * @param Label The label to check.
@@ -241,8 +270,8 @@ public:
 	 * Load the anchor from a MRUKAnchorData. This is used to load or update the anchor from device or from a JSON file.
 	 *
 	 * @param AnchorData The data to load from.
-	 * @return true if the anchor was loaded successfully.
-	 * @return false if the anchor could not be loaded.
+	 * @return true if the labels, plane or volume of the anchor changed.
+	 * @return false if at most the pose of the anchor changed.
 	 */
 	bool LoadFromData(UMRUKAnchorData* AnchorData);
 
@@ -257,12 +286,20 @@ public:
 
 	TSharedRef<FJsonObject> JsonSerialize();
 
+	/**
+	 * Serialize the anchor into the binary scene format.
+	 * @param OutBlobs The blob section to which the global mesh data gets appended.
+	 */
+	MRUKBinary::FAnchorRecord BinarySerialize(TArray<uint8>& OutBlobs);
+
 protected:
 	void EndPlay(EEndPlayReason::Type Reason) override;
 
 private:
+	FMRUKProceduralMeshInput CreateProceduralMeshInput(const TArray<FMRUKPlaneUV>& PlaneUVAdjustments, const TArray<FString>& CutHoleLabels, bool PreferVolume, double Offset) const;
 	bool RayCastPlane(const FRay& LocalRay, float MaxDist, FMRUKHit& OutHit);
 	bool RayCastVolume(const FRay& LocalRay, float MaxDist, FMRUKHit& OutHit);
+	const FMRUKPolygonGrid& GetBoundaryGrid();
 
 	struct TriangulatedMeshCache
 	{
@@ -278,4 +315,10 @@ private:
 	AActor* Interior = nullptr;
 
 	TOptional<TriangulatedMeshCache> CachedMesh;
+
+	// Built on first use since most anchors never get queried. Queries may come from multiple threads
+	// at once (e.g. AMRUKRoom::RaycastBatch), so building the grid is guarded by a lock.
+	FMRUKPolygonGrid BoundaryGrid;
+	std::atomic<bool> BoundaryGridBuilt = false;
+	FCriticalSection BoundaryGridLock;
 };
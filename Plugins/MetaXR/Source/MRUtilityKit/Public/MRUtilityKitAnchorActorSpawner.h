@@ -311,12 +311,24 @@ protected:
 	UFUNCTION()
 	void OnRoomRemoved(AMRUKRoom* Room);
 
+	UFUNCTION()
+	void OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change);
+
 	UFUNCTION()
 	void RemoveActors(AMRUKRoom* Room);
 
 private:
+	bool CanUpdateAnchorIncrementally(const AMRUKAnchor* Anchor) const;
+	void SpawnLabelActorsForAnchor(AMRUKAnchor* Anchor, const FRandomStream& RandomStream, TArray<AActor*>& OutActors);
+
 	// Room UUID to spawned actors in this room
 	TMap<AMRUKRoom*, TArray<AActor*>> SpawnedActors;
 
+	// Rooms with anchor changes that could not be applied incrementally. They get respawned on the next room update.
+	TSet<AMRUKRoom*> RoomsToRespawn;
+
+	// Rooms in which the actors of single anchors have been replaced since the last room update
+	TSet<AMRUKRoom*> RoomsPatched;
+
 	int32 LastSeed = -1;
 };
@@ -77,6 +77,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	static bool LoadGlobalMeshFromJsonString(const FString& JsonString, FOculusXRUUID AnchorUUID, UProceduralMeshComponent* OutProceduralMesh, bool LoadCollision);
 
+	/**
+	 * Load the global mesh from a binary scene file. Falls back to JSON if the file is not in the binary format.
+	 * @param FilePath          The path to the file written with UMRUKSubsystem::SaveSceneToBinaryFile().
+	 * @param AnchorUUID        Anchor UUID of the room
+	 * @param OutProceduralMesh Procedural mesh to load the triangle data in.
+	 * @param LoadCollision     Whether to generate collision or not
+	 * @return                  Whether the load was successful or not.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	static bool LoadGlobalMeshFromBinaryFile(const FString& FilePath, FOculusXRUUID AnchorUUID, UProceduralMeshComponent* OutProceduralMesh, bool LoadCollision);
+
 	/**
 	 * (Re)Calculate Normals and Tangents of the given procedural mesh.
 	 * @param Mesh The procedural mesh.
@@ -0,0 +1,88 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "Math/Box.h"
+#include "Math/Vector.h"
+
+class AMRUKAnchor;
+
+/**
+ * Bounding volume hierarchy over the plane and volume bounds of the anchors in a room.
+ *
+ * The tree is a dynamic AABB tree: anchors can be inserted, refitted and removed individually
+ * without rebuilding the whole hierarchy. Bounds are expected to be in the space of the owning
+ * room, the tree itself doesn't know anything about transforms.
+ *
+ * Anchors without valid bounds (e.g. the global mesh anchor) can still be added. They are kept
+ * in a separate list and will be returned by every query since they can't be culled.
+ */
+class MRUTILITYKIT_API FMRUKAnchorBVH
+{
+public:
+	using FCandidateArray = TArray<AMRUKAnchor*, TInlineAllocator<32>>;
+
+	/**
+	 * Remove all anchors from the tree.
+	 */
+	void Reset();
+
+	/**
+	 * Insert an anchor into the tree or update it if it has been inserted before. If the bounds
+	 * did not change the tree is left untouched.
+	 * @param Anchor  The anchor to insert or update.
+	 * @param Bounds  The bounds of the anchor. If invalid the anchor will never be culled by queries.
+	 * @param SortKey Key used to order the candidates returned by queries. Usually the index of the anchor in the room.
+	 */
+	void InsertOrUpdate(AMRUKAnchor* Anchor, const FBox& Bounds, int32 SortKey);
+
+	/**
+	 * Remove an anchor from the tree. Does nothing if the anchor is not part of the tree.
+	 */
+	void Remove(AMRUKAnchor* Anchor);
+
+	/**
+	 * Collect all anchors whose bounds are intersected by the ray.
+	 * @param Origin        The origin of the ray.
+	 * @param Direction     The direction of the ray. Doesn't need to be normalized.
+	 * @param MaxDist       The maximum distance the ray should travel. Everything below or equal to zero will be treated as infinity.
+	 * @param OutCandidates The anchors that may be hit by the ray, ordered by their sort key.
+	 */
+	void QueryRay(const FVector& Origin, const FVector& Direction, float MaxDist, FCandidateArray& OutCandidates) const;
+
+	/**
+	 * The number of anchors in the tree, including anchors without bounds.
+	 */
+	int32 Num() const { return AnchorToNode.Num() + UnboundedAnchors.Num(); }
+
+	/**
+	 * The combined bounds of all anchors in the tree.
+	 */
+	FBox GetBounds() const;
+
+private:
+	struct FNode
+	{
+		FBox Bounds{ ForceInit };
+		int32 Parent = INDEX_NONE;
+		int32 Children[2] = { INDEX_NONE, INDEX_NONE };
+		AMRUKAnchor* Anchor = nullptr;
+		int32 SortKey = 0;
+
+		bool IsLeaf() const { return Children[0] == INDEX_NONE; }
+	};
+
+	int32 AllocateNode();
+	void FreeNode(int32 Index);
+	void InsertLeaf(int32 Leaf);
+	void RemoveLeaf(int32 Leaf);
+	void Refit(int32 Index);
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+	int32 Root = INDEX_NONE;
+	TMap<AMRUKAnchor*, int32> AnchorToNode;
+	TMap<AMRUKAnchor*, int32> UnboundedAnchors;
+};
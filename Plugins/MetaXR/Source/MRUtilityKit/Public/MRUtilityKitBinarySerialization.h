@@ -0,0 +1,111 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Async/MappedFileHandle.h"
+#include "OculusXRAnchorTypes.h"
+
+/**
+ * Binary representation of the scene. It contains the same data as the JSON representation but can be
+ * loaded a lot faster. Especially the global mesh which is stored as raw blobs of positions and indices
+ * that can be handed over to a mesh without converting every element.
+ *
+ * Layout of the data:
+ *   FHeader
+ *   FRoomRecord[NumRooms]
+ *   Padding up to BlobAlignment
+ *   Blobs (each blob aligned to BlobAlignment)
+ */
+namespace MRUKBinary
+{
+	constexpr uint32 Magic = 0x4B55524D; // "MRUK"
+	constexpr uint32 Version = 1;
+	constexpr int64 BlobAlignment = 16;
+
+	struct FHeader
+	{
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		int64 BlobsOffset = 0;
+		int32 NumRooms = 0;
+	};
+
+	/**
+	 * Location of the global mesh data in the blob section.
+	 */
+	struct FGlobalMeshBlob
+	{
+		int32 NumPositions = 0;
+		int32 NumIndices = 0;
+		int64 PositionsOffset = 0;
+		int64 IndicesOffset = 0;
+
+		bool IsValid() const { return NumPositions > 0 && NumIndices > 0; }
+	};
+
+	struct FAnchorRecord
+	{
+		FOculusXRUUID UUID;
+		TArray<FString> SemanticClassifications;
+		FTransform Transform;
+		FBox2D PlaneBounds{ ForceInit };
+		TArray<FVector2D> PlaneBoundary2D;
+		FBox VolumeBounds{ ForceInit };
+		FGlobalMeshBlob GlobalMesh;
+	};
+
+	struct FRoomRecord
+	{
+		FOculusXRUUID UUID;
+		FOculusXRRoomLayout RoomLayout;
+		TArray<FAnchorRecord> Anchors;
+	};
+
+	MRUTILITYKIT_API FArchive& operator<<(FArchive& Ar, FHeader& Header);
+	MRUTILITYKIT_API FArchive& operator<<(FArchive& Ar, FGlobalMeshBlob& Blob);
+	MRUTILITYKIT_API FArchive& operator<<(FArchive& Ar, FAnchorRecord& Record);
+	MRUTILITYKIT_API FArchive& operator<<(FArchive& Ar, FRoomRecord& Record);
+
+	/**
+	 * Append data to the blob section. The data will be aligned to BlobAlignment.
+	 * @return The offset of the data relative to the start of the blob section.
+	 */
+	MRUTILITYKIT_API int64 AppendBlob(TArray<uint8>& Blobs, const void* Data, int64 Size);
+
+	/**
+	 * Write the scene into the binary format.
+	 */
+	MRUTILITYKIT_API TArray<uint8> WriteScene(TArray<FRoomRecord>& Rooms, const TArray<uint8>& Blobs);
+
+	/**
+	 * Check if the data starts with the header of the binary format.
+	 */
+	MRUTILITYKIT_API bool IsBinaryScene(TConstArrayView<uint8> Data);
+
+	/**
+	 * Read all rooms from the binary data. The global mesh data is not copied, use GetGlobalMesh() to access it.
+	 */
+	MRUTILITYKIT_API bool ReadScene(TConstArrayView<uint8> Data, FHeader& OutHeader, TArray<FRoomRecord>& OutRooms);
+
+	/**
+	 * Get views into the positions and indices of a global mesh. The views point directly into Data.
+	 */
+	MRUTILITYKIT_API bool GetGlobalMesh(TConstArrayView<uint8> Data, const FHeader& Header, const FGlobalMeshBlob& Blob, TConstArrayView<FVector>& OutPositions, TConstArrayView<int32>& OutIndices);
+
+	/**
+	 * Read only view of a file. The file is memory mapped if the platform supports it, otherwise it gets read into memory.
+	 */
+	class MRUTILITYKIT_API FMappedFile
+	{
+	public:
+		bool Open(const FString& FilePath);
+		TConstArrayView<uint8> GetData() const { return Data; }
+
+	private:
+		TUniquePtr<IMappedFileHandle> MappedHandle;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TArray<uint8> FallbackData;
+		TConstArrayView<uint8> Data;
+	};
+} // namespace MRUKBinary
@@ -4,8 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "Components/StaticMeshComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
 #include "MRUtilityKitBlobShadowComponent.generated.h"
 
+UENUM(BlueprintType)
+enum class EMRUKBlobShadowUpdateMode : uint8
+{
+	/// Recompute size and position and trace to the ground every frame.
+	EveryFrame,
+	/// Only recompute size and position and trace to the ground when the owner moved, its bounds changed or a property changed.
+	OnChange,
+	/// Like OnChange, but the ground traces of all blob shadows are batched by the UMRUKBlobShadowSubsystem into
+	/// asynchronous traces. The result of a trace is applied one frame later. The component itself doesn't tick.
+	Batched,
+};
+
 /**
  * Adds a blob shadow below the actor.
  * The blob shadow will position and resize itself automatically during runtime.
@@ -52,6 +66,14 @@ public:
 	UPROPERTY(Category = "MR Utility Kit", EditAnywhere, BlueprintReadWrite)
 	float FadeDistance = 20.f;
 
+	/**
+	 * How often the blob shadow gets updated. Use SetUpdateMode() to change it during runtime.
+	 * Changes of the ground below the blob shadow are not detected in OnChange and Batched mode. Call MarkDirty() in
+	 * that case.
+	 */
+	UPROPERTY(Category = "MR Utility Kit", EditAnywhere, BlueprintReadOnly)
+	EMRUKBlobShadowUpdateMode UpdateMode = EMRUKBlobShadowUpdateMode::EveryFrame;
+
 	/**
 	 * Only callable in the editor from the scene, will update the blob shadow size, position and material parameters
 	 * to give a preview how the blob shadow would look like.
@@ -59,14 +81,84 @@ public:
 	UFUNCTION(Category = "MR Utility Kit", CallInEditor)
 	void UpdatePlaneSizeAndPosition();
 
+	/**
+	 * Change how often the blob shadow gets updated.
+	 * @param NewUpdateMode The new update mode.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	void SetUpdateMode(EMRUKBlobShadowUpdateMode NewUpdateMode);
+
+	/**
+	 * Force an update of the blob shadow in the next frame, even if nothing changed.
+	 * Only needed if UpdateMode is not EveryFrame.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	void MarkDirty();
+
 public:
 	UMRUKBlobShadowComponent();
 
 	void BeginPlay() override;
+	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	void ComputeOwner2DBounds(FVector& Origin, FVector2D& Extent, double& Yaw) const;
 
 protected:
 	UPROPERTY()
 	UMaterialInstanceDynamic* DynMaterial;
+
+private:
+	friend class UMRUKBlobShadowSubsystem;
+
+	// Everything that influences the look of the blob shadow, except for the ground
+	struct FUpdateState
+	{
+		FTransform OwnerTransform;
+		FBox OwnerBounds{ ForceInit };
+		float Roundness = 0.0f;
+		float Gradient = 0.0f;
+		float GradientPower = 0.0f;
+		float ExtraExtent = 0.0f;
+		float MaxVerticalDistance = 0.0f;
+		float FadeDistance = 0.0f;
+	};
+
+	FUpdateState LastUpdateState;
+	bool Dirty = true;
+
+	// Extent of the plane in the last update, used for the material parameters
+	FVector2D PlaneExtent = FVector2D::ZeroVector;
+
+	FTraceHandle PendingGroundTrace;
+	FTraceDelegate GroundTraceDelegate;
+
+	/**
+	 * Check if anything changed since the last update and remember the current state.
+	 * @return Whether the blob shadow needs to be updated.
+	 */
+	bool ConsumeDirty();
+
+	void UpdatePlaneSize(FVector& OutTraceStart, FVector& OutTraceEnd, float& OutTraceRadius);
+	void UpdatePlanePosition(bool bHasHit, const FHitResult& Hit);
+	void OnGroundTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
+
+/**
+ * Updates all blob shadows in UpdateMode Batched. Once per frame the blob shadows whose owner changed get resized
+ * and their ground traces are issued as asynchronous traces, which run in parallel to the rest of the frame.
+ */
+UCLASS()
+class MRUTILITYKIT_API UMRUKBlobShadowSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void Register(UMRUKBlobShadowComponent* BlobShadow);
+	void Unregister(UMRUKBlobShadowComponent* BlobShadow);
+
+	void Tick(float DeltaTime) override;
+	TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UMRUKBlobShadowSubsystem, STATGROUP_Tickables); }
+
+private:
+	TArray<TWeakObjectPtr<UMRUKBlobShadowComponent>> BlobShadows;
 };
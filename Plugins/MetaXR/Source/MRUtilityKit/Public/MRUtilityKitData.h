@@ -4,7 +4,8 @@
 
 #include "GameFramework/Actor.h"
 #include "OculusXRRoomLayoutManagerComponent.h"
-#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+#include "MRUtilityKitBinarySerialization.h"
 #include "MRUtilityKitData.generated.h"
 
 /**
@@ -58,7 +59,12 @@ public:
 	bool NeedAnchorLocalization = false;
 
 	void LoadFromDevice(const FOculusXRAnchorsDiscoverResult& AnchorsDiscoverResult);
-	void LoadFromJson(const FJsonValue& Value);
+	/**
+	 * Read the anchor object that starts with Notation directly from the JSON stream.
+	 * @return false if the JSON has an unexpected layout.
+	 */
+	bool LoadFromJson(TJsonReader<>& Reader, EJsonNotation Notation);
+	void LoadFromBinary(const MRUKBinary::FAnchorRecord& Record);
 };
 
 /**
@@ -89,7 +95,13 @@ public:
 	AMRUKLocalizer* LocalizationActor = nullptr;
 
 	void LoadFromDevice(const FOculusXRAnchorsDiscoverResult& AnchorsDiscoverResult);
-	void LoadFromJson(const FJsonValue& Value);
+	/**
+	 * Read the room object that starts with Notation directly from the JSON stream.
+	 * OnComplete gets fired once the room has been read.
+	 * @return false if the JSON has an unexpected layout.
+	 */
+	bool LoadFromJson(TJsonReader<>& Reader, EJsonNotation Notation);
+	void LoadFromBinary(const MRUKBinary::FRoomRecord& Record);
 
 private:
 	void FinishQuery(bool Success);
@@ -122,6 +134,7 @@ public:
 
 	void LoadFromDevice();
 	void LoadFromJson(const FString& Json);
+	void LoadFromBinary(TConstArrayView<uint8> Data);
 
 private:
 	int32 NumRoomsLeftToInitialize = 0;
@@ -0,0 +1,60 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Math/Vector2D.h"
+
+/**
+ * CPU side 2D distance map of free and occupied space.
+ *
+ * Footprints are rasterized into a square mask which is then turned into an exact euclidean distance
+ * transform. The transform is separable: a vertical pass that works on four columns at a time with SIMD,
+ * followed by a lower envelope pass on every row. Both passes run on worker threads.
+ *
+ * The resulting distances are signed. They are positive in free space and measure the distance to the
+ * closest occupied pixel, and negative in occupied space where they measure the distance to the closest
+ * free pixel. All distances are in the same unit as the pixel size.
+ */
+class MRUTILITYKIT_API FMRUKDistanceMap
+{
+public:
+	/**
+	 * Discard any previous data and start a new mask in which every pixel is occupied.
+	 * @param Resolution The number of pixels along each axis. Gets rounded up to a multiple of four.
+	 * @param Size       The size of the square area that is covered by the map.
+	 */
+	void Init(int32 Resolution, double Size);
+
+	/**
+	 * Rasterize a polygon into the mask. Pixels are covered if their center is inside the polygon.
+	 * @param Polygon The vertices of the polygon in pixel coordinates. The last vertex is implicitly connected to the first one.
+	 * @param Free    Whether the covered pixels should be marked as free or as occupied space.
+	 */
+	void FillPolygon(TConstArrayView<FVector2D> Polygon, bool Free);
+
+	/**
+	 * Compute the distances from the current mask.
+	 */
+	void Build();
+
+	/**
+	 * Bilinearly sample the distance map. Positions outside of the map are clamped to the border.
+	 * @param PixelPosition The position in pixel coordinates. Pixel centers are at half integer coordinates.
+	 * @return              The signed distance at the given position.
+	 */
+	float Sample(const FVector2D& PixelPosition) const;
+
+	bool IsValid() const { return !Distances.IsEmpty(); }
+	int32 GetResolution() const { return Resolution; }
+	double GetPixelSize() const { return PixelSize; }
+	const TArray<float>& GetDistances() const { return Distances; }
+
+private:
+	int32 Resolution = 0;
+	double PixelSize = 0.0;
+	// One entry per pixel, row after row. Non zero for free space.
+	TArray<uint8> Mask;
+	TArray<float> Distances;
+};
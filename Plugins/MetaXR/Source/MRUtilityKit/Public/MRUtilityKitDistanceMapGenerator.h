@@ -3,6 +3,7 @@
 #pragma once
 
 #include "MRUtilityKit.h"
+#include "MRUtilityKitDistanceMap.h"
 #include "GameFramework/Actor.h"
 #include "MRUtilityKitDistanceMapGenerator.generated.h"
 
@@ -21,6 +22,16 @@ enum class EMRUKDistanceMapGenerationMode : uint8
 	AllSpace,
 };
 
+UENUM(BlueprintType)
+enum class EMRUKDistanceMapBackend : uint8
+{
+	/// Render the distance map with the jump flood algorithm on the GPU.
+	GPU,
+	/// Rasterize the anchor footprints and compute the distance map on worker threads. The distances can be
+	/// queried with SampleDistance() without any readback from the GPU.
+	CPU,
+};
+
 /**
  * Generates a distance map that can be used in materials to calculate the distance to various objects.
  * This can enable interesting effects. With the distance map you can get the distance from scene objects
@@ -29,6 +40,12 @@ enum class EMRUKDistanceMapGenerationMode : uint8
  * The Jump Flood Algorithm is used to generate the distance map. This is fast enough to regenerate
  * every tick.
  *
+ * Alternatively the distance map can be computed on the CPU by setting Backend to EMRUKDistanceMapBackend::CPU.
+ * In that case the footprints of the floor and the scene volumes, as seen from the scene capture, are rasterized
+ * into a mask and an exact euclidean distance transform runs on worker threads. The result can be sampled with
+ * SampleDistance() and is optionally uploaded to a texture. The CPU backend doesn't need a render thread and
+ * is therefore also available in headless sessions.
+ *
  * To capture a distance map after a room has been loaded call CaptureDistanceMap().
  * It will return a captured distance map. In case you already called CaptureDistanceMap()
  * you can receive the last captured distance map with GetDistanceMap(). No other setup is required.
@@ -57,6 +74,26 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MR Utility Kit")
 	EMRUKDistanceMapGenerationMode DistanceMapGenerationMode = EMRUKDistanceMapGenerationMode::FreeSpace;
 
+	/**
+	 * Whether the distance map gets rendered on the GPU or computed on the CPU.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MR Utility Kit")
+	EMRUKDistanceMapBackend Backend = EMRUKDistanceMapBackend::GPU;
+
+	/**
+	 * The number of pixels along each axis of the distance map when using the CPU backend.
+	 * The area that is covered is the same as the one of the scene capture.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MR Utility Kit", meta = (ClampMin = "4", ClampMax = "4096", EditCondition = "Backend == EMRUKDistanceMapBackend::CPU"))
+	int32 CPUResolution = 256;
+
+	/**
+	 * Whether the distance map of the CPU backend should be uploaded to a texture. The texture uses a single
+	 * 32 bit float channel that contains the distance in centimeters. Disable this if only SampleDistance() is used.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MR Utility Kit", meta = (EditCondition = "Backend == EMRUKDistanceMapBackend::CPU"))
+	bool UploadCPUDistanceMap = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MR Utility Kit")
 	class USceneComponent* Root;
 
@@ -135,6 +172,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	void RemoveMaskMeshesFromRoom(AMRUKRoom* Room);
 
+	/**
+	 * Sample the distance map that has been computed by the CPU backend.
+	 * Depending on DistanceMapGenerationMode the result is the distance to the closest occupied space (FreeSpace),
+	 * the distance to the closest free space (OccupiedSpace) or a signed distance that is positive in free space
+	 * and negative in occupied space (AllSpace and None). Positions are projected onto the view of the scene capture,
+	 * positions outside of the view are clamped to its border.
+	 * @param WorldPosition The position to sample.
+	 * @return              The distance in centimeters.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	float SampleDistance(const FVector& WorldPosition) const;
+
 	/**
 	 * Return the captured distance map. Be sure to call CaptureDistanceMap() before
 	 * @return The captured distance map.
@@ -164,6 +213,11 @@ private:
 
 	int32 DistanceMapRT = -1;
 
+	FMRUKDistanceMap CPUDistanceMap;
+
+	UPROPERTY()
+	class UTexture2D* CPUDistanceMapTexture = nullptr;
+
 	UPROPERTY()
 	class UMaterialInstanceDynamic* JFPassMaterialInstance = nullptr;
 
@@ -182,6 +236,10 @@ private:
 
 	void CaptureInitialSceneMask();
 	void RenderDistanceMap();
+	void ComputeDistanceMapOnCPU();
+	void UploadDistanceMapFromCPU();
+	float ApplyGenerationMode(float SignedDistance) const;
+	FVector2D WorldToDistanceMapPixel(const FVector& WorldPosition) const;
 
 	UFUNCTION()
 	void OnRoomCreated(AMRUKRoom* Room);
@@ -189,6 +247,9 @@ private:
 	UFUNCTION()
 	void OnRoomUpdated(AMRUKRoom* Room);
 
+	UFUNCTION()
+	void OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change);
+
 	UFUNCTION()
 	AActor* CreateMaskMeshOfAnchor(AMRUKAnchor* Anchor);
 
@@ -8,6 +8,7 @@
 #include "MRUtilityKitGuardianSpawner.generated.h"
 
 class AMRUKRoom;
+class AMRUKAnchor;
 
 /**
  * This class helps with spawning a guardian if the player gets close to any furniture or walls. This is useful if your application has a full VR mode.
@@ -104,4 +105,12 @@ private:
 
 	UFUNCTION()
 	void OnRoomRemoved(AMRUKRoom* Room);
+
+	UFUNCTION()
+	void OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change);
+
+	AMRUKGuardian* SpawnGuardian(AMRUKAnchor* Anchor, const TArray<FMRUKPlaneUV>& PlaneUVAdjustments);
+
+	// Rooms with anchor changes that could not be applied incrementally. They get respawned on the next room update.
+	TSet<AMRUKRoom*> RoomsToRespawn;
 };
@@ -0,0 +1,66 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Math/Vector2D.h"
+
+/**
+ * Acceleration structure for point in polygon tests against a closed 2D boundary.
+ *
+ * The edges of the polygon are bucketed into uniform rows along the Y axis. A query only has to
+ * look at the edges of the row the point falls into instead of all edges of the polygon. The
+ * crossing test itself is the same as in AMRUKAnchor::IsPositionInBoundary so the results are
+ * identical to a linear scan over the boundary.
+ */
+class MRUTILITYKIT_API FMRUKPolygonGrid
+{
+public:
+	/**
+	 * Build the grid from the boundary of a polygon. Any previous data is discarded.
+	 * @param Boundary The vertices of the polygon. The last vertex is implicitly connected to the first one.
+	 */
+	void Build(TConstArrayView<FVector2D> Boundary);
+
+	/**
+	 * Remove all edges from the grid. Every position will be outside afterwards.
+	 */
+	void Reset();
+
+	/**
+	 * Check if a position is inside the polygon.
+	 */
+	bool IsInside(const FVector2D& Position) const;
+
+	/**
+	 * Check multiple positions at once. Positions are sorted by row and then tested four at a time with SIMD.
+	 * @param Positions The positions to check.
+	 * @param OutInside Whether each position is inside the polygon or not, with the same order as Positions.
+	 */
+	void IsInside(TConstArrayView<FVector2D> Positions, TArray<bool>& OutInside) const;
+
+	bool IsEmpty() const { return Edges.IsEmpty(); }
+
+private:
+	struct FEdge
+	{
+		double MinY;
+		double MaxY;
+		double MaxX;
+		double X1;
+		double Y1;
+		double DX;
+		double DY;
+	};
+
+	int32 GetRow(double Y) const;
+
+	// Edges of all rows, stored contiguously row after row. Edges spanning multiple rows are duplicated.
+	TArray<FEdge> Edges;
+	// Index of the first edge of each row in Edges, with an additional entry for the end of the last row
+	TArray<int32> RowStarts;
+	double MinY = 0.0;
+	double MaxY = 0.0;
+	double InvRowHeight = 0.0;
+};
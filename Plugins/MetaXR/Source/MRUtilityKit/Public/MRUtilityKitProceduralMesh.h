@@ -0,0 +1,108 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "MRUtilityKit.h"
+#include "ProceduralMeshComponent.h"
+#include "Tasks/Task.h"
+
+/**
+ * Geometry of a single section of a procedural anchor mesh.
+ */
+struct MRUTILITYKIT_API FMRUKProceduralMeshSection
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FVector2D> UV0s;
+	TArray<FVector2D> UV1s;
+	TArray<FVector2D> UV2s;
+	TArray<FVector2D> UV3s;
+	TArray<FProcMeshTangent> Tangents;
+};
+
+/**
+ * Everything that is needed to generate the procedural mesh of an anchor. This is a copy of the
+ * anchor data so that the mesh can be generated on any thread.
+ */
+struct MRUTILITYKIT_API FMRUKProceduralMeshInput
+{
+	FBox VolumeBounds{ ForceInit };
+	FBox2D PlaneBounds{ ForceInit };
+	// The plane boundary followed by the boundaries of the holes that should be cut into the plane
+	TArray<TArray<FVector2f>> Polygons;
+	TArray<FMRUKPlaneUV> PlaneUVAdjustments;
+	bool PreferVolume = false;
+	double Offset = 0.0;
+};
+
+namespace MRUKProceduralMesh
+{
+	/**
+	 * Generate the sections of the procedural mesh. Can be called from any thread.
+	 */
+	MRUTILITYKIT_API TArray<FMRUKProceduralMeshSection> Generate(const FMRUKProceduralMeshInput& Input);
+
+	/**
+	 * Create the generated sections on the procedural mesh component. Must be called from the game thread.
+	 */
+	MRUTILITYKIT_API void Apply(UProceduralMeshComponent& ProceduralMesh, const TArray<FMRUKProceduralMeshSection>& Sections, bool GenerateCollision);
+} // namespace MRUKProceduralMesh
+
+/**
+ * Generates procedural meshes on background tasks and creates the mesh sections on the game thread.
+ * Creating the mesh sections, and especially the collision, is the only part that has to happen on
+ * the game thread. Commit() spreads this work over multiple frames so that loading a room with many
+ * anchors doesn't cause a hitch.
+ */
+class MRUTILITYKIT_API FMRUKProceduralMeshQueue
+{
+public:
+	/**
+	 * Start generating the mesh on a background task. A mesh that is still pending for the same component is dropped,
+	 * so that it can't finish later and overwrite the newer mesh.
+	 * @param ProceduralMesh    The procedural mesh component that should receive the mesh.
+	 * @param Input             The data to generate the mesh from.
+	 * @param GenerateCollision Whether to generate collision geometry or not.
+	 * @param Material          Material that is applied to all sections once they have been created.
+	 */
+	void Enqueue(UProceduralMeshComponent* ProceduralMesh, FMRUKProceduralMeshInput&& Input, bool GenerateCollision, UMaterialInterface* Material);
+
+	/**
+	 * Create the mesh sections of finished tasks in the order they have been enqueued, until the time budget is used up.
+	 * At least one mesh gets committed per call so that the queue always makes progress.
+	 * @return The number of meshes that have been committed.
+	 */
+	int32 Commit(double BudgetSeconds);
+
+	/**
+	 * Wait for all tasks and commit all meshes.
+	 */
+	void Flush();
+
+	/**
+	 * Drop the pending mesh of the component without committing it, e.g. because a mesh has been created on it synchronously.
+	 */
+	void Cancel(const UProceduralMeshComponent* ProceduralMesh);
+
+	/**
+	 * Wait for all tasks and drop their meshes without committing them.
+	 */
+	void CancelAll();
+
+	bool IsEmpty() const { return PendingMeshes.IsEmpty(); }
+	int32 Num() const { return PendingMeshes.Num(); }
+
+private:
+	struct FPendingMesh
+	{
+		TWeakObjectPtr<UProceduralMeshComponent> ProceduralMesh;
+		TWeakObjectPtr<UMaterialInterface> Material;
+		UE::Tasks::TTask<TArray<FMRUKProceduralMeshSection>> Task;
+		bool GenerateCollision = true;
+	};
+
+	void Commit(const FPendingMesh& PendingMesh);
+
+	TArray<FPendingMesh> PendingMeshes;
+};
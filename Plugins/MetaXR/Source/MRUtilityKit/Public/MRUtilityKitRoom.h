@@ -5,6 +5,9 @@
 #include "GameFramework/Actor.h"
 #include "Dom/JsonObject.h"
 #include "MRUtilityKit.h"
+#include "MRUtilityKitBinarySerialization.h"
+#include "MRUtilityKitBVH.h"
+#include "MRUtilityKitRoomDistanceField.h"
 #include "OculusXRAnchorTypes.h"
 #include "MRUtilityKitRoom.generated.h"
 
@@ -101,6 +104,7 @@ public:
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAnchorUpdated, AMRUKAnchor*, Anchor);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAnchorCreated, AMRUKAnchor*, Anchor);
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAnchorRemoved, AMRUKAnchor*, Anchor);
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAnchorChanged, AMRUKAnchor*, Anchor, EMRUKAnchorChange, Change);
 
 	/**
 	 * The space handle of this anchor
@@ -133,6 +137,15 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "MR Utility Kit")
 	FOnAnchorRemoved OnAnchorRemoved;
 
+	/**
+	 * Event that gets fired for every anchor that changed when the room gets updated, including anchors
+	 * where only the pose changed. Removed anchors are reported before they get destroyed, all other
+	 * changes after the room has been initialized again. This fires before the OnRoomUpdated event of
+	 * the subsystem so listeners can patch the affected anchors instead of rebuilding the whole room.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "MR Utility Kit")
+	FOnAnchorChanged OnAnchorChanged;
+
 	/**
 	 * Bounds of the room.
 	 */
@@ -190,6 +203,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	bool IsPositionInRoom(const FVector& Position, bool TestVerticalBounds = true);
 
+	/**
+	 * Check whether multiple positions are inside the room or not. This is faster than calling
+	 * IsPositionInRoom() for every position.
+	 * @param Positions          The positions in world space to check.
+	 * @param OutInRoom          Whether each position is inside the room or not, in the same order as Positions.
+	 * @param TestVerticalBounds Whether the room should be constrained by vertical bounds or not in the check.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	void IsPositionInRoomBatch(const TArray<FVector>& Positions, TArray<bool>& OutInRoom, bool TestVerticalBounds = true);
+
 	/**
 	 * Generate a uniform random position within the room.
 	 * @param OutPosition			Contains the randomly generated position.
@@ -249,6 +272,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "LabelFilter"))
 	bool RaycastAll(const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors);
 
+	/**
+	 * Cast many rays at once and return the closest hit anchor for each of them. The rays are distributed
+	 * across worker threads, which is a lot faster than calling Raycast() in a loop when there are many rays.
+	 * @param Origins     The origins of the rays.
+	 * @param Directions  The directions of the rays. Must have the same number of elements as Origins.
+	 * @param MaxDist     The maximum distance the rays should travel.
+	 * @param LabelFilter The label filter can be used to include/exclude certain labels from the search.
+	 * @param OutHits     The closest hit for each ray. Each entry corresponds to the ray at the same position in Origins.
+	 * @param OutAnchors  The anchor each ray hit or a null pointer if the ray didn't hit anything.
+	 * @return            Whether any of the rays hit anything.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "LabelFilter"))
+	bool RaycastBatch(const TArray<FVector>& Origins, const TArray<FVector>& Directions, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors);
+
 	/**
 	 * Clear all anchors from the room.
 	 */
@@ -286,6 +323,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	AMRUKAnchor* IsPositionInSceneVolume(const FVector& WorldPosition, bool TestVerticalBounds = true, double Tolerance = 0.0);
 
+	/**
+	 * Get the distance from the given position to the closest plane or volume in the room.
+	 * If a distance field has been baked for this room (see UMRUKSettings::EnableRoomDistanceField) the distance
+	 * is looked up from it, otherwise it's computed from all anchors.
+	 * @param WorldPosition   The position in world space.
+	 * @param ExactRefinement If true the distance looked up from the distance field is refined to the exact distance.
+	 * @return                The distance to the closest surface. Zero if the position is inside of a volume.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	double GetDistanceToClosestSurface(const FVector& WorldPosition, bool ExactRefinement = false);
+
+	/**
+	 * Whether a distance field has been baked for this room.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	bool HasDistanceField() const { return DistanceField.IsValid(); }
+
 	/**
 	 * Finds the closest seat given a ray.
 	 * @param RayOrigin				The origin of the ray.
@@ -415,6 +469,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	bool LoadGlobalMeshFromJsonString(const FString& JsonString, UMaterialInterface* Material = nullptr);
 
+	/**
+	 * Load the triangle mesh of the global mesh anchor from a file that was written with
+	 * UMRUKSubsystem::SaveSceneToBinaryFile(). The file is memory mapped and the mesh data is
+	 * copied directly into the mesh. Falls back to JSON in case the file is not in the binary format.
+	 * @param FilePath The path to the binary scene file.
+	 * @param Material Material to apply on the global mesh.
+	 * @return         On Success true, otherwise false.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	bool LoadGlobalMeshFromBinaryFile(const FString& FilePath, UMaterialInterface* Material = nullptr);
+
 	/**
 	 * Compute the centroid of the room by taking the points of the floor boundary.
 	 * The centroid may be outside of the room for non convex rooms.
@@ -441,11 +506,13 @@ public:
 	void UpdateWorldLock(APawn* Pawn, const FVector& HeadWorldPosition) const;
 
 	TSharedRef<FJsonObject> JsonSerialize();
+	MRUKBinary::FRoomRecord BinarySerialize(TArray<uint8>& OutBlobs);
 
 	bool Corresponds(UMRUKRoomData* RoomQuery) const;
 
 private:
 	friend class FMRUKSpec;
+	friend class FMRUKBenchmarkSpec;
 
 	AMRUKAnchor* SpawnAnchor();
 
@@ -458,6 +525,15 @@ private:
 	UFUNCTION(CallInEditor)
 	void AddAnchorToRoom(AMRUKAnchor* Anchor);
 
+	/**
+	 * Compute the bounds of the anchor in the space of the room which are used for the raycast BVH.
+	 * Returns invalid bounds for anchors which can't be culled, e.g. the global mesh.
+	 */
+	FBox ComputeAnchorBVHBounds(const AMRUKAnchor* Anchor) const;
+
+	void UpdateDistanceField();
+	FVector WorldToDistanceFieldPosition(const FVector& WorldPosition) const;
+
 	class UProceduralMeshComponent* GetOrCreateGlobalMeshProceduralMeshComponent(bool& OutExistedAlready) const;
 	void SetupGlobalMeshProceduralMeshComponent(UProceduralMeshComponent& ProcMeshComponent, bool ExistedAlready, UMaterialInterface* Material) const;
 
@@ -471,6 +547,16 @@ private:
 	UPROPERTY()
 	AMRUKAnchor* KeyWallAnchor = nullptr;
 
+	/**
+	 * Acceleration structure for raycasts. Kept in room space so that it stays valid when the room moves.
+	 */
+	FMRUKAnchorBVH AnchorBVH;
+
+	/**
+	 * Optional distance field to speed up closest surface queries. Shared with the subsystem's cache.
+	 */
+	TSharedPtr<const FMRUKRoomDistanceField> DistanceField;
+
 	struct Surface
 	{
 		AMRUKAnchor* Anchor;
@@ -0,0 +1,67 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/Box.h"
+#include "Math/IntVector.h"
+#include "Math/Vector.h"
+
+class AMRUKRoom;
+
+/**
+ * CPU side distance field of the anchors in a room, sampled on a regular grid in the space of the room.
+ *
+ * The field stores a few channels that match the queries the room needs to answer most often. Sampling
+ * a channel is a trilinear lookup. Since all channels are 1-Lipschitz the interpolated value never
+ * differs from the true distance by more than GetMaxError(), which allows callers to use the field to
+ * reject queries early and only fall back to the exact computation when it can make a difference.
+ */
+class MRUTILITYKIT_API FMRUKRoomDistanceField
+{
+public:
+	enum class EChannel : uint8
+	{
+		// Distance to the closest plane or volume of any anchor
+		AllSurfaces,
+		// Distance to the closest wall face
+		WallFaces,
+		// Signed distance to the closest scene volume, measured along the axes of the volume (negative inside)
+		SceneVolumes,
+		Num,
+	};
+
+	/**
+	 * Bake the distance field for the given room.
+	 * @param Room          The room to bake the distance field for.
+	 * @param VoxelSize     The size of a voxel in centimeters.
+	 * @param MaxResolution The maximum number of voxels along any axis. The voxel size gets increased if necessary.
+	 */
+	void Bake(const AMRUKRoom& Room, double VoxelSize, int32 MaxResolution = 128);
+
+	/**
+	 * Sample the distance field at the given position.
+	 * @param Channel       The channel to sample.
+	 * @param RoomPosition  The position in the space of the room.
+	 * @param OutDistance   The interpolated distance.
+	 * @return              False if the position is outside of the distance field.
+	 */
+	bool Sample(EChannel Channel, const FVector& RoomPosition, double& OutDistance) const;
+
+	/**
+	 * The maximum difference between a sampled value and the exact distance.
+	 */
+	double GetMaxError() const { return MaxError; }
+
+	bool IsValid() const { return !Distances[0].IsEmpty(); }
+	const FBox& GetBounds() const { return Bounds; }
+	const FIntVector& GetResolution() const { return Resolution; }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	FBox Bounds{ ForceInit };
+	FIntVector Resolution{ 0 };
+	double VoxelSize = 0.0;
+	double MaxError = 0.0;
+	TArray<float> Distances[static_cast<int32>(EChannel::Num)];
+};
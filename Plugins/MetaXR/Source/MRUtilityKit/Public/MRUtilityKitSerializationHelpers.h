@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Templates/Function.h"
 #include "OculusXRAnchorTypes.h"
 #include "OculusXRRoomLayoutManagerComponent.h"
 
@@ -202,3 +204,143 @@ void MRUKDeserialize(const FJsonValue& Value, TArray<T>& OutArray)
 		OutArray.Push(ItemDeserialized);
 	}
 }
+
+/**
+ * Streaming counterparts of MRUKDeserialize(). Instead of working on a JSON DOM they read the value
+ * that starts with the token Notation, which has just been read from Reader, and consume it entirely.
+ * No intermediate JSON values get created. They return false if the JSON has an unexpected layout.
+ */
+
+bool MRUKSkipJsonValue(TJsonReader<>& Reader, EJsonNotation Notation);
+
+// Calls ReadField for every field of the object. ReadField has to consume the value of the field.
+bool MRUKReadJsonObject(TJsonReader<>& Reader, EJsonNotation Notation, TFunctionRef<bool(const FString& Identifier, EJsonNotation Notation)> ReadField);
+
+// Calls ReadItem for every item of the array. ReadItem has to consume the item.
+bool MRUKReadJsonArray(TJsonReader<>& Reader, EJsonNotation Notation, TFunctionRef<bool(EJsonNotation Notation)> ReadItem);
+
+// Reads an array of exactly NumNumbers numbers.
+bool MRUKReadJsonNumbers(TJsonReader<>& Reader, EJsonNotation Notation, double* OutNumbers, int32 NumNumbers);
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FString& String);
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FOculusXRUUID& UUID);
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, double& Number);
+
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, FOculusXRRoomLayout& RoomLayout);
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TVector2<T>& Vector)
+{
+	double Numbers[2];
+	if (!MRUKReadJsonNumbers(Reader, Notation, Numbers, 2))
+	{
+		return false;
+	}
+	Vector = UE::Math::TVector2<T>(Numbers[0], Numbers[1]);
+	return true;
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TVector<T>& Vector)
+{
+	double Numbers[3];
+	if (!MRUKReadJsonNumbers(Reader, Notation, Numbers, 3))
+	{
+		return false;
+	}
+	Vector = UE::Math::TVector<T>(Numbers[0], Numbers[1], Numbers[2]);
+	return true;
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TRotator<T>& Rotation)
+{
+	double Numbers[3];
+	if (!MRUKReadJsonNumbers(Reader, Notation, Numbers, 3))
+	{
+		return false;
+	}
+	Rotation = UE::Math::TRotator<T>(Numbers[0], Numbers[1], Numbers[2]);
+	return true;
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TBox2<T>& Box)
+{
+	if (Notation == EJsonNotation::Null)
+	{
+		Box.Init();
+		return true;
+	}
+	Box.bIsValid = true;
+	return MRUKReadJsonObject(Reader, Notation, [&Reader, &Box](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("Min"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Box.Min);
+		}
+		if (Identifier == TEXT("Max"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Box.Max);
+		}
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TBox<T>& Box)
+{
+	if (Notation == EJsonNotation::Null)
+	{
+		Box.Init();
+		return true;
+	}
+	Box.IsValid = 1;
+	return MRUKReadJsonObject(Reader, Notation, [&Reader, &Box](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("Min"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Box.Min);
+		}
+		if (Identifier == TEXT("Max"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Box.Max);
+		}
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, UE::Math::TTransform<T>& Transform)
+{
+	UE::Math::TVector<T> Translation = UE::Math::TVector<T>::ZeroVector;
+	UE::Math::TRotator<T> Rotation = UE::Math::TRotator<T>::ZeroRotator;
+	UE::Math::TVector<T> Scale = UE::Math::TVector<T>::OneVector;
+	const bool Success = MRUKReadJsonObject(Reader, Notation, [&](const FString& Identifier, EJsonNotation FieldNotation) {
+		if (Identifier == TEXT("Translation"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Translation);
+		}
+		if (Identifier == TEXT("Rotation"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Rotation);
+		}
+		if (Identifier == TEXT("Scale"))
+		{
+			return MRUKDeserialize(Reader, FieldNotation, Scale);
+		}
+		return MRUKSkipJsonValue(Reader, FieldNotation);
+	});
+
+	Transform.SetComponents(UE::Math::TQuat<T>(Rotation), Translation, Scale);
+	return Success;
+}
+
+template <typename T>
+bool MRUKDeserialize(TJsonReader<>& Reader, EJsonNotation Notation, TArray<T>& OutArray)
+{
+	OutArray.Empty();
+	return MRUKReadJsonArray(Reader, Notation, [&Reader, &OutArray](EJsonNotation ItemNotation) {
+		return MRUKDeserialize(Reader, ItemNotation, OutArray.AddDefaulted_GetRef());
+	});
+}
@@ -2,12 +2,14 @@
 
 #pragma once
 
+#include "Containers/LruCache.h"
 #include "Dom/JsonObject.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/WorldSettings.h"
 #include "MRUtilityKitRoom.h"
 #include "MRUtilityKit.h"
 #include "MRUtilityKitData.h"
+#include "MRUtilityKitProceduralMesh.h"
 #include "OculusXRSceneTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Tickable.h"
@@ -126,6 +128,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "LabelFilter"))
 	bool RaycastAll(const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors);
 
+	/**
+	 * Cast many rays at once and return the closest hit anchor in the scene for each of them. The rays
+	 * are distributed across worker threads, which is a lot faster than calling Raycast() in a loop.
+	 * @param Origins     The origins of the rays.
+	 * @param Directions  The directions of the rays. Must have the same number of elements as Origins.
+	 * @param MaxDist     The maximum distance the rays should travel.
+	 * @param LabelFilter The label filter can be used to include/exclude certain labels from the search.
+	 * @param OutHits     The closest hit for each ray. Each entry corresponds to the ray at the same position in Origins.
+	 * @param OutAnchors  The anchor each ray hit or a null pointer if the ray didn't hit anything.
+	 * @return            Whether any of the rays hit anything.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit", meta = (AutoCreateRefTerm = "LabelFilter"))
+	bool RaycastBatch(const TArray<FVector>& Origins, const TArray<FVector>& Directions, float MaxDist, const FMRUKLabelFilter& LabelFilter, TArray<FMRUKHit>& OutHits, TArray<AMRUKAnchor*>& OutAnchors);
+
 	/**
 	 * Return the room that the headset is currently in. If the headset is not in any given room
 	 * then it will return the room the headset was last in when this function was called.
@@ -150,6 +166,40 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
 	void LoadSceneFromJsonString(const FString& String);
 
+	/**
+	 * Save all rooms and anchors to the binary scene format. It contains the same data as the JSON
+	 * representation but loads a lot faster, especially when a global mesh is present.
+	 * @return the binary data.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	TArray<uint8> SaveSceneToBinary();
+
+	/**
+	 * Save all rooms and anchors to a file in the binary scene format.
+	 * @param FilePath The path of the file to write.
+	 * @return         Whether the file could be written.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	bool SaveSceneToBinaryFile(const FString& FilePath);
+
+	/**
+	 * Load rooms and anchors from the binary scene format.
+	 * If the scene is already loaded the scene will be updated with the changes.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	void LoadSceneFromBinary(const TArray<uint8>& Data);
+
+	/**
+	 * Load rooms and anchors from a file. The file is memory mapped if possible. Files in the JSON
+	 * format are supported as well, in that case the scene is loaded with LoadSceneFromJsonString().
+	 * If the scene is already loaded the scene will be updated with the changes.
+	 * @param FilePath The path of the file to load.
+	 * @return         Whether the file could be read and loading of the scene started. False as well
+	 *                 if another scene is still loading.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "MR Utility Kit")
+	bool LoadSceneFromBinaryFile(const FString& FilePath);
+
 	/**
 	 * Load rooms and anchors from the device.
 	 * If the scene is already loaded the scene will be updated with the changes.
@@ -270,12 +320,23 @@ public:
 	void UnregisterRoom(AMRUKRoom* Room);
 	// Calculate the bounds of an Actor class and return it, the result is saved in a cache for faster lookup.
 	FBox GetActorClassBounds(TSubclassOf<AActor> Actor);
+	// Bake the distance field for the room and return it, the result is saved in a cache keyed by a hash of the
+	// anchors so that loading the same room again doesn't need to bake it again. The cache only lives in memory,
+	// it is not stored with the room data.
+	TSharedPtr<const FMRUKRoomDistanceField> GetOrBakeRoomDistanceField(AMRUKRoom* Room, double VoxelSize);
 	UOculusXRRoomLayoutManagerComponent* GetRoomLayoutManager();
+	// Procedural meshes that are generated in the background. The subsystem commits them every tick within the frame budget.
+	FMRUKProceduralMeshQueue& GetProceduralMeshQueue() { return ProceduralMeshQueue; }
 
 private:
 	AMRUKRoom* SpawnRoom();
 
 	void FinishedLoading(bool Success);
+	// Create the scene data and bind the completion event, returns false if a scene is already being loaded
+	bool BeginLoadSceneData(const TCHAR* Source);
+	// Returns false if the scene couldn't be loaded because another scene is still loading
+	bool LoadSceneFromBinaryView(TConstArrayView<uint8> Data);
+	bool TryLoadSceneFromJsonString(const FString& String);
 
 	// FTickableGameObject interface
 	virtual void Tick(float DeltaTime) override;
@@ -306,4 +367,7 @@ private:
 	AActor* PositionGenerator = nullptr;
 
 	TMap<TSubclassOf<AActor>, FBox> ActorClassBoundsCache;
+	// Keep only a few distance fields around, rooms which are not loaded anymore are unlikely to come back
+	TLruCache<FString, TSharedPtr<const FMRUKRoomDistanceField>> RoomDistanceFieldCache{ 8 };
+	FMRUKProceduralMeshQueue ProceduralMeshQueue;
 };
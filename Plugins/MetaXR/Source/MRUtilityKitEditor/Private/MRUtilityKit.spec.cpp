@@ -4,12 +4,68 @@
 #include "MRUtilityKitSubsystem.h"
 #include "MRUtilityKitAnchor.h"
 #include "MRUtilityKitAnchorActorSpawner.h"
+#include "MRUtilityKitBlobShadowComponent.h"
 #include "Misc/AutomationTest.h"
 #include "Tests/AutomationEditorCommon.h"
 #include "Editor/UnrealEdEngine.h"
 #include "UnrealEdGlobals.h"
 #include "TestHelper.h"
 #include "Editor.h"
+#include "Kismet/GameplayStatics.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+
+namespace
+{
+	/**
+	 * Move all anchors of the example room by the same offset. This is what happens when the headset re-localizes.
+	 */
+	FString CreateMovedRoomJson(const FVector& Offset)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const auto JsonReader = TJsonReaderFactory<>::Create(ExampleRoomJson);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			return {};
+		}
+
+		for (const auto& Anchor : JsonObject->GetArrayField(TEXT("Rooms"))[0]->AsObject()->GetArrayField(TEXT("Anchors")))
+		{
+			const auto& Transform = Anchor->AsObject()->GetObjectField(TEXT("Transform"));
+			TArray<TSharedPtr<FJsonValue>> Translation = Transform->GetArrayField(TEXT("Translation"));
+			for (int32 i = 0; i < 3; ++i)
+			{
+				Translation[i] = MakeShared<FJsonValueNumber>(Translation[i]->AsNumber() + Offset[i]);
+			}
+			Transform->SetArrayField(TEXT("Translation"), Translation);
+		}
+
+		FString Result;
+		const auto JsonWriter = TJsonWriterFactory<>::Create(&Result);
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
+		return Result;
+	}
+
+	/**
+	 * Spawn a cube with a blob shadow below it.
+	 */
+	UMRUKBlobShadowComponent* SpawnBlobShadow(UWorld* World, EMRUKBlobShadowUpdateMode UpdateMode, const FVector& Location)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		UStaticMeshComponent* Mesh = Cast<UStaticMeshComponent>(Actor->AddComponentByClass(UStaticMeshComponent::StaticClass(), false, FTransform(Location), false));
+		Mesh->SetMobility(EComponentMobility::Movable);
+		Mesh->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube")));
+
+		// Set the update mode before the component begins play, so that batched blob shadows register with the subsystem
+		UMRUKBlobShadowComponent* BlobShadow = Cast<UMRUKBlobShadowComponent>(Actor->AddComponentByClass(UMRUKBlobShadowComponent::StaticClass(), false, FTransform::Identity, true));
+		BlobShadow->UpdateMode = UpdateMode;
+		Actor->FinishAddComponent(BlobShadow, false, FTransform::Identity);
+		return BlobShadow;
+	}
+} // namespace
 
 BEGIN_DEFINE_SPEC(FMRUKSpec, TEXT("MR Utility Kit"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
 UMRUKSubsystem* ToolkitSubsystem;
@@ -159,6 +215,70 @@ void FMRUKSpec::Define()
 			TestEqual(TEXT("Couch mesh scale"), CouchMeshActor->GetActorScale(), FVector(0.902, 2.029, 0.566), Tolerance);
 		});
 
+		It(TEXT("Keeps spawned actors when anchors only move"), [this]() {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			const auto Subsystem = World->GetGameInstance()->GetSubsystem<UMRUKSubsystem>();
+			const auto WindowAnchor = Subsystem->GetCurrentRoom()->GetFirstAnchorByLabel(FMRUKLabels::WindowFrame);
+			if (!TestNotNull(TEXT("Window anchor is set"), WindowAnchor))
+			{
+				return;
+			}
+
+			const auto Spawner = Cast<AMRUKAnchorActorSpawner>(UGameplayStatics::GetActorOfClass(World, AMRUKAnchorActorSpawner::StaticClass()));
+			if (!TestNotNull(TEXT("Spawner exists"), Spawner))
+			{
+				return;
+			}
+
+			TArray<AActor*> ActorsBefore;
+			Spawner->GetSpawnedActors(ActorsBefore);
+			TArray<AActor*> WindowChildActors;
+			WindowAnchor->GetAttachedActors(WindowChildActors);
+			if (!TestFalse(TEXT("Window has child actors"), WindowChildActors.IsEmpty()))
+			{
+				return;
+			}
+			const FVector WindowMeshLocation = WindowChildActors[0]->GetActorLocation();
+
+			const FVector Offset(10.0, -20.0, 5.0);
+			Subsystem->LoadSceneFromJsonString(CreateMovedRoomJson(Offset));
+
+			TArray<AActor*> ActorsAfter;
+			Spawner->GetSpawnedActors(ActorsAfter);
+			TestTrue(TEXT("Spawned actors are kept"), ActorsAfter == ActorsBefore);
+			TestTrue(TEXT("Spawned actors are valid"), !ActorsAfter.ContainsByPredicate([](const AActor* Actor) { return !IsValid(Actor); }));
+			TestEqual(TEXT("Window mesh moved with its anchor"), WindowChildActors[0]->GetActorLocation(), WindowMeshLocation + Offset, 0.01);
+		});
+
+		It(TEXT("Spawns actors only for added anchors"), [this]() {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			const auto Subsystem = World->GetGameInstance()->GetSubsystem<UMRUKSubsystem>();
+			const auto WindowAnchor = Subsystem->GetCurrentRoom()->GetFirstAnchorByLabel(FMRUKLabels::WindowFrame);
+			if (!TestNotNull(TEXT("Window anchor is set"), WindowAnchor))
+			{
+				return;
+			}
+
+			TArray<AActor*> WindowActorsBefore;
+			WindowAnchor->GetAttachedActors(WindowActorsBefore);
+
+			Subsystem->LoadSceneFromJsonString(ExampleRoomFurnitureAddedJson);
+
+			TArray<AActor*> WindowActorsAfter;
+			WindowAnchor->GetAttachedActors(WindowActorsAfter);
+			TestTrue(TEXT("Window actors are kept"), WindowActorsAfter == WindowActorsBefore);
+
+			for (const auto& Anchor : Subsystem->GetCurrentRoom()->AllAnchors)
+			{
+				if (Anchor->HasLabel(FMRUKLabels::Couch))
+				{
+					TArray<AActor*> CouchActors;
+					Anchor->GetAttachedActors(CouchActors);
+					TestFalse(TEXT("Couch has child actors"), CouchActors.IsEmpty());
+				}
+			}
+		});
+
 		TeardownMRUKSubsystem();
 	});
 
@@ -343,6 +463,47 @@ void FMRUKSpec::Define()
 			O->MarkAsGarbage();
 		});
 
+		It(TEXT("Moving all anchors only reports pose changes"), [this]() {
+			auto O = NewObject<URoomAndAnchorObserver>();
+
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			Room->OnAnchorCreated.AddDynamic(O, &URoomAndAnchorObserver::OnAnchorCreated);
+			Room->OnAnchorUpdated.AddDynamic(O, &URoomAndAnchorObserver::OnAnchorUpdated);
+			Room->OnAnchorRemoved.AddDynamic(O, &URoomAndAnchorObserver::OnAnchorRemoved);
+			Room->OnAnchorChanged.AddDynamic(O, &URoomAndAnchorObserver::OnAnchorChanged);
+
+			ToolkitSubsystem->LoadSceneFromJsonString(CreateMovedRoomJson(FVector(10.0, -20.0, 5.0)));
+
+			TestEqual(TEXT("No anchors created"), O->AnchorsCreated.Num(), 0);
+			TestEqual(TEXT("No anchors updated"), O->AnchorsUpdated.Num(), 0);
+			TestEqual(TEXT("No anchors removed"), O->AnchorsRemoved.Num(), 0);
+			TestEqual(TEXT("All anchors moved"), O->AnchorsMoved.Num(), Room->AllAnchors.Num());
+			TestEqual(TEXT("Only pose changes"), O->AnchorChanges.Num(), O->AnchorsMoved.Num());
+
+			O->MarkAsGarbage();
+		});
+
+		It(TEXT("Anchor changes distinguish geometry and pose"), [this]() {
+			auto O = NewObject<URoomAndAnchorObserver>();
+
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			Room->OnAnchorChanged.AddDynamic(O, &URoomAndAnchorObserver::OnAnchorChanged);
+
+			ToolkitSubsystem->LoadSceneFromJsonString(ExampleRoomJson);
+			TestEqual(TEXT("No changes"), O->AnchorChanges.Num(), 0);
+
+			ToolkitSubsystem->LoadSceneFromJsonString(ExampleRoomMoreFurnitureAddedJson);
+			TestEqual(TEXT("Anchors created"), O->AnchorChanges.FilterByPredicate([](EMRUKAnchorChange Change) { return Change == EMRUKAnchorChange::Created; }).Num(), 3);
+
+			O->Clear();
+
+			ToolkitSubsystem->LoadSceneFromJsonString(ExampleRoomFurnitureModifiedJson);
+			TestEqual(TEXT("Anchors with changed geometry"), O->AnchorChanges.FilterByPredicate([](EMRUKAnchorChange Change) { return Change == EMRUKAnchorChange::Geometry; }).Num(), 2);
+			TestEqual(TEXT("Anchors removed"), O->AnchorChanges.FilterByPredicate([](EMRUKAnchorChange Change) { return Change == EMRUKAnchorChange::Removed; }).Num(), 1);
+
+			O->MarkAsGarbage();
+		});
+
 		It(TEXT("Add and remove room"), [this]() {
 			auto O = NewObject<URoomAndAnchorObserver>();
 
@@ -1269,6 +1430,96 @@ void FMRUKSpec::Define()
 		TeardownMRUKSubsystem();
 	});
 
+	Describe(TEXT("Blob shadow"), [this] {
+		SetupMRUKSubsystem();
+
+		// A blob shadow that has been updated has its scale recomputed, so any update overwrites this scale
+		const FVector NotUpdatedScale(123.0);
+
+		It(TEXT("Updates every frame"), [this, NotUpdatedScale]() {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			UMRUKBlobShadowComponent* BlobShadow = SpawnBlobShadow(World, EMRUKBlobShadowUpdateMode::EveryFrame, FVector(0.0, 0.0, 50.0));
+
+			BlobShadow->SetWorldScale3D(NotUpdatedScale);
+			BlobShadow->TickComponent(0.0f, LEVELTICK_All, &BlobShadow->PrimaryComponentTick);
+			TestFalse(TEXT("Unchanged blob shadow is updated"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+		});
+
+		It(TEXT("Updates on change only"), [this, NotUpdatedScale]() {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			UMRUKBlobShadowComponent* BlobShadow = SpawnBlobShadow(World, EMRUKBlobShadowUpdateMode::OnChange, FVector(0.0, 0.0, 50.0));
+			AActor* Owner = BlobShadow->GetOwner();
+			const auto Tick = [BlobShadow]() {
+				BlobShadow->TickComponent(0.0f, LEVELTICK_All, &BlobShadow->PrimaryComponentTick);
+			};
+
+			BlobShadow->SetWorldScale3D(NotUpdatedScale);
+			Tick();
+			TestTrue(TEXT("Unchanged blob shadow is not updated"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			Owner->SetActorLocation(Owner->GetActorLocation() + FVector(10.0, 0.0, 0.0));
+			Tick();
+			TestFalse(TEXT("Blob shadow is updated after the owner moved"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			BlobShadow->SetWorldScale3D(NotUpdatedScale);
+			Tick();
+			TestTrue(TEXT("Blob shadow is updated once per change"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			Owner->SetActorScale3D(FVector(2.0));
+			Tick();
+			TestFalse(TEXT("Blob shadow is updated after the owner bounds changed"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			BlobShadow->SetWorldScale3D(NotUpdatedScale);
+			BlobShadow->ExtraExtent += 5.0f;
+			Tick();
+			TestFalse(TEXT("Blob shadow is updated after a property changed"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			BlobShadow->SetWorldScale3D(NotUpdatedScale);
+			BlobShadow->MarkDirty();
+			Tick();
+			TestFalse(TEXT("Blob shadow is updated after MarkDirty"), BlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+		});
+
+		It(TEXT("Updates changed blob shadows once per batch"), [this, NotUpdatedScale]() {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			UMRUKBlobShadowSubsystem* Subsystem = World->GetSubsystem<UMRUKBlobShadowSubsystem>();
+			UMRUKBlobShadowComponent* MovedBlobShadow = SpawnBlobShadow(World, EMRUKBlobShadowUpdateMode::Batched, FVector(0.0, 0.0, 50.0));
+			UMRUKBlobShadowComponent* StaticBlobShadow = SpawnBlobShadow(World, EMRUKBlobShadowUpdateMode::Batched, FVector(500.0, 0.0, 50.0));
+			TestFalse(TEXT("Batched blob shadow doesn't tick"), MovedBlobShadow->IsComponentTickEnabled());
+
+			MovedBlobShadow->SetWorldScale3D(NotUpdatedScale);
+			StaticBlobShadow->SetWorldScale3D(NotUpdatedScale);
+			Subsystem->Tick(0.0f);
+			TestTrue(TEXT("Unchanged blob shadow is not updated"), MovedBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			// Moving the owner several times between two batches updates the blob shadow in the next batch only
+			AActor* Owner = MovedBlobShadow->GetOwner();
+			Owner->SetActorLocation(Owner->GetActorLocation() + FVector(10.0, 0.0, 0.0));
+			Owner->SetActorLocation(Owner->GetActorLocation() + FVector(10.0, 0.0, 0.0));
+			Subsystem->Tick(0.0f);
+			TestFalse(TEXT("Moved blob shadow is updated"), MovedBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+			TestTrue(TEXT("Static blob shadow is not updated"), StaticBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			MovedBlobShadow->SetWorldScale3D(NotUpdatedScale);
+			Subsystem->Tick(0.0f);
+			TestTrue(TEXT("Moved blob shadow is updated once"), MovedBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			StaticBlobShadow->MarkDirty();
+			Subsystem->Tick(0.0f);
+			TestFalse(TEXT("Blob shadow is updated after MarkDirty"), StaticBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+
+			// Blob shadows that switch to another update mode leave the batch
+			MovedBlobShadow->SetUpdateMode(EMRUKBlobShadowUpdateMode::OnChange);
+			TestTrue(TEXT("Blob shadow ticks again"), MovedBlobShadow->IsComponentTickEnabled());
+			MovedBlobShadow->SetWorldScale3D(NotUpdatedScale);
+			Owner->SetActorLocation(Owner->GetActorLocation() + FVector(10.0, 0.0, 0.0));
+			Subsystem->Tick(0.0f);
+			TestTrue(TEXT("Blob shadow is not updated by the batch"), MovedBlobShadow->GetComponentScale().Equals(NotUpdatedScale));
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
 	Describe(TEXT("Utilities"), [this] {
 		It(TEXT("Label Filter"), [this]() {
 			FMRUKLabelFilter Filter;
@@ -0,0 +1,1213 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "MRUtilityKitSubsystem.h"
+#include "MRUtilityKitAnchor.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "Editor/UnrealEdEngine.h"
+#include "UnrealEdGlobals.h"
+#include "TestHelper.h"
+#include "Editor.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "MRUtilityKitBinarySerialization.h"
+#include "MRUtilityKitBPLibrary.h"
+#include "ProceduralMeshComponent.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "MRUtilityKitProceduralMesh.h"
+#include "MRUtilityKitPolygonGrid.h"
+
+namespace
+{
+	/**
+	 * Build a scene with many more anchors than the example room by duplicating all volume anchors
+	 * of the example room several times at different offsets.
+	 */
+	FString CreateDenseRoomJson(int32 Copies)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const auto JsonReader = TJsonReaderFactory<>::Create(ExampleRoomJson);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			return {};
+		}
+
+		const auto& Room = JsonObject->GetArrayField(TEXT("Rooms"))[0]->AsObject();
+		TArray<TSharedPtr<FJsonValue>> Anchors = Room->GetArrayField(TEXT("Anchors"));
+		const int32 NumOriginalAnchors = Anchors.Num();
+		for (int32 Copy = 0; Copy < Copies; ++Copy)
+		{
+			for (int32 i = 0; i < NumOriginalAnchors; ++i)
+			{
+				const auto& Anchor = Anchors[i]->AsObject();
+				if (!Anchor->HasField(TEXT("VolumeBounds")))
+				{
+					continue;
+				}
+				const TSharedRef<FJsonObject> NewAnchor = MakeShared<FJsonObject>(*Anchor);
+				NewAnchor->SetStringField(TEXT("UUID"), FGuid::NewGuid().ToString(EGuidFormats::Digits));
+
+				const TSharedRef<FJsonObject> Transform = MakeShared<FJsonObject>(*Anchor->GetObjectField(TEXT("Transform")));
+				TArray<TSharedPtr<FJsonValue>> Translation = Transform->GetArrayField(TEXT("Translation"));
+				const double Offset = 25.0 * (Copy + 1);
+				Translation[0] = MakeShared<FJsonValueNumber>(Translation[0]->AsNumber() + ((Copy % 2) ? Offset : -Offset));
+				Translation[1] = MakeShared<FJsonValueNumber>(Translation[1]->AsNumber() + ((Copy % 3) ? -Offset : Offset));
+				Transform->SetArrayField(TEXT("Translation"), Translation);
+				NewAnchor->SetObjectField(TEXT("Transform"), Transform);
+
+				Anchors.Add(MakeShared<FJsonValueObject>(NewAnchor));
+			}
+		}
+		Room->SetArrayField(TEXT("Anchors"), Anchors);
+
+		FString Result;
+		const auto JsonWriter = TJsonWriterFactory<>::Create(&Result);
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), JsonWriter);
+		return Result;
+	}
+
+	/**
+	 * Reference implementation of the room raycast which tests every anchor in the room.
+	 */
+	AMRUKAnchor* RaycastLinear(AMRUKRoom* Room, const FVector& Origin, const FVector& Direction, float MaxDist, const FMRUKLabelFilter& LabelFilter, FMRUKHit& OutHit)
+	{
+		AMRUKAnchor* HitAnchor = nullptr;
+		for (const auto& Anchor : Room->AllAnchors)
+		{
+			if (!Anchor || !Anchor->PassesLabelFilter(LabelFilter))
+			{
+				continue;
+			}
+			FMRUKHit HitResult;
+			if (Anchor->Raycast(Origin, Direction, MaxDist, HitResult, LabelFilter.ComponentTypes))
+			{
+				MaxDist = HitResult.HitDistance;
+				OutHit = HitResult;
+				HitAnchor = Anchor;
+			}
+		}
+		return HitAnchor;
+	}
+
+	/**
+	 * Reference implementation of the closest surface query which tests every anchor in the room.
+	 */
+	AMRUKAnchor* ClosestSurfaceLinear(AMRUKRoom* Room, const FVector& Position, const FMRUKLabelFilter& LabelFilter, double MaxDistance, double& OutDistance)
+	{
+		AMRUKAnchor* ClosestAnchor = nullptr;
+		OutDistance = MaxDistance <= 0.0 ? DBL_MAX : MaxDistance;
+		for (const auto& Anchor : Room->AllAnchors)
+		{
+			if (!Anchor || !Anchor->PassesLabelFilter(LabelFilter))
+			{
+				continue;
+			}
+			FVector SurfacePosition;
+			const double Distance = Anchor->GetClosestSurfacePosition(Position, SurfacePosition);
+			if (Distance < OutDistance)
+			{
+				OutDistance = Distance;
+				ClosestAnchor = Anchor;
+			}
+		}
+		return ClosestAnchor;
+	}
+
+	void CreateRandomRays(const FBox& Bounds, int32 Count, TArray<FVector>& OutOrigins, TArray<FVector>& OutDirections)
+	{
+		FRandomStream RandomStream(1234);
+		OutOrigins.SetNum(Count);
+		OutDirections.SetNum(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutOrigins[i] = RandomStream.RandPointInBox(Bounds);
+			OutDirections[i] = RandomStream.VRand();
+		}
+	}
+
+	/**
+	 * Create a flat grid with roughly the number of vertices of a scanned global mesh.
+	 */
+	void CreateGridMesh(int32 Size, TArray<FVector>& OutPositions, TArray<int32>& OutIndices)
+	{
+		FRandomStream RandomStream(1234);
+		OutPositions.Reset(Size * Size);
+		OutIndices.Reset((Size - 1) * (Size - 1) * 6);
+		for (int32 Y = 0; Y < Size; ++Y)
+		{
+			for (int32 X = 0; X < Size; ++X)
+			{
+				OutPositions.Add(FVector(X * 2.0, Y * 2.0, RandomStream.FRandRange(0.0, 1.0)));
+			}
+		}
+		for (int32 Y = 0; Y < Size - 1; ++Y)
+		{
+			for (int32 X = 0; X < Size - 1; ++X)
+			{
+				const int32 Index = X + Y * Size;
+				OutIndices.Append({ Index, Index + Size, Index + 1, Index + 1, Index + Size, Index + Size + 1 });
+			}
+		}
+	}
+
+	/**
+	 * Add a global mesh anchor to the room with the given UUID. The room is added to the scene if it doesn't exist yet.
+	 */
+	FString AddGlobalMeshJson(const FString& SceneJson, const FString& RoomUUID, const TArray<FVector>& Positions, const TArray<int32>& Indices)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const auto JsonReader = TJsonReaderFactory<>::Create(SceneJson);
+		if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+		{
+			return {};
+		}
+
+		TArray<TSharedPtr<FJsonValue>> PositionsJson;
+		PositionsJson.Reserve(Positions.Num());
+		for (const FVector& Position : Positions)
+		{
+			PositionsJson.Add(MakeShared<FJsonValueArray>(TArray<TSharedPtr<FJsonValue>>{ MakeShared<FJsonValueNumber>(Position.X), MakeShared<FJsonValueNumber>(Position.Y), MakeShared<FJsonValueNumber>(Position.Z) }));
+		}
+		TArray<TSharedPtr<FJsonValue>> IndicesJson;
+		IndicesJson.Reserve(Indices.Num());
+		for (const int32 Index : Indices)
+		{
+			IndicesJson.Add(MakeShared<FJsonValueNumber>(Index));
+		}
+		const TSharedRef<FJsonObject> GlobalMeshJson = MakeShared<FJsonObject>();
+		GlobalMeshJson->SetStringField(TEXT("UUID"), FGuid::NewGuid().ToString(EGuidFormats::Digits));
+		GlobalMeshJson->SetArrayField(TEXT("Positions"), PositionsJson);
+		GlobalMeshJson->SetArrayField(TEXT("Indices"), IndicesJson);
+
+		const TSharedRef<FJsonObject> AnchorJson = MakeShared<FJsonObject>();
+		AnchorJson->SetStringField(TEXT("UUID"), GlobalMeshJson->GetStringField(TEXT("UUID")));
+		AnchorJson->SetArrayField(TEXT("SemanticClassifications"), { MakeShared<FJsonValueString>(FMRUKLabels::GlobalMesh) });
+		AnchorJson->SetObjectField(TEXT("GlobalMesh"), GlobalMeshJson);
+
+		TArray<TSharedPtr<FJsonValue>> Rooms = JsonObject->GetArrayField(TEXT("Rooms"));
+		TSharedPtr<FJsonObject> RoomJson;
+		for (const auto& Room : Rooms)
+		{
+			if (Room->AsObject()->GetStringField(TEXT("UUID")) == RoomUUID)
+			{
+				RoomJson = Room->AsObject();
+			}
+		}
+		if (!RoomJson)
+		{
+			RoomJson = MakeShared<FJsonObject>();
+			RoomJson->SetStringField(TEXT("UUID"), RoomUUID);
+			RoomJson->SetArrayField(TEXT("Anchors"), {});
+			Rooms.Add(MakeShared<FJsonValueObject>(RoomJson));
+			JsonObject->SetArrayField(TEXT("Rooms"), Rooms);
+		}
+		TArray<TSharedPtr<FJsonValue>> Anchors = RoomJson->GetArrayField(TEXT("Anchors"));
+		Anchors.Add(MakeShared<FJsonValueObject>(AnchorJson));
+		RoomJson->SetArrayField(TEXT("Anchors"), Anchors);
+
+		FString Result;
+		FJsonSerializer::Serialize(JsonObject.ToSharedRef(), TJsonWriterFactory<>::Create(&Result, 0));
+		return Result;
+	}
+
+	/**
+	 * Get the UUIDs and transforms of all anchors in the scene.
+	 */
+	TMap<FString, FTransform> GetAnchorTransforms(const UMRUKSubsystem* Subsystem)
+	{
+		TMap<FString, FTransform> Transforms;
+		for (const auto& Room : Subsystem->Rooms)
+		{
+			for (const auto& Anchor : Room->AllAnchors)
+			{
+				Transforms.Add(Anchor->AnchorUUID.ToString(), Anchor->GetActorTransform());
+			}
+		}
+		return Transforms;
+	}
+	/**
+	 * Reference implementation of the point in polygon test that loops over all edges of the boundary.
+	 */
+	bool IsPositionInBoundaryLinear(const TArray<FVector2D>& Boundary, const FVector2D& Position)
+	{
+		int Intersections = 0;
+		for (int i = 1; i <= Boundary.Num(); i++)
+		{
+			const FVector2D P1 = Boundary[i - 1];
+			const FVector2D P2 = Boundary[i % Boundary.Num()];
+			if (Position.Y > FMath::Min(P1.Y, P2.Y) && Position.Y <= FMath::Max(P1.Y, P2.Y) && Position.X <= FMath::Max(P1.X, P2.X) && P1.Y != P2.Y)
+			{
+				const auto Frac = (Position.Y - P1.Y) / (P2.Y - P1.Y);
+				const auto XIntersection = P1.X + Frac * (P2.X - P1.X);
+				if (P1.X == P2.X || Position.X <= XIntersection)
+				{
+					Intersections++;
+				}
+			}
+		}
+		return Intersections % 2 == 1;
+	}
+
+	/**
+	 * Create a star shaped polygon with many vertices, similar to the floor of a scanned room.
+	 */
+	TArray<FVector2D> CreateStarBoundary(int32 NumVertices)
+	{
+		FRandomStream RandomStream(7);
+		TArray<FVector2D> Boundary;
+		Boundary.Reserve(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			const double Angle = UE_TWO_PI * i / NumVertices;
+			const double Radius = ((i % 2) ? 300.0 : 200.0) + RandomStream.FRandRange(-50.0, 50.0);
+			Boundary.Emplace(Radius * FMath::Cos(Angle), Radius * FMath::Sin(Angle));
+		}
+		return Boundary;
+	}
+
+	TArray<FVector2D> CreateRandomPositions(const FBox2D& Bounds, int32 Count)
+	{
+		FRandomStream RandomStream(13);
+		TArray<FVector2D> Positions;
+		Positions.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Positions.Emplace(RandomStream.FRandRange(Bounds.Min.X, Bounds.Max.X), RandomStream.FRandRange(Bounds.Min.Y, Bounds.Max.Y));
+		}
+		return Positions;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(FMRUKBenchmarkSpec, TEXT("MR Utility Kit.Benchmark"), EAutomationTestFlags::PerfFilter | EAutomationTestFlags::ApplicationContextMask)
+UMRUKSubsystem* ToolkitSubsystem;
+FString DenseRoomJson;
+
+void SetupMRUKSubsystem();
+void TeardownMRUKSubsystem();
+bool TestRaycastMatchesLinear(AMRUKRoom* Room, int32 NumRays, float MaxDist = 0.0f, double DirectionScale = 1.0);
+END_DEFINE_SPEC(FMRUKBenchmarkSpec)
+
+void FMRUKBenchmarkSpec::SetupMRUKSubsystem()
+{
+	BeforeEach([this]() {
+		// Load map and start play in editor
+		const auto ContentDir = FPaths::ProjectContentDir();
+		FAutomationEditorCommonUtils::LoadMap(ContentDir + "/Common/Maps/TestLevel.umap");
+		StartPIE(true);
+	});
+
+	BeforeEach(EAsyncExecution::ThreadPool, []() {
+		while (!GEditor->IsPlayingSessionInEditor())
+		{
+			// Wait until play session starts
+			FGenericPlatformProcess::Yield();
+		}
+	});
+
+	BeforeEach([this]() {
+		// Get a reference to the subsystem
+		const auto World = GEditor->GetPIEWorldContext()->World();
+		const auto GameInstance = World->GetGameInstance();
+		ToolkitSubsystem = GameInstance->GetSubsystem<UMRUKSubsystem>();
+	});
+}
+
+void FMRUKBenchmarkSpec::TeardownMRUKSubsystem()
+{
+	// Caution: Order of these statements is important
+
+	AfterEach(EAsyncExecution::ThreadPool, []() {
+		while (GEditor->IsPlayingSessionInEditor())
+		{
+			// Wait until play session ends
+			FGenericPlatformProcess::Yield();
+		}
+	});
+
+	AfterEach([]() {
+		// Request end of play session
+		GUnrealEd->RequestEndPlayMap();
+	});
+}
+
+bool FMRUKBenchmarkSpec::TestRaycastMatchesLinear(AMRUKRoom* Room, int32 NumRays, float MaxDist, double DirectionScale)
+{
+	TArray<FVector> Origins;
+	TArray<FVector> Directions;
+	CreateRandomRays(Room->RoomBounds, NumRays, Origins, Directions);
+	for (FVector& Direction : Directions)
+	{
+		Direction *= DirectionScale;
+	}
+
+	const FMRUKLabelFilter LabelFilter{};
+	int32 Mismatches = 0;
+	int32 NumHits = 0;
+	for (int32 i = 0; i < NumRays; ++i)
+	{
+		FMRUKHit Hit{};
+		FMRUKHit ExpectedHit{};
+		const AMRUKAnchor* Anchor = Room->Raycast(Origins[i], Directions[i], MaxDist, LabelFilter, Hit);
+		const AMRUKAnchor* ExpectedAnchor = RaycastLinear(Room, Origins[i], Directions[i], MaxDist, LabelFilter, ExpectedHit);
+		if (Anchor != ExpectedAnchor || (Anchor && !FMath::IsNearlyEqual(Hit.HitDistance, ExpectedHit.HitDistance)))
+		{
+			++Mismatches;
+		}
+		NumHits += Anchor ? 1 : 0;
+
+		TArray<FMRUKHit> Hits;
+		TArray<AMRUKAnchor*> HitAnchors;
+		Room->RaycastAll(Origins[i], Directions[i], MaxDist, LabelFilter, Hits, HitAnchors);
+		int32 ExpectedNumHits = 0;
+		for (const auto& RoomAnchor : Room->AllAnchors)
+		{
+			TArray<FMRUKHit> AnchorHits;
+			RoomAnchor->RaycastAll(Origins[i], Directions[i], MaxDist, AnchorHits, LabelFilter.ComponentTypes);
+			ExpectedNumHits += AnchorHits.Num();
+		}
+		if (Hits.Num() != ExpectedNumHits || Hits.Num() != HitAnchors.Num())
+		{
+			++Mismatches;
+		}
+	}
+	TestTrue(TEXT("Rays hit something"), NumHits > 0);
+	return TestEqual(TEXT("Raycast results equal linear scan"), Mismatches, 0);
+}
+
+void FMRUKBenchmarkSpec::Define()
+{
+	Describe(TEXT("Raycast"), [this] {
+		SetupMRUKSubsystem();
+
+		BeforeEach([this]() {
+			ToolkitSubsystem->LoadSceneFromJsonString(CreateDenseRoomJson(8));
+		});
+
+		It(TEXT("BVH matches linear scan"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			TestTrue(TEXT("Room is dense"), Room->AllAnchors.Num() > 80);
+			TestRaycastMatchesLinear(Room, 2000);
+		});
+
+		It(TEXT("BVH matches linear scan after room moved"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			Room->SetActorLocationAndRotation(FVector(120.0, -40.0, 10.0), FRotator(0.0, 35.0, 0.0));
+			TestRaycastMatchesLinear(Room, 2000);
+		});
+
+		It(TEXT("BVH matches linear scan after room update"), [this]() {
+			ToolkitSubsystem->LoadSceneFromJsonString(ExampleRoomFurnitureModifiedJson);
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			TestRaycastMatchesLinear(Room, 2000);
+		});
+
+		It(TEXT("BVH matches linear scan with unnormalized directions and a max distance"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			const float MaxDist = Room->RoomBounds.GetSize().GetMax() * 0.5f;
+			for (const double DirectionScale : { 0.25, 4.0 })
+			{
+				TestRaycastMatchesLinear(Room, 2000, MaxDist, DirectionScale);
+			}
+		});
+
+		It(TEXT("BVH raycast timing"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			constexpr int32 NumRays = 10000;
+			TArray<FVector> Origins;
+			TArray<FVector> Directions;
+			CreateRandomRays(Room->RoomBounds, NumRays, Origins, Directions);
+			const FMRUKLabelFilter LabelFilter{};
+
+			const double LinearStart = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumRays; ++i)
+			{
+				FMRUKHit Hit{};
+				RaycastLinear(Room, Origins[i], Directions[i], 0.0, LabelFilter, Hit);
+			}
+			const double LinearTime = FPlatformTime::Seconds() - LinearStart;
+
+			const double BVHStart = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumRays; ++i)
+			{
+				FMRUKHit Hit{};
+				Room->Raycast(Origins[i], Directions[i], 0.0, LabelFilter, Hit);
+			}
+			const double BVHTime = FPlatformTime::Seconds() - BVHStart;
+
+			AddInfo(FString::Printf(TEXT("%d rays against %d anchors: linear %.2f ms, BVH %.2f ms"), NumRays, Room->AllAnchors.Num(), LinearTime * 1000.0, BVHTime * 1000.0));
+		});
+
+		It(TEXT("Batch raycast matches single raycasts"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			constexpr int32 NumRays = 2000;
+			TArray<FVector> Origins;
+			TArray<FVector> Directions;
+			CreateRandomRays(Room->RoomBounds, NumRays, Origins, Directions);
+			const FMRUKLabelFilter LabelFilter{};
+
+			TArray<FMRUKHit> Hits;
+			TArray<AMRUKAnchor*> Anchors;
+			TestTrue(TEXT("Batch raycast hit something"), ToolkitSubsystem->RaycastBatch(Origins, Directions, 0.0, LabelFilter, Hits, Anchors));
+			if (!TestEqual(TEXT("Number of hits"), Hits.Num(), NumRays) || !TestEqual(TEXT("Number of anchors"), Anchors.Num(), NumRays))
+			{
+				return;
+			}
+
+			int32 Mismatches = 0;
+			for (int32 i = 0; i < NumRays; ++i)
+			{
+				FMRUKHit ExpectedHit{};
+				const AMRUKAnchor* ExpectedAnchor = ToolkitSubsystem->Raycast(Origins[i], Directions[i], 0.0, LabelFilter, ExpectedHit);
+				if (Anchors[i] != ExpectedAnchor || (ExpectedAnchor && !FMath::IsNearlyEqual(Hits[i].HitDistance, ExpectedHit.HitDistance)))
+				{
+					++Mismatches;
+				}
+			}
+			TestEqual(TEXT("Batch raycast results equal single raycasts"), Mismatches, 0);
+		});
+
+		It(TEXT("Batch raycast is faster than single raycasts"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			constexpr int32 NumRays = 10000;
+			TArray<FVector> Origins;
+			TArray<FVector> Directions;
+			CreateRandomRays(Room->RoomBounds, NumRays, Origins, Directions);
+			const FMRUKLabelFilter LabelFilter{};
+
+			const double SingleStart = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumRays; ++i)
+			{
+				FMRUKHit Hit{};
+				ToolkitSubsystem->Raycast(Origins[i], Directions[i], 0.0, LabelFilter, Hit);
+			}
+			const double SingleTime = FPlatformTime::Seconds() - SingleStart;
+
+			TArray<FMRUKHit> Hits;
+			TArray<AMRUKAnchor*> Anchors;
+			const double BatchStart = FPlatformTime::Seconds();
+			ToolkitSubsystem->RaycastBatch(Origins, Directions, 0.0, LabelFilter, Hits, Anchors);
+			const double BatchTime = FPlatformTime::Seconds() - BatchStart;
+
+			AddInfo(FString::Printf(TEXT("%d rays on %d worker threads: single %.2f ms, batch %.2f ms"), NumRays, FTaskGraphInterface::Get().GetNumWorkerThreads(), SingleTime * 1000.0, BatchTime * 1000.0));
+			if (FTaskGraphInterface::Get().GetNumWorkerThreads() > 1)
+			{
+				TestTrue(TEXT("Batch raycast is faster than single raycasts"), BatchTime < SingleTime);
+			}
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
+	Describe(TEXT("Distance field"), [this] {
+		SetupMRUKSubsystem();
+
+		BeforeEach([this]() {
+			GetMutableDefault<UMRUKSettings>()->EnableRoomDistanceField = true;
+			DenseRoomJson = CreateDenseRoomJson(8);
+			ToolkitSubsystem->LoadSceneFromJsonString(DenseRoomJson);
+		});
+
+		AfterEach([]() {
+			GetMutableDefault<UMRUKSettings>()->EnableRoomDistanceField = false;
+		});
+
+		It(TEXT("Queries match linear scan"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room) || !TestTrue(TEXT("Distance field is baked"), Room->HasDistanceField()))
+			{
+				return;
+			}
+
+			FMRUKLabelFilter WallFilter{};
+			WallFilter.IncludedLabels = { FMRUKLabels::WallFace };
+
+			FRandomStream RandomStream(1234);
+			int32 Mismatches = 0;
+			for (int32 i = 0; i < 2000; ++i)
+			{
+				const FVector Position = RandomStream.RandPointInBox(Room->RoomBounds.ExpandBy(50.0));
+				const double MaxDistance = RandomStream.FRandRange(1.0, 100.0);
+
+				for (const FMRUKLabelFilter& LabelFilter : { FMRUKLabelFilter{}, WallFilter })
+				{
+					FVector SurfacePosition;
+					double Distance = 0.0;
+					double ExpectedDistance = 0.0;
+					const AMRUKAnchor* Anchor = Room->TryGetClosestSurfacePosition(Position, SurfacePosition, Distance, LabelFilter, MaxDistance);
+					const AMRUKAnchor* ExpectedAnchor = ClosestSurfaceLinear(Room, Position, LabelFilter, MaxDistance, ExpectedDistance);
+					if (Anchor != ExpectedAnchor || !FMath::IsNearlyEqual(Distance, ExpectedDistance))
+					{
+						++Mismatches;
+					}
+				}
+
+				const double Tolerance = RandomStream.FRandRange(0.0, 50.0);
+				const AMRUKAnchor* VolumeAnchor = Room->IsPositionInSceneVolume(Position, true, Tolerance);
+				const AMRUKAnchor* ExpectedVolumeAnchor = nullptr;
+				for (const auto& Anchor : Room->AllAnchors)
+				{
+					if (Anchor->IsPositionInVolumeBounds(Position, true, Tolerance))
+					{
+						ExpectedVolumeAnchor = Anchor;
+						break;
+					}
+				}
+				if (VolumeAnchor != ExpectedVolumeAnchor)
+				{
+					++Mismatches;
+				}
+
+				double ExactDistance = 0.0;
+				ClosestSurfaceLinear(Room, Position, {}, 0.0, ExactDistance);
+				if (!FMath::IsNearlyEqual(Room->GetDistanceToClosestSurface(Position, true), ExactDistance))
+				{
+					++Mismatches;
+				}
+				if (Room->RoomBounds.IsInside(Position))
+				{
+					TestNearlyEqual(TEXT("Approximate distance"), Room->GetDistanceToClosestSurface(Position, false), ExactDistance, Room->DistanceField->GetMaxError());
+				}
+			}
+			TestEqual(TEXT("Distance field queries equal linear scan"), Mismatches, 0);
+		});
+
+		It(TEXT("Reloading the room reuses the distance field"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			const FMRUKRoomDistanceField* DistanceField = Room->DistanceField.Get();
+
+			ToolkitSubsystem->ClearScene();
+			ToolkitSubsystem->LoadSceneFromJsonString(DenseRoomJson);
+
+			Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+			TestTrue(TEXT("Distance field comes from the cache"), Room->DistanceField.Get() == DistanceField);
+		});
+
+		It(TEXT("Distance field cache is keyed by the anchors in room space"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room) || !TestTrue(TEXT("Room has anchors"), Room->AllAnchors.Num() > 0))
+			{
+				return;
+			}
+			const double VoxelSize = GetDefault<UMRUKSettings>()->RoomDistanceFieldVoxelSize;
+			const FMRUKRoomDistanceField* DistanceField = Room->DistanceField.Get();
+
+			Room->SetActorLocationAndRotation(FVector(120.0, -40.0, 10.0), FRotator(0.0, 35.0, 0.0));
+			TestTrue(TEXT("Moving the room keeps the distance field"), ToolkitSubsystem->GetOrBakeRoomDistanceField(Room, VoxelSize).Get() == DistanceField);
+
+			AMRUKAnchor* Anchor = Room->AllAnchors[0];
+			const FTransform AnchorTransform = Anchor->GetRootComponent()->GetRelativeTransform();
+			Anchor->AddActorLocalOffset(FVector(0.0, 0.0, 10.0));
+			TestTrue(TEXT("Moving an anchor bakes a new distance field"), ToolkitSubsystem->GetOrBakeRoomDistanceField(Room, VoxelSize).Get() != DistanceField);
+
+			Anchor->SetActorRelativeTransform(AnchorTransform);
+			TestTrue(TEXT("Moving the anchor back finds the distance field again"), ToolkitSubsystem->GetOrBakeRoomDistanceField(Room, VoxelSize).Get() == DistanceField);
+		});
+
+		It(TEXT("Random position generation is faster with distance field"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			constexpr int32 NumPositions = 500;
+			const auto GeneratePositions = [Room]() {
+				const FRandomStream RandomStream(1234);
+				const double StartTime = FPlatformTime::Seconds();
+				for (int32 i = 0; i < NumPositions; ++i)
+				{
+					FVector Position;
+					Room->GenerateRandomPositionInRoomFromStream(Position, RandomStream, 30.0f, true);
+				}
+				return FPlatformTime::Seconds() - StartTime;
+			};
+
+			const double DistanceFieldTime = GeneratePositions();
+			const TSharedPtr<const FMRUKRoomDistanceField> DistanceField = Room->DistanceField;
+			Room->DistanceField.Reset();
+			const double LinearTime = GeneratePositions();
+			Room->DistanceField = DistanceField;
+
+			AddInfo(FString::Printf(TEXT("%d random positions in room with %d anchors: linear %.2f ms, distance field %.2f ms"), NumPositions, Room->AllAnchors.Num(), LinearTime * 1000.0, DistanceFieldTime * 1000.0));
+			TestTrue(TEXT("Distance field is faster than linear scan"), DistanceFieldTime < LinearTime);
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
+	Describe(TEXT("Binary scene"), [this] {
+		SetupMRUKSubsystem();
+
+		BeforeEach([this]() {
+			DenseRoomJson = CreateDenseRoomJson(8);
+			ToolkitSubsystem->LoadSceneFromJsonString(DenseRoomJson);
+		});
+
+		It(TEXT("Round trip matches JSON"), [this]() {
+			const TMap<FString, FTransform> ExpectedTransforms = GetAnchorTransforms(ToolkitSubsystem);
+			const TArray<uint8> Data = ToolkitSubsystem->SaveSceneToBinary();
+			TestTrue(TEXT("Data is a binary scene"), MRUKBinary::IsBinaryScene(Data));
+
+			ToolkitSubsystem->ClearScene();
+			ToolkitSubsystem->LoadSceneFromBinary(Data);
+			if (!TestTrue(TEXT("Scene is loaded"), ToolkitSubsystem->SceneLoadStatus == EMRUKInitStatus::Complete))
+			{
+				return;
+			}
+
+			const TMap<FString, FTransform> Transforms = GetAnchorTransforms(ToolkitSubsystem);
+			TestEqual(TEXT("Number of anchors"), Transforms.Num(), ExpectedTransforms.Num());
+			for (const auto& [UUID, ExpectedTransform] : ExpectedTransforms)
+			{
+				const FTransform* Transform = Transforms.Find(UUID);
+				if (!TestNotNull(FString::Printf(TEXT("Anchor %s is loaded"), *UUID), Transform))
+				{
+					continue;
+				}
+				TestTrue(FString::Printf(TEXT("Transform of anchor %s"), *UUID), Transform->Equals(ExpectedTransform));
+			}
+		});
+
+		It(TEXT("Loading a JSON file falls back to JSON"), [this]() {
+			const int32 ExpectedNumAnchors = GetAnchorTransforms(ToolkitSubsystem).Num();
+			const FString FilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKScene"), TEXT(".json"));
+			FFileHelper::SaveStringToFile(DenseRoomJson, *FilePath);
+
+			ToolkitSubsystem->ClearScene();
+			TestTrue(TEXT("File is loaded"), ToolkitSubsystem->LoadSceneFromBinaryFile(FilePath));
+			TestEqual(TEXT("Number of anchors"), GetAnchorTransforms(ToolkitSubsystem).Num(), ExpectedNumAnchors);
+
+			IFileManager::Get().Delete(*FilePath);
+		});
+
+		It(TEXT("Loading a file fails while a scene is loading"), [this]() {
+			const FString FilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKScene"), TEXT(".mruk"));
+			if (!TestTrue(TEXT("File is saved"), ToolkitSubsystem->SaveSceneToBinaryFile(FilePath)))
+			{
+				return;
+			}
+			const FString JsonFilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKScene"), TEXT(".json"));
+			FFileHelper::SaveStringToFile(DenseRoomJson, *JsonFilePath);
+
+			AddExpectedError(TEXT("while the scene is already loading"), EAutomationExpectedErrorFlags::Contains, 2);
+			ToolkitSubsystem->SceneLoadStatus = EMRUKInitStatus::Busy;
+			TestFalse(TEXT("Binary file is not loaded"), ToolkitSubsystem->LoadSceneFromBinaryFile(FilePath));
+			TestFalse(TEXT("JSON file is not loaded"), ToolkitSubsystem->LoadSceneFromBinaryFile(JsonFilePath));
+			ToolkitSubsystem->SceneLoadStatus = EMRUKInitStatus::Complete;
+
+			IFileManager::Get().Delete(*FilePath);
+			IFileManager::Get().Delete(*JsonFilePath);
+		});
+
+		It(TEXT("Loading binary is faster than JSON"), [this]() {
+			const FString FilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKScene"), TEXT(".mruk"));
+			if (!TestTrue(TEXT("File is saved"), ToolkitSubsystem->SaveSceneToBinaryFile(FilePath)))
+			{
+				return;
+			}
+
+			constexpr int32 NumIterations = 10;
+			double JsonTime = 0.0;
+			double BinaryTime = 0.0;
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				ToolkitSubsystem->ClearScene();
+				double StartTime = FPlatformTime::Seconds();
+				ToolkitSubsystem->LoadSceneFromJsonString(DenseRoomJson);
+				JsonTime += FPlatformTime::Seconds() - StartTime;
+
+				ToolkitSubsystem->ClearScene();
+				StartTime = FPlatformTime::Seconds();
+				ToolkitSubsystem->LoadSceneFromBinaryFile(FilePath);
+				BinaryTime += FPlatformTime::Seconds() - StartTime;
+			}
+			IFileManager::Get().Delete(*FilePath);
+
+			AddInfo(FString::Printf(TEXT("Loading a room with %d anchors: JSON %.2f ms, binary %.2f ms"), GetAnchorTransforms(ToolkitSubsystem).Num(), JsonTime * 1000.0 / NumIterations, BinaryTime * 1000.0 / NumIterations));
+			TestTrue(TEXT("Binary is faster than JSON"), BinaryTime < JsonTime);
+		});
+
+		It(TEXT("Global mesh loads faster from binary than from JSON"), [this]() {
+			const AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			TArray<FVector> Positions;
+			TArray<int32> Indices;
+			CreateGridMesh(256, Positions, Indices);
+
+			// Binary file with a room that only contains the global mesh anchor
+			TArray<uint8> Blobs;
+			TArray<MRUKBinary::FRoomRecord> Rooms;
+			MRUKBinary::FRoomRecord& RoomRecord = Rooms.AddDefaulted_GetRef();
+			RoomRecord.UUID = Room->AnchorUUID;
+			MRUKBinary::FAnchorRecord& AnchorRecord = RoomRecord.Anchors.AddDefaulted_GetRef();
+			AnchorRecord.SemanticClassifications = { FMRUKLabels::GlobalMesh };
+			AnchorRecord.GlobalMesh.NumPositions = Positions.Num();
+			AnchorRecord.GlobalMesh.NumIndices = Indices.Num();
+			AnchorRecord.GlobalMesh.PositionsOffset = MRUKBinary::AppendBlob(Blobs, Positions.GetData(), Positions.NumBytes());
+			AnchorRecord.GlobalMesh.IndicesOffset = MRUKBinary::AppendBlob(Blobs, Indices.GetData(), Indices.NumBytes());
+			const FString BinaryFilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKGlobalMesh"), TEXT(".mruk"));
+			FFileHelper::SaveArrayToFile(MRUKBinary::WriteScene(Rooms, Blobs), *BinaryFilePath);
+
+			// The same data as JSON
+			const FString JsonFilePath = FPaths::CreateTempFilename(*FPaths::ProjectIntermediateDir(), TEXT("MRUKGlobalMesh"), TEXT(".json"));
+			FFileHelper::SaveStringToFile(AddGlobalMeshJson(TEXT("{\"Rooms\":[]}"), Room->AnchorUUID.ToString(), Positions, Indices), *JsonFilePath);
+
+			UProceduralMeshComponent* JsonMesh = NewObject<UProceduralMeshComponent>(GetTransientPackage());
+			double StartTime = FPlatformTime::Seconds();
+			const bool JsonLoaded = UMRUKBPLibrary::LoadGlobalMeshFromBinaryFile(JsonFilePath, Room->AnchorUUID, JsonMesh, false);
+			const double JsonTime = FPlatformTime::Seconds() - StartTime;
+
+			UProceduralMeshComponent* BinaryMesh = NewObject<UProceduralMeshComponent>(GetTransientPackage());
+			StartTime = FPlatformTime::Seconds();
+			const bool BinaryLoaded = UMRUKBPLibrary::LoadGlobalMeshFromBinaryFile(BinaryFilePath, Room->AnchorUUID, BinaryMesh, false);
+			const double BinaryTime = FPlatformTime::Seconds() - StartTime;
+
+			IFileManager::Get().Delete(*JsonFilePath);
+			IFileManager::Get().Delete(*BinaryFilePath);
+
+			if (!TestTrue(TEXT("JSON global mesh is loaded"), JsonLoaded) || !TestTrue(TEXT("Binary global mesh is loaded"), BinaryLoaded))
+			{
+				return;
+			}
+
+			const FProcMeshSection* Section = BinaryMesh->GetProcMeshSection(0);
+			if (TestEqual(TEXT("Number of vertices"), Section->ProcVertexBuffer.Num(), Positions.Num()))
+			{
+				int32 Mismatches = 0;
+				for (int32 i = 0; i < Positions.Num(); ++i)
+				{
+					Mismatches += Section->ProcVertexBuffer[i].Position == Positions[i] ? 0 : 1;
+				}
+				TestEqual(TEXT("Vertex positions"), Mismatches, 0);
+			}
+			TestTrue(TEXT("Indices"), Section->ProcIndexBuffer == JsonMesh->GetProcMeshSection(0)->ProcIndexBuffer);
+
+			AddInfo(FString::Printf(TEXT("Loading global mesh with %d vertices: JSON %.2f ms, binary %.2f ms"), Positions.Num(), JsonTime * 1000.0, BinaryTime * 1000.0));
+			TestTrue(TEXT("Binary is faster than JSON"), BinaryTime < JsonTime);
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
+	Describe(TEXT("JSON loading"), [this] {
+		SetupMRUKSubsystem();
+
+		It(TEXT("Streaming loader loads all rooms and anchors of the fixtures"), [this]() {
+			for (const TCHAR* Json : { ExampleRoomJson, ExampleRoomFurnitureAddedJson, ExampleRoomMoreFurnitureAddedJson, ExampleRoomFurnitureModifiedJson, ExampleOtherRoomJson })
+			{
+				TSharedPtr<FJsonObject> JsonObject;
+				if (!TestTrue(TEXT("Fixture is valid JSON"), FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), JsonObject)))
+				{
+					continue;
+				}
+				TMap<FString, int32> ExpectedAnchors;
+				for (const auto& RoomJson : JsonObject->GetArrayField(TEXT("Rooms")))
+				{
+					for (const auto& AnchorJson : RoomJson->AsObject()->GetArrayField(TEXT("Anchors")))
+					{
+						const TArray<TSharedPtr<FJsonValue>>* Boundary = nullptr;
+						AnchorJson->AsObject()->TryGetArrayField(TEXT("PlaneBoundary2D"), Boundary);
+						ExpectedAnchors.Add(AnchorJson->AsObject()->GetStringField(TEXT("UUID")).ToUpper(), Boundary ? Boundary->Num() : 0);
+					}
+				}
+
+				UMRUKSceneData* SceneData = NewObject<UMRUKSceneData>(GetTransientPackage());
+				SceneData->LoadFromJson(Json);
+				TestEqual(TEXT("Number of rooms"), SceneData->RoomsData.Num(), JsonObject->GetArrayField(TEXT("Rooms")).Num());
+				int32 NumAnchors = 0;
+				for (const auto& RoomData : SceneData->RoomsData)
+				{
+					TestEqual(TEXT("Room object UUIDs"), RoomData->RoomLayout.RoomObjectUUIDs.Num(), RoomData->AnchorsData.Num());
+					for (const auto& AnchorData : RoomData->AnchorsData)
+					{
+						const int32* NumBoundaryPoints = ExpectedAnchors.Find(AnchorData->SpaceQuery.UUID.ToString().ToUpper());
+						if (TestNotNull(TEXT("Anchor is in the fixture"), NumBoundaryPoints))
+						{
+							TestEqual(TEXT("Number of boundary points"), AnchorData->PlaneBoundary2D.Num(), *NumBoundaryPoints);
+						}
+						++NumAnchors;
+					}
+				}
+				TestEqual(TEXT("Number of anchors"), NumAnchors, ExpectedAnchors.Num());
+			}
+		});
+
+		It(TEXT("Malformed JSON fails to load"), [this]() {
+			ToolkitSubsystem->ClearScene();
+			AddExpectedError(TEXT("Could not deserialize JSON scene data"), EAutomationExpectedErrorFlags::Contains, 0);
+			ToolkitSubsystem->LoadSceneFromJsonString(FString(ExampleRoomJson).LeftChop(20));
+			TestTrue(TEXT("Scene failed to load"), ToolkitSubsystem->SceneLoadStatus == EMRUKInitStatus::Failed);
+		});
+
+		It(TEXT("Streaming is faster than building a JSON DOM"), [this]() {
+			TArray<FVector> Positions;
+			TArray<int32> Indices;
+			CreateGridMesh(128, Positions, Indices);
+
+			// Scan of the dense room together with its global mesh
+			const FString DenseJson = CreateDenseRoomJson(8);
+			TSharedPtr<FJsonObject> DenseJsonObject;
+			FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(DenseJson), DenseJsonObject);
+			const FString RoomUUID = DenseJsonObject->GetArrayField(TEXT("Rooms"))[0]->AsObject()->GetStringField(TEXT("UUID"));
+			const FString Json = AddGlobalMeshJson(DenseJson, RoomUUID, Positions, Indices);
+
+			constexpr int32 NumIterations = 5;
+			double DomTime = 0.0;
+			double StreamingTime = 0.0;
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				// This is what the scene loader had to do before it could look at the first anchor
+				double StartTime = FPlatformTime::Seconds();
+				TSharedPtr<FJsonValue> JsonValue;
+				FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), JsonValue);
+				DomTime += FPlatformTime::Seconds() - StartTime;
+				JsonValue.Reset();
+
+				StartTime = FPlatformTime::Seconds();
+				UMRUKSceneData* SceneData = NewObject<UMRUKSceneData>(GetTransientPackage());
+				SceneData->LoadFromJson(Json);
+				StreamingTime += FPlatformTime::Seconds() - StartTime;
+				TestEqual(TEXT("Number of rooms"), SceneData->RoomsData.Num(), 1);
+			}
+
+			AddInfo(FString::Printf(TEXT("Loading %d KB of scene JSON: DOM %.2f ms, streaming %.2f ms"), Json.Len() / 1024, DomTime * 1000.0 / NumIterations, StreamingTime * 1000.0 / NumIterations));
+			TestTrue(TEXT("Streaming is faster than building a JSON DOM"), StreamingTime < DomTime);
+
+			const double StartTime = FPlatformTime::Seconds();
+			UProceduralMeshComponent* Mesh = NewObject<UProceduralMeshComponent>(GetTransientPackage());
+			FOculusXRUUID AnchorUUID;
+			HexToBytes(RoomUUID, AnchorUUID.UUIDBytes);
+			if (TestTrue(TEXT("Global mesh is loaded"), UMRUKBPLibrary::LoadGlobalMeshFromJsonString(Json, AnchorUUID, Mesh, false)))
+			{
+				TestEqual(TEXT("Number of vertices"), Mesh->GetProcMeshSection(0)->ProcVertexBuffer.Num(), Positions.Num());
+				TestEqual(TEXT("Number of indices"), Mesh->GetProcMeshSection(0)->ProcIndexBuffer.Num(), Indices.Num());
+			}
+			AddInfo(FString::Printf(TEXT("Loading global mesh with %d vertices from JSON: %.2f ms"), Positions.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0));
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
+	Describe(TEXT("Procedural mesh"), [this] {
+		SetupMRUKSubsystem();
+
+		BeforeEach([this]() {
+			ToolkitSubsystem->LoadSceneFromJsonString(CreateDenseRoomJson(8));
+		});
+
+		It(TEXT("Async generation matches synchronous generation"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			const TArray<FString> CutHoleLabels = { FMRUKLabels::WindowFrame, FMRUKLabels::DoorFrame };
+			TArray<FMRUKPlaneUV> PlaneUVAdjustments;
+			PlaneUVAdjustments.SetNum(2);
+			PlaneUVAdjustments[0].Offset = FVector2D(0.1, 0.2);
+			PlaneUVAdjustments[0].Scale = FVector2D(2.0, 3.0);
+			TArray<TPair<UProceduralMeshComponent*, UProceduralMeshComponent*>> Meshes;
+			for (const auto& Anchor : Room->AllAnchors)
+			{
+				UProceduralMeshComponent* SyncMesh = NewObject<UProceduralMeshComponent>(Anchor);
+				UProceduralMeshComponent* AsyncMesh = NewObject<UProceduralMeshComponent>(Anchor);
+				Anchor->GenerateProceduralAnchorMesh(SyncMesh, PlaneUVAdjustments, CutHoleLabels, false, false, 1.0);
+				Anchor->GenerateProceduralAnchorMeshAsync(AsyncMesh, PlaneUVAdjustments, CutHoleLabels, false, false, 1.0);
+				Meshes.Emplace(SyncMesh, AsyncMesh);
+			}
+			TestEqual(TEXT("Meshes are queued"), ToolkitSubsystem->GetProceduralMeshQueue().Num(), Meshes.Num());
+			ToolkitSubsystem->GetProceduralMeshQueue().Flush();
+			TestTrue(TEXT("Queue is empty"), ToolkitSubsystem->GetProceduralMeshQueue().IsEmpty());
+
+			int32 Mismatches = 0;
+			for (const auto& [SyncMesh, AsyncMesh] : Meshes)
+			{
+				if (SyncMesh->GetNumSections() != AsyncMesh->GetNumSections())
+				{
+					++Mismatches;
+					continue;
+				}
+				for (int32 SectionIndex = 0; SectionIndex < SyncMesh->GetNumSections(); ++SectionIndex)
+				{
+					const FProcMeshSection* SyncSection = SyncMesh->GetProcMeshSection(SectionIndex);
+					const FProcMeshSection* AsyncSection = AsyncMesh->GetProcMeshSection(SectionIndex);
+					if (SyncSection->ProcIndexBuffer != AsyncSection->ProcIndexBuffer || SyncSection->ProcVertexBuffer.Num() != AsyncSection->ProcVertexBuffer.Num())
+					{
+						++Mismatches;
+						continue;
+					}
+					for (int32 i = 0; i < SyncSection->ProcVertexBuffer.Num(); ++i)
+					{
+						const FProcMeshVertex& SyncVertex = SyncSection->ProcVertexBuffer[i];
+						const FProcMeshVertex& AsyncVertex = AsyncSection->ProcVertexBuffer[i];
+						if (SyncVertex.Position != AsyncVertex.Position || SyncVertex.UV0 != AsyncVertex.UV0 || SyncVertex.UV1 != AsyncVertex.UV1)
+						{
+							++Mismatches;
+						}
+					}
+				}
+			}
+			TestEqual(TEXT("Async meshes equal sync meshes"), Mismatches, 0);
+		});
+
+		It(TEXT("Only the latest mesh of a component is committed"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			FMRUKProceduralMeshQueue& Queue = ToolkitSubsystem->GetProceduralMeshQueue();
+			TArray<TPair<UProceduralMeshComponent*, UProceduralMeshComponent*>> Meshes;
+			for (const auto& Anchor : Room->AllAnchors)
+			{
+				UProceduralMeshComponent* ExpectedMesh = NewObject<UProceduralMeshComponent>(Anchor);
+				UProceduralMeshComponent* AsyncMesh = NewObject<UProceduralMeshComponent>(Anchor);
+				Anchor->GenerateProceduralAnchorMesh(ExpectedMesh, {}, {}, false, false, 5.0);
+				// The first mesh may well finish after the second one, it must not be committed either way
+				Anchor->GenerateProceduralAnchorMeshAsync(AsyncMesh, {}, {}, false, false, 1.0);
+				Anchor->GenerateProceduralAnchorMeshAsync(AsyncMesh, {}, {}, false, false, 5.0);
+				Meshes.Emplace(ExpectedMesh, AsyncMesh);
+			}
+			TestEqual(TEXT("One mesh is queued per component"), Queue.Num(), Meshes.Num());
+
+			// Meshes created synchronously replace the pending ones
+			UProceduralMeshComponent* SyncMesh = NewObject<UProceduralMeshComponent>(Room->AllAnchors[0]);
+			Room->AllAnchors[0]->GenerateProceduralAnchorMeshAsync(SyncMesh, {}, {}, false, false, 1.0);
+			Room->AllAnchors[0]->GenerateProceduralAnchorMesh(SyncMesh, {}, {}, false, false, 5.0);
+			Meshes.Emplace(Meshes[0].Key, SyncMesh);
+			TestEqual(TEXT("Synchronous mesh cancels the pending one"), Queue.Num(), Meshes.Num() - 1);
+
+			while (!Queue.IsEmpty())
+			{
+				if (Queue.Commit(0.001) == 0)
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+
+			int32 Mismatches = 0;
+			for (const auto& [ExpectedMesh, Mesh] : Meshes)
+			{
+				if (ExpectedMesh->GetNumSections() != Mesh->GetNumSections())
+				{
+					++Mismatches;
+					continue;
+				}
+				for (int32 SectionIndex = 0; SectionIndex < ExpectedMesh->GetNumSections(); ++SectionIndex)
+				{
+					const FProcMeshSection* ExpectedSection = ExpectedMesh->GetProcMeshSection(SectionIndex);
+					const FProcMeshSection* Section = Mesh->GetProcMeshSection(SectionIndex);
+					if (ExpectedSection->ProcIndexBuffer != Section->ProcIndexBuffer || ExpectedSection->ProcVertexBuffer.Num() != Section->ProcVertexBuffer.Num())
+					{
+						++Mismatches;
+						continue;
+					}
+					for (int32 i = 0; i < ExpectedSection->ProcVertexBuffer.Num(); ++i)
+					{
+						if (ExpectedSection->ProcVertexBuffer[i].Position != Section->ProcVertexBuffer[i].Position)
+						{
+							++Mismatches;
+						}
+					}
+				}
+			}
+			TestEqual(TEXT("Committed meshes equal the latest requested mesh"), Mismatches, 0);
+		});
+
+		It(TEXT("Async generation takes less time on the game thread per frame"), [this]() {
+			AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+			if (!TestNotNull(TEXT("Current room is set"), Room))
+			{
+				return;
+			}
+
+			const TArray<FString> CutHoleLabels = { FMRUKLabels::WindowFrame, FMRUKLabels::DoorFrame };
+			double StartTime = FPlatformTime::Seconds();
+			for (const auto& Anchor : Room->AllAnchors)
+			{
+				Anchor->GenerateProceduralAnchorMesh(NewObject<UProceduralMeshComponent>(Anchor), {}, CutHoleLabels, false, true);
+			}
+			const double SyncTime = FPlatformTime::Seconds() - StartTime;
+
+			FMRUKProceduralMeshQueue& Queue = ToolkitSubsystem->GetProceduralMeshQueue();
+			StartTime = FPlatformTime::Seconds();
+			for (const auto& Anchor : Room->AllAnchors)
+			{
+				Anchor->GenerateProceduralAnchorMeshAsync(NewObject<UProceduralMeshComponent>(Anchor), {}, CutHoleLabels, false, true);
+			}
+			const double EnqueueTime = FPlatformTime::Seconds() - StartTime;
+
+			// Simulate frames with a budget of 1 ms
+			int32 NumFrames = 0;
+			double MaxFrameTime = 0.0;
+			while (!Queue.IsEmpty())
+			{
+				StartTime = FPlatformTime::Seconds();
+				if (Queue.Commit(0.001) > 0)
+				{
+					MaxFrameTime = FMath::Max(MaxFrameTime, FPlatformTime::Seconds() - StartTime);
+					++NumFrames;
+				}
+				else
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+
+			AddInfo(FString::Printf(TEXT("Generating %d anchor meshes: sync %.2f ms, async enqueue %.2f ms + %d frames of at most %.2f ms"), Room->AllAnchors.Num(), SyncTime * 1000.0, EnqueueTime * 1000.0, NumFrames, MaxFrameTime * 1000.0));
+			TestTrue(TEXT("Longest frame of async generation is shorter than sync generation"), EnqueueTime + MaxFrameTime < SyncTime);
+		});
+
+		TeardownMRUKSubsystem();
+	});
+
+	Describe(TEXT("Point in polygon"), [this] {
+		It(TEXT("Grid matches linear scan"), [this]() {
+			const TArray<FVector2D> Boundary = CreateStarBoundary(512);
+			FMRUKPolygonGrid Grid;
+			Grid.Build(Boundary);
+
+			// Extend the bounds so that positions outside of the polygon are tested as well
+			const TArray<FVector2D> Positions = CreateRandomPositions(FBox2D(Boundary).ExpandBy(20.0), 100000);
+			TArray<bool> BatchInside;
+			Grid.IsInside(Positions, BatchInside);
+
+			int32 NumInside = 0;
+			int32 SingleMismatches = 0;
+			int32 BatchMismatches = 0;
+			for (int32 i = 0; i < Positions.Num(); ++i)
+			{
+				const bool Inside = IsPositionInBoundaryLinear(Boundary, Positions[i]);
+				NumInside += Inside ? 1 : 0;
+				SingleMismatches += Grid.IsInside(Positions[i]) != Inside ? 1 : 0;
+				BatchMismatches += BatchInside[i] != Inside ? 1 : 0;
+			}
+			TestTrue(TEXT("Some positions are inside"), NumInside > 0 && NumInside < Positions.Num());
+			TestEqual(TEXT("Grid results equal linear scan"), SingleMismatches, 0);
+			TestEqual(TEXT("Batch results equal linear scan"), BatchMismatches, 0);
+		});
+
+		It(TEXT("Grid is faster than linear scan"), [this]() {
+			const TArray<FVector2D> Boundary = CreateStarBoundary(512);
+			const TArray<FVector2D> Positions = CreateRandomPositions(FBox2D(Boundary), 100000);
+
+			double StartTime = FPlatformTime::Seconds();
+			int32 NumLinear = 0;
+			for (const FVector2D& Position : Positions)
+			{
+				NumLinear += IsPositionInBoundaryLinear(Boundary, Position) ? 1 : 0;
+			}
+			const double LinearTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			FMRUKPolygonGrid Grid;
+			Grid.Build(Boundary);
+			const double BuildTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			int32 NumGrid = 0;
+			for (const FVector2D& Position : Positions)
+			{
+				NumGrid += Grid.IsInside(Position) ? 1 : 0;
+			}
+			const double GridTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			TArray<bool> BatchInside;
+			Grid.IsInside(Positions, BatchInside);
+			const double BatchTime = FPlatformTime::Seconds() - StartTime;
+
+			AddInfo(FString::Printf(TEXT("%d positions against %d vertices: linear %.2f ms, grid build %.3f ms, grid %.2f ms, batch %.2f ms"), Positions.Num(), Boundary.Num(), LinearTime * 1000.0, BuildTime * 1000.0, GridTime * 1000.0, BatchTime * 1000.0));
+			TestEqual(TEXT("Grid and linear scan agree"), NumGrid, NumLinear);
+			TestTrue(TEXT("Grid is faster than linear scan"), BuildTime + GridTime < LinearTime);
+			TestTrue(TEXT("Batch is faster than linear scan"), BuildTime + BatchTime < LinearTime);
+		});
+
+		Describe(TEXT("Room"), [this] {
+			SetupMRUKSubsystem();
+
+			BeforeEach([this]() {
+				ToolkitSubsystem->LoadSceneFromJsonString(ExampleRoomJson);
+			});
+
+			It(TEXT("Batch room test matches single room test"), [this]() {
+				AMRUKRoom* Room = ToolkitSubsystem->GetCurrentRoom();
+				if (!TestNotNull(TEXT("Current room is set"), Room))
+				{
+					return;
+				}
+
+				FRandomStream RandomStream(5);
+				const FBox Bounds = Room->RoomBounds.ExpandBy(50.0);
+				TArray<FVector> Positions;
+				for (int32 i = 0; i < 10000; ++i)
+				{
+					Positions.Emplace(RandomStream.FRandRange(Bounds.Min.X, Bounds.Max.X), RandomStream.FRandRange(Bounds.Min.Y, Bounds.Max.Y), RandomStream.FRandRange(Bounds.Min.Z, Bounds.Max.Z));
+				}
+
+				TArray<bool> InRoom;
+				Room->IsPositionInRoomBatch(Positions, InRoom);
+				int32 NumInRoom = 0;
+				int32 Mismatches = 0;
+				for (int32 i = 0; i < Positions.Num(); ++i)
+				{
+					const bool Inside = Room->IsPositionInRoom(Positions[i]);
+					NumInRoom += Inside ? 1 : 0;
+					Mismatches += InRoom[i] != Inside ? 1 : 0;
+				}
+				TestTrue(TEXT("Some positions are in the room"), NumInRoom > 0);
+				TestEqual(TEXT("Batch results equal single results"), Mismatches, 0);
+			});
+
+			TeardownMRUKSubsystem();
+		});
+	});
+}
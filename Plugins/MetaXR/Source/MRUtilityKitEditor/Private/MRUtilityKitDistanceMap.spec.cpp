@@ -2,11 +2,14 @@
 
 #include "DistanceMapTestData.h"
 #include "MRUtilityKitDistanceMapGenerator.h"
+#include "MRUtilityKitAnchor.h"
+#include "MRUtilityKitRoom.h"
 #include "MRUtilityKitSubsystem.h"
 #include "TestHelper.h"
 #include "UnrealEdGlobals.h"
 #include "Editor/UnrealEdEngine.h"
 #include "Engine/CanvasRenderTarget2D.h"
+#include "Engine/Texture2D.h"
 #include "Tests/AutomationEditorCommon.h"
 #include "HAL/PlatformFileManager.h"
 #include "Editor.h"
@@ -191,6 +194,76 @@ void FMRUKDistanceMapSpec::Define()
 			}
 		});
 
+		It(TEXT("Compute distance map on CPU"), [this] {
+			const auto World = GEditor->GetPIEWorldContext()->World();
+			const auto GameInstance = World->GetGameInstance();
+			UMRUKSubsystem* Subsystem = GameInstance->GetSubsystem<UMRUKSubsystem>();
+			Subsystem->LoadSceneFromJsonString(ExampleRoomJson);
+			AMRUKRoom* Room = Subsystem->GetCurrentRoom();
+
+			const FActorSpawnParameters Params{};
+			AMRUKDistanceMapGenerator* DistanceMapGenerator = World->SpawnActor<AMRUKDistanceMapGenerator>(Params);
+			DistanceMapGenerator->SetActorLocation(FVector(0.0, 0.0, 200.0));
+			DistanceMapGenerator->SetActorRotation(FRotator::MakeFromEuler(FVector(0.0, -90.0, 0.0)));
+			DistanceMapGenerator->Backend = EMRUKDistanceMapBackend::CPU;
+			DistanceMapGenerator->DistanceMapGenerationMode = EMRUKDistanceMapGenerationMode::AllSpace;
+			DistanceMapGenerator->CPUResolution = 128;
+
+			UTexture2D* Texture = Cast<UTexture2D>(DistanceMapGenerator->CaptureDistanceMap());
+			if (TestNotNull(TEXT("Distance map texture"), Texture))
+			{
+				TestEqual(TEXT("Texture size"), Texture->GetSizeX(), 128);
+				TestEqual(TEXT("Texture format"), Texture->GetPixelFormat(), PF_R32_FLOAT);
+			}
+
+			// Compare the sign of the distance with the footprints of the room. Positions close to the border
+			// are skipped since the rasterization can't resolve them.
+			const double OrthoWidth = DistanceMapGenerator->SceneCapture2D->OrthoWidth;
+			const double Tolerance = 2.0 * OrthoWidth / DistanceMapGenerator->CPUResolution;
+			const double Z = Room->FloorAnchor->GetActorLocation().Z + 10.0;
+			int32 NumFree = 0;
+			int32 NumOccupied = 0;
+			for (double X = -0.45 * OrthoWidth; X <= 0.45 * OrthoWidth; X += 8.0)
+			{
+				for (double Y = -0.45 * OrthoWidth; Y <= 0.45 * OrthoWidth; Y += 8.0)
+				{
+					const FVector Position(X, Y, Z);
+					const float Distance = DistanceMapGenerator->SampleDistance(Position);
+					if (FMath::Abs(Distance) < Tolerance)
+					{
+						continue;
+					}
+					bool Free = Room->IsPositionInRoom(Position, false);
+					for (AMRUKAnchor* Anchor : Room->AllAnchors)
+					{
+						Free = Free && !Anchor->IsPositionInVolumeBounds(Position, false);
+					}
+					if (!TestEqual(FString::Printf(TEXT("Free space at %s"), *Position.ToString()), Distance > 0.0f, Free))
+					{
+						return;
+					}
+					if (Free)
+					{
+						++NumFree;
+					}
+					else
+					{
+						++NumOccupied;
+					}
+				}
+			}
+			TestTrue(TEXT("Has free space"), NumFree > 0);
+			TestTrue(TEXT("Has occupied space"), NumOccupied > 0);
+
+			// The generation mode only changes how the signed distance is interpreted
+			const FVector RoomCenter = Room->RoomBounds.GetCenter();
+			const float SignedDistance = DistanceMapGenerator->SampleDistance(RoomCenter);
+			DistanceMapGenerator->DistanceMapGenerationMode = EMRUKDistanceMapGenerationMode::FreeSpace;
+			TestEqual(TEXT("Free space distance"), DistanceMapGenerator->SampleDistance(RoomCenter), FMath::Max(SignedDistance, 0.0f));
+			DistanceMapGenerator->DistanceMapGenerationMode = EMRUKDistanceMapGenerationMode::OccupiedSpace;
+			TestEqual(TEXT("Occupied space distance"), DistanceMapGenerator->SampleDistance(RoomCenter), FMath::Max(-SignedDistance, 0.0f));
+		});
+
 		// Caution: Order of these statements is important
 
 		AfterEach(EAsyncExecution::ThreadPool, []() {
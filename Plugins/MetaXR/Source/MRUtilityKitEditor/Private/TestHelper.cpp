@@ -2638,6 +2638,15 @@ void URoomAndAnchorObserver::OnAnchorRemoved(AMRUKAnchor* Anchor)
 	AnchorsRemoved.Push(Anchor);
 }
 
+void URoomAndAnchorObserver::OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change)
+{
+	if (Change == EMRUKAnchorChange::Pose)
+	{
+		AnchorsMoved.Push(Anchor);
+	}
+	AnchorChanges.Push(Change);
+}
+
 void URoomAndAnchorObserver::OnRoomCreated(AMRUKRoom* Room)
 {
 	RoomsCreated.Push(Room);
@@ -2658,6 +2667,8 @@ void URoomAndAnchorObserver::Clear()
 	AnchorsCreated.Empty();
 	AnchorsUpdated.Empty();
 	AnchorsRemoved.Empty();
+	AnchorsMoved.Empty();
+	AnchorChanges.Empty();
 	RoomsCreated.Empty();
 	RoomsUpdated.Empty();
 	RoomsRemoved.Empty();
@@ -21,6 +21,10 @@ public:
 	TArray<AMRUKAnchor*> AnchorsUpdated;
 	UPROPERTY()
 	TArray<AMRUKAnchor*> AnchorsRemoved;
+	UPROPERTY()
+	TArray<AMRUKAnchor*> AnchorsMoved;
+	UPROPERTY()
+	TArray<EMRUKAnchorChange> AnchorChanges;
 
 	UPROPERTY()
 	TArray<AMRUKRoom*> RoomsCreated;
@@ -36,6 +40,8 @@ public:
 	UFUNCTION()
 	void OnAnchorRemoved(AMRUKAnchor* Anchor);
 	UFUNCTION()
+	void OnAnchorChanged(AMRUKAnchor* Anchor, EMRUKAnchorChange Change);
+	UFUNCTION()
 	void OnRoomCreated(AMRUKRoom* Room);
 	UFUNCTION()
 	void OnRoomUpdated(AMRUKRoom* Room);
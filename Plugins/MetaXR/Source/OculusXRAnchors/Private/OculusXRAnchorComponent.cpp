@@ -6,6 +6,7 @@
 #include "OculusXRHMD.h"
 #include "OculusXRAnchorBPFunctionLibrary.h"
 #include "OculusXRAnchorsPrivate.h"
+#include "OculusXRAnchorLocatorSubsystem.h"
 #include "GameFramework/PlayerController.h"
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -17,6 +18,13 @@ static TAutoConsoleVariable<int32> CVarOculusXRVerboseAnchorDebugXR(
 			TEXT("  1: enabled  (verbose logging)\n"));
 #endif
 
+static TAutoConsoleVariable<int32> CVarOculusXRBatchedAnchorLocate(
+	TEXT("ovr.BatchedAnchorLocate"),
+	1,
+	TEXT("Whether anchor components are located all at once by the anchor locator subsystem.\n")
+		TEXT("0: every anchor component locates its anchor in its own tick\n")
+			TEXT("1: all anchors are located in a single batch per frame\n"));
+
 UOculusXRAnchorComponent::UOculusXRAnchorComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bUpdateHeadSpaceTransform(true)
@@ -41,19 +49,41 @@ void UOculusXRAnchorComponent::BeginPlay()
 		{
 			PlayerCameraManager = PlayerController->PlayerCameraManager;
 		}
+
+		UOculusXRAnchorLocatorSubsystem* LocatorSubsystem = World->GetSubsystem<UOculusXRAnchorLocatorSubsystem>();
+		if (LocatorSubsystem && CVarOculusXRBatchedAnchorLocate.GetValueOnGameThread() > 0)
+		{
+			LocatorSubsystem->Register(this);
+			bLocatedBySubsystem = true;
+			SetComponentTickEnabled(false);
+		}
 	}
 }
 
 void UOculusXRAnchorComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	UpdateAnchorTransform();
+	if (!bLocatedBySubsystem)
+	{
+		UpdateAnchorTransform();
+	}
 }
 
 void UOculusXRAnchorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	if (bLocatedBySubsystem)
+	{
+		UWorld* World = GetWorld();
+		UOculusXRAnchorLocatorSubsystem* LocatorSubsystem = World ? World->GetSubsystem<UOculusXRAnchorLocatorSubsystem>() : nullptr;
+		if (LocatorSubsystem)
+		{
+			LocatorSubsystem->Unregister(this);
+		}
+		bLocatedBySubsystem = false;
+	}
+
 	if (HasValidHandle())
 	{
 		EOculusXRAnchorResult::Type AnchorResult;
@@ -141,40 +171,60 @@ void UOculusXRAnchorComponent::UpdateAnchorTransform() const
 		return;
 	}
 
-	AActor* Parent = GetOwner();
-	if (Parent)
+	if (GetOwner() && AnchorHandle.Value)
 	{
-		if (AnchorHandle.Value)
+		FTransform AnchorTransform;
+		if (UOculusXRAnchorBPFunctionLibrary::GetAnchorTransformByHandle(AnchorHandle, AnchorTransform))
 		{
-			FTransform OutTransform;
-			if (UOculusXRAnchorBPFunctionLibrary::GetAnchorTransformByHandle(AnchorHandle, OutTransform))
-			{
+			ApplyAnchorTransform(AnchorTransform, 0.0, 0.0);
+		}
+	}
+}
+
+bool UOculusXRAnchorComponent::ApplyAnchorTransform(FTransform AnchorTransform, double LocationTolerance, double RotationTolerance) const
+{
+	AActor* Parent = GetOwner();
+	if (!Parent)
+	{
+		return false;
+	}
+
 #if WITH_EDITOR
-				// Link only head-space transform update
-				if (bUpdateHeadSpaceTransform && PlayerCameraManager != nullptr)
-				{
-					FTransform MainCameraTransform;
-					MainCameraTransform.SetLocation(PlayerCameraManager->GetCameraLocation());
-					MainCameraTransform.SetRotation(FQuat(PlayerCameraManager->GetCameraRotation()));
-
-					if (!ToWorldSpacePose(MainCameraTransform, OutTransform))
-					{
-						UE_LOG(LogOculusXRAnchors, Display, TEXT("Was not able to transform anchor to world space pose"));
-					}
-				}
+	// Link only head-space transform update
+	if (bUpdateHeadSpaceTransform && PlayerCameraManager != nullptr)
+	{
+		FTransform MainCameraTransform;
+		MainCameraTransform.SetLocation(PlayerCameraManager->GetCameraLocation());
+		MainCameraTransform.SetRotation(FQuat(PlayerCameraManager->GetCameraRotation()));
+
+		if (!ToWorldSpacePose(MainCameraTransform, AnchorTransform))
+		{
+			UE_LOG(LogOculusXRAnchors, Display, TEXT("Was not able to transform anchor to world space pose"));
+		}
+	}
 #endif
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				if (CVarOculusXRVerboseAnchorDebugXR.GetValueOnGameThread() > 0)
-				{
-					UE_LOG(LogOculusXRAnchors, Display, TEXT("UpdateAnchor Pos %s"), *OutTransform.GetLocation().ToString());
-					UE_LOG(LogOculusXRAnchors, Display, TEXT("UpdateAnchor Rot %s"), *OutTransform.GetRotation().ToString());
-				}
+	if (CVarOculusXRVerboseAnchorDebugXR.GetValueOnGameThread() > 0)
+	{
+		UE_LOG(LogOculusXRAnchors, Display, TEXT("UpdateAnchor Pos %s"), *AnchorTransform.GetLocation().ToString());
+		UE_LOG(LogOculusXRAnchors, Display, TEXT("UpdateAnchor Rot %s"), *AnchorTransform.GetRotation().ToString());
+	}
 #endif
-				Parent->SetActorLocationAndRotation(OutTransform.GetLocation(), OutTransform.GetRotation(), false, 0, ETeleportType::ResetPhysics);
-			}
+
+	// Moving the owner updates all of its components and overlaps, skip it if the anchor didn't move
+	if (LocationTolerance > 0.0 || RotationTolerance > 0.0)
+	{
+		const bool bSameLocation = FVector::DistSquared(Parent->GetActorLocation(), AnchorTransform.GetLocation()) <= FMath::Square(LocationTolerance);
+		const bool bSameRotation = FMath::Abs(Parent->GetActorQuat() | AnchorTransform.GetRotation()) >= FMath::Cos(0.5 * RotationTolerance);
+		if (bSameLocation && bSameRotation)
+		{
+			return false;
 		}
 	}
+
+	Parent->SetActorLocationAndRotation(AnchorTransform.GetLocation(), AnchorTransform.GetRotation(), false, 0, ETeleportType::ResetPhysics);
+	return true;
 }
 
 bool UOculusXRAnchorComponent::ToWorldSpacePose(FTransform CameraTransform, FTransform& OutTrackingSpaceTransform) const
@@ -0,0 +1,169 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRAnchorLocatorSubsystem.h"
+#include "OculusXRAnchorComponent.h"
+#include "OculusXRAnchorTypes.h"
+#include "OculusXRAnchorsPrivate.h"
+#include "OculusXRHMD.h"
+
+DECLARE_STATS_GROUP(TEXT("OculusXRAnchors"), STATGROUP_OculusXRAnchors, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Update Anchor Transforms"), STAT_OculusXRUpdateAnchorTransforms, STATGROUP_OculusXRAnchors);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anchors Located"), STAT_OculusXRAnchorsLocated, STATGROUP_OculusXRAnchors);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anchor Owners Moved"), STAT_OculusXRAnchorOwnersMoved, STATGROUP_OculusXRAnchors);
+
+static TAutoConsoleVariable<float> CVarOculusXRAnchorLocatorLocationTolerance(
+	TEXT("ovr.AnchorLocatorLocationTolerance"),
+	0.01f,
+	TEXT("Distance in world units an anchor has to move before the anchor locator subsystem moves its owner.\n"));
+
+static TAutoConsoleVariable<float> CVarOculusXRAnchorLocatorRotationTolerance(
+	TEXT("ovr.AnchorLocatorRotationTolerance"),
+	0.01f,
+	TEXT("Angle in degrees an anchor has to rotate before the anchor locator subsystem moves its owner.\n"));
+
+namespace
+{
+	/**
+	 * Locates anchors with the tracking system. The HMD, the tracking origin and the tracking to world transform are
+	 * only looked up once per batch instead of once per anchor.
+	 */
+	class FOculusXRTrackedAnchorPoseProvider : public IOculusXRAnchorPoseProvider
+	{
+	public:
+		bool LocateAnchors(TConstArrayView<uint64> Handles, TArrayView<FTransform> OutTransforms, TArrayView<bool> OutLocated) override
+		{
+			OculusXRHMD::FOculusXRHMD* OutHMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
+			if (!OutHMD || !FOculusXRHMDModule::GetPluginWrapper().GetInitialized())
+			{
+				return false;
+			}
+
+			ovrpTrackingOrigin ovrpOrigin = ovrpTrackingOrigin_EyeLevel;
+			if (!OVRP_SUCCESS(FOculusXRHMDModule::GetPluginWrapper().GetTrackingOriginType2(&ovrpOrigin)))
+			{
+				return false;
+			}
+
+			const FTransform TrackingToWorld = OutHMD->GetLastTrackingToWorld();
+			for (int32 i = 0; i < Handles.Num(); ++i)
+			{
+				const ovrpUInt64 ovrpSpace = Handles[i];
+				ovrpSpaceLocationf ovrpSpaceLocation{};
+				OutLocated[i] = OVRP_SUCCESS(FOculusXRHMDModule::GetPluginWrapper().LocateSpace2(&ovrpSpaceLocation, &ovrpSpace, ovrpOrigin))
+					&& FOculusXRAnchorLocationFlags(ovrpSpaceLocation.locationFlags).IsValid();
+				if (OutLocated[i])
+				{
+					OculusXRHMD::FPose Pose;
+					OutHMD->ConvertPose(ovrpSpaceLocation.pose, Pose);
+					OutTransforms[i].SetLocation(TrackingToWorld.TransformPosition(Pose.Position));
+					OutTransforms[i].SetRotation(TrackingToWorld.TransformRotation(FQuat(Pose.Orientation)).GetNormalized());
+					OutTransforms[i].SetScale3D(FVector::OneVector);
+				}
+			}
+			return true;
+		}
+	};
+} // namespace
+
+void UOculusXRAnchorLocatorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	SetPoseProvider(nullptr);
+}
+
+void UOculusXRAnchorLocatorSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	Anchors.Reset();
+	PoseProvider.Reset();
+	Super::Deinitialize();
+}
+
+void UOculusXRAnchorLocatorSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.TickGroup = TG_PostUpdateWork;
+	TickFunction.bCanEverTick = true;
+	TickFunction.Subsystem = this;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void UOculusXRAnchorLocatorSubsystem::Register(UOculusXRAnchorComponent* Anchor)
+{
+	Anchors.AddUnique(Anchor);
+}
+
+void UOculusXRAnchorLocatorSubsystem::Unregister(UOculusXRAnchorComponent* Anchor)
+{
+	Anchors.RemoveSingleSwap(Anchor);
+}
+
+void UOculusXRAnchorLocatorSubsystem::SetPoseProvider(TSharedPtr<IOculusXRAnchorPoseProvider> NewPoseProvider)
+{
+	PoseProvider = NewPoseProvider.IsValid() ? NewPoseProvider : MakeShared<FOculusXRTrackedAnchorPoseProvider>();
+}
+
+int32 UOculusXRAnchorLocatorSubsystem::UpdateAnchorTransforms()
+{
+	SCOPE_CYCLE_COUNTER(STAT_OculusXRUpdateAnchorTransforms);
+
+	LocatedAnchors.Reset();
+	Handles.Reset();
+	Anchors.RemoveAllSwap([](const TWeakObjectPtr<UOculusXRAnchorComponent>& Anchor) { return !Anchor.IsValid(); });
+	for (const TWeakObjectPtr<UOculusXRAnchorComponent>& WeakAnchor : Anchors)
+	{
+		UOculusXRAnchorComponent* Anchor = WeakAnchor.Get();
+		if (Anchor->HasValidHandle() && Anchor->GetOwner())
+		{
+			LocatedAnchors.Add(Anchor);
+			Handles.Add(Anchor->GetHandle().GetValue());
+		}
+	}
+	if (Handles.IsEmpty())
+	{
+		return 0;
+	}
+
+	Transforms.SetNumUninitialized(Handles.Num());
+	Located.SetNumUninitialized(Handles.Num());
+	if (!PoseProvider->LocateAnchors(Handles, Transforms, Located))
+	{
+		return 0;
+	}
+	INC_DWORD_STAT_BY(STAT_OculusXRAnchorsLocated, Handles.Num());
+
+	const double LocationTolerance = CVarOculusXRAnchorLocatorLocationTolerance.GetValueOnGameThread();
+	const double RotationTolerance = FMath::DegreesToRadians(CVarOculusXRAnchorLocatorRotationTolerance.GetValueOnGameThread());
+	int32 NumMoved = 0;
+	for (int32 i = 0; i < LocatedAnchors.Num(); ++i)
+	{
+		if (Located[i] && LocatedAnchors[i]->ApplyAnchorTransform(Transforms[i], LocationTolerance, RotationTolerance))
+		{
+			++NumMoved;
+		}
+	}
+	INC_DWORD_STAT_BY(STAT_OculusXRAnchorOwnersMoved, NumMoved);
+	return NumMoved;
+}
+
+void FOculusXRAnchorLocatorTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->UpdateAnchorTransforms();
+	}
+}
+
+FString FOculusXRAnchorLocatorTickFunction::DiagnosticMessage()
+{
+	return TEXT("FOculusXRAnchorLocatorTickFunction");
+}
+
+bool UOculusXRAnchorLocatorSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -264,6 +264,56 @@ namespace OculusXRAnchors
 		return static_cast<EOculusXRAnchorResult::Type>(enumerateResult);
 	}
 
+	void FOculusXRAnchorManager::EnableSupportedComponents(TConstArrayView<uint64> Spaces)
+	{
+		if (!FOculusXRHMDModule::GetPluginWrapper().GetInitialized())
+		{
+			return;
+		}
+
+		// The same space can be part of the results more than once, only enable its components once
+		TSet<uint64> VisitedSpaces;
+		VisitedSpaces.Reserve(Spaces.Num());
+
+		// Spaces only support a handful of components, so the buffer is usually large enough for a single enumeration
+		TArray<ovrpSpaceComponentType, TInlineAllocator<16>> ovrComponentTypes;
+		uint64 tempOut;
+		for (const uint64 Space : Spaces)
+		{
+			bool bAlreadyVisited = false;
+			VisitedSpaces.Add(Space, &bAlreadyVisited);
+			if (bAlreadyVisited)
+			{
+				continue;
+			}
+
+			const ovrpSpace ovrSpace = Space;
+			ovrpUInt32 output = 0;
+			ovrComponentTypes.SetNumUninitialized(ovrComponentTypes.Max());
+			ovrpResult enumerateResult = FOculusXRHMDModule::GetPluginWrapper().EnumerateSpaceSupportedComponents(&ovrSpace, ovrComponentTypes.Num(), &output, ovrComponentTypes.GetData());
+			if (enumerateResult == ovrpFailure_InsufficientSize)
+			{
+				ovrComponentTypes.SetNumUninitialized(output);
+				enumerateResult = FOculusXRHMDModule::GetPluginWrapper().EnumerateSpaceSupportedComponents(&ovrSpace, ovrComponentTypes.Num(), &output, ovrComponentTypes.GetData());
+			}
+			if (!OVRP_SUCCESS(enumerateResult))
+			{
+				continue;
+			}
+
+			for (ovrpUInt32 i = 0; i < output; ++i)
+			{
+				const EOculusXRSpaceComponentType ComponentType = ConvertToUEComponentType(ovrComponentTypes[i]);
+				if (ComponentType == EOculusXRSpaceComponentType::Locatable
+					|| ComponentType == EOculusXRSpaceComponentType::Sharable
+					|| ComponentType == EOculusXRSpaceComponentType::Storable)
+				{
+					SetSpaceComponentStatus(Space, ComponentType, true, 0.0f, tempOut);
+				}
+			}
+		}
+	}
+
 	EOculusXRAnchorResult::Type FOculusXRAnchorManager::SaveAnchor(uint64 Space,
 		EOculusXRSpaceStorageLocation StorageLocation,
 		EOculusXRSpaceStoragePersistenceMode StoragePersistenceMode, uint64& OutRequestId)
@@ -23,7 +23,7 @@ namespace OculusXRAnchors
 		DelegateHandleSetComponentStatus = FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.AddRaw(this, &FOculusXRAnchors::HandleSetComponentStatusComplete);
 		DelegateHandleAnchorSave = FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSaveComplete);
 		DelegateHandleAnchorSaveList = FOculusXRAnchorEventDelegates::OculusSpaceListSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSaveListComplete);
-		DelegateHandleQueryResultElement = FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryResultElement);
+		DelegateHandleQueryResultBatch = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryResultBatch);
 		DelegateHandleQueryComplete = FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryComplete);
 		DelegateHandleAnchorShare = FOculusXRAnchorEventDelegates::OculusSpaceShareComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSharingComplete);
 		DelegateHandleAnchorsSave = FOculusXRAnchorEventDelegates::OculusAnchorsSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorsSaveComplete);
@@ -39,7 +39,7 @@ namespace OculusXRAnchors
 		FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.Remove(DelegateHandleSetComponentStatus);
 		FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete.Remove(DelegateHandleAnchorSave);
 		FOculusXRAnchorEventDelegates::OculusSpaceListSaveComplete.Remove(DelegateHandleAnchorSaveList);
-		FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Remove(DelegateHandleQueryResultElement);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Remove(DelegateHandleQueryResultBatch);
 		FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.Remove(DelegateHandleQueryComplete);
 		FOculusXRAnchorEventDelegates::OculusSpaceShareComplete.Remove(DelegateHandleAnchorShare);
 		FOculusXRAnchorEventDelegates::OculusAnchorsSaveComplete.Remove(DelegateHandleAnchorsSave);
@@ -843,17 +843,17 @@ namespace OculusXRAnchors
 		AnchorSaveListBindings.Remove(RequestId.GetValue());
 	}
 
-	void FOculusXRAnchors::HandleAnchorQueryResultElement(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID)
+	void FOculusXRAnchors::HandleAnchorQueryResultBatch(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors)
 	{
 		AnchorQueryBinding* QueryResultPtr = AnchorQueryBindings.Find(RequestId.GetValue());
 		GetSharedAnchorsBinding* GetSharedResultPtr = GetSharedAnchorsBindings.Find(RequestId.GetValue());
 		if (QueryResultPtr)
 		{
-			UpdateQuerySpacesBinding(QueryResultPtr, RequestId, Space, UUID);
+			UpdateQuerySpacesBinding(QueryResultPtr, RequestId, Anchors);
 		}
 		else if (GetSharedResultPtr)
 		{
-			UpdateGetSharedAnchorsBinding(GetSharedResultPtr, RequestId, Space, UUID);
+			UpdateGetSharedAnchorsBinding(GetSharedResultPtr, RequestId, Anchors);
 		}
 		else
 		{
@@ -861,55 +861,40 @@ namespace OculusXRAnchors
 		}
 	}
 
-	void FOculusXRAnchors::UpdateQuerySpacesBinding(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID)
+	static void EnableSupportedAnchorComponents(const TArray<FOculusXRAnchor>& Anchors)
 	{
-		uint64 tempOut;
-		TArray<EOculusXRSpaceComponentType> supportedTypes;
-		FOculusXRAnchorManager::GetSupportedAnchorComponents(Space, supportedTypes);
-
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Locatable))
-		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Locatable, true, 0.0f, tempOut);
-		}
-
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Sharable))
-		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Sharable, true, 0.0f, tempOut);
-		}
-
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Storable))
+		TArray<uint64> Spaces;
+		Spaces.Reserve(Anchors.Num());
+		for (const FOculusXRAnchor& Anchor : Anchors)
 		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Storable, true, 0.0f, tempOut);
+			Spaces.Add(Anchor.AnchorHandle.GetValue());
 		}
-
-		Binding->Results.Add(FOculusXRSpaceQueryResult(Space, UUID, Binding->Location));
+		FOculusXRAnchorManager::EnableSupportedComponents(Spaces);
 	}
 
-	void FOculusXRAnchors::UpdateGetSharedAnchorsBinding(GetSharedAnchorsBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID)
+	void FOculusXRAnchors::UpdateQuerySpacesBinding(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors)
 	{
-		uint64 tempOut;
-		TArray<EOculusXRSpaceComponentType> supportedTypes;
-		FOculusXRAnchorManager::GetSupportedAnchorComponents(Space, supportedTypes);
+		EnableSupportedAnchorComponents(Anchors);
 
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Locatable))
+		Binding->Results.Reserve(Binding->Results.Num() + Anchors.Num());
+		for (const FOculusXRAnchor& Anchor : Anchors)
 		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Locatable, true, 0.0f, tempOut);
+			Binding->Results.Add(FOculusXRSpaceQueryResult(Anchor.AnchorHandle, Anchor.Uuid, Binding->Location));
 		}
+	}
 
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Sharable))
-		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Sharable, true, 0.0f, tempOut);
-		}
+	void FOculusXRAnchors::UpdateGetSharedAnchorsBinding(GetSharedAnchorsBinding* Binding, FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors)
+	{
+		EnableSupportedAnchorComponents(Anchors);
 
-		if (supportedTypes.Contains(EOculusXRSpaceComponentType::Storable))
+		Binding->Results.Reserve(Binding->Results.Num() + Anchors.Num());
+		for (const FOculusXRAnchor& Anchor : Anchors)
 		{
-			FOculusXRAnchorManager::SetSpaceComponentStatus(Space, EOculusXRSpaceComponentType::Storable, true, 0.0f, tempOut);
+			FOculusXRAnchorsDiscoverResult discoveryResult;
+			discoveryResult.Space = Anchor.AnchorHandle;
+			discoveryResult.UUID = Anchor.Uuid;
+			Binding->Results.Add(discoveryResult);
 		}
-
-		FOculusXRAnchorsDiscoverResult discoveryResult;
-		discoveryResult.Space = Space;
-		discoveryResult.UUID = UUID;
-		Binding->Results.Add(discoveryResult);
 	}
 
 	void FOculusXRAnchors::HandleAnchorQueryComplete(FOculusXRUInt64 RequestId, int Result)
@@ -131,56 +131,7 @@ namespace OculusXRAnchors
 					return;
 				}
 
-				auto taskPtr = OculusXR::FAsyncRequestSystem::GetRequest<FGetAnchorsSharedWithGroup>(
-					OculusXR::FAsyncRequestBase::RequestId{ QueryEvent.requestId });
-
-				// If there is a valid get shared anchors request we can add to the found elements here and then exit without firing legacy event delegates
-				if (taskPtr.IsValid())
-				{
-					TArray<EOculusXRSpaceComponentType> supportedTypes;
-					TArray<FOculusXRAnchor> anchors;
-					for (const auto& queryResultElement : spaceQueryResults)
-					{
-						UE_LOG(LogOculusXRAnchors, Verbose, TEXT("	Found Element: Space: %llu  --  UUID: %s"), queryResultElement.space, *FOculusXRUUID(queryResultElement.uuid.data).ToString());
-
-						uint64 tempOut;
-						FOculusXRAnchorManager::GetSupportedAnchorComponents(queryResultElement.space, supportedTypes);
-
-						if (supportedTypes.Contains(EOculusXRSpaceComponentType::Locatable))
-						{
-							FOculusXRAnchorManager::SetSpaceComponentStatus(queryResultElement.space, EOculusXRSpaceComponentType::Locatable, true, 0.0f, tempOut);
-						}
-
-						if (supportedTypes.Contains(EOculusXRSpaceComponentType::Sharable))
-						{
-							FOculusXRAnchorManager::SetSpaceComponentStatus(queryResultElement.space, EOculusXRSpaceComponentType::Sharable, true, 0.0f, tempOut);
-						}
-
-						if (supportedTypes.Contains(EOculusXRSpaceComponentType::Storable))
-						{
-							FOculusXRAnchorManager::SetSpaceComponentStatus(queryResultElement.space, EOculusXRSpaceComponentType::Storable, true, 0.0f, tempOut);
-						}
-
-						anchors.Add(FOculusXRAnchor(queryResultElement.space, queryResultElement.uuid.data));
-					}
-
-					taskPtr->OnResultsAvailable(anchors);
-
-					return;
-				}
-
-				FOculusXRUInt64 RequestId(QueryEvent.requestId);
-				FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(RequestId);
-
-				for (const auto& queryResultElement : spaceQueryResults)
-				{
-					FOculusXRUInt64 anchorHandle(queryResultElement.space);
-					FOculusXRUUID uuid(queryResultElement.uuid.data);
-
-					UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_SpaceQueryResult -- Space: %llu -- UUID: %s"), anchorHandle.Value, *uuid.ToString());
-
-					FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(RequestId, anchorHandle, uuid);
-				}
+				ProcessSpaceQueryResults(QueryEvent.requestId, TConstArrayView<ovrpSpaceQueryResult>(spaceQueryResults.data(), static_cast<int32>(spaceQueryResults.size())));
 
 				break;
 			}
@@ -379,4 +330,49 @@ namespace OculusXRAnchors
 			}
 		}
 	}
+
+	void FOculusXRAnchorsEventPolling::ProcessSpaceQueryResults(ovrpUInt64 QueryRequestId, TConstArrayView<ovrpSpaceQueryResult> QueryResults)
+	{
+		TArray<FOculusXRAnchor> anchors;
+		TArray<uint64> spaces;
+		anchors.Reserve(QueryResults.Num());
+		spaces.Reserve(QueryResults.Num());
+		for (const auto& queryResultElement : QueryResults)
+		{
+			anchors.Emplace(FOculusXRUInt64(queryResultElement.space), FOculusXRUUID(queryResultElement.uuid.data));
+			spaces.Add(queryResultElement.space);
+		}
+
+		auto taskPtr = OculusXR::FAsyncRequestSystem::GetRequest<FGetAnchorsSharedWithGroup>(
+			OculusXR::FAsyncRequestBase::RequestId{ QueryRequestId });
+
+		// If there is a valid get shared anchors request we can add to the found elements here and then exit without firing legacy event delegates
+		if (taskPtr.IsValid())
+		{
+			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("Space Query Results: Found %d elements -- Request ID: %llu"), anchors.Num(), QueryRequestId);
+
+			FOculusXRAnchorManager::EnableSupportedComponents(spaces);
+			taskPtr->OnResultsAvailable(anchors);
+
+			return;
+		}
+
+		FOculusXRUInt64 RequestId(QueryRequestId);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(RequestId);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Broadcast(RequestId, anchors);
+
+		// Legacy per element path
+		if (!FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.IsBound())
+		{
+			return;
+		}
+
+		for (const FOculusXRAnchor& anchor : anchors)
+		{
+			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_SpaceQueryResult -- Space: %llu -- UUID: %s"), anchor.AnchorHandle.Value, *anchor.Uuid.ToString());
+
+			FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(RequestId, anchor.AnchorHandle, anchor.Uuid);
+		}
+	}
+
 } // namespace OculusXRAnchors
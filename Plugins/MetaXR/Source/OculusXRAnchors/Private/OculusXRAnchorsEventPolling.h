@@ -11,6 +11,9 @@ namespace OculusXRAnchors
 	{
 	public:
 		static void OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult);
+
+		// Handles all results of a ovrpEventType_SpaceQueryResults event at once
+		static void ProcessSpaceQueryResults(ovrpUInt64 QueryRequestId, TConstArrayView<ovrpSpaceQueryResult> QueryResults);
 	};
 
 } // namespace OculusXRAnchors
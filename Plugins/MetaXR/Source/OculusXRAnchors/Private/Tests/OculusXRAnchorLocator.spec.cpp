@@ -0,0 +1,167 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/SceneComponent.h"
+#include "OculusXRAnchorComponent.h"
+#include "OculusXRAnchorLocatorSubsystem.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	/**
+	 * Places anchor N at (10 * N, 0, Height) rotated by N degrees around the up axis. Only the first NumMoving anchors
+	 * are lifted by Height, the others stay where they are.
+	 */
+	class FStubAnchorPoseProvider : public IOculusXRAnchorPoseProvider
+	{
+	public:
+		double Height = 0.0;
+		int32 NumMoving = 0;
+		int32 NumBatches = 0;
+
+		static FTransform GetPose(uint64 Handle, double Height)
+		{
+			return FTransform(FQuat(FVector::UpVector, FMath::DegreesToRadians(static_cast<double>(Handle))), FVector(10.0 * Handle, 0.0, Height));
+		}
+
+		bool LocateAnchors(TConstArrayView<uint64> Handles, TArrayView<FTransform> OutTransforms, TArrayView<bool> OutLocated) override
+		{
+			++NumBatches;
+			for (int32 i = 0; i < Handles.Num(); ++i)
+			{
+				OutTransforms[i] = GetPose(Handles[i], Handles[i] <= static_cast<uint64>(NumMoving) ? Height : 0.0);
+				OutLocated[i] = true;
+			}
+			return true;
+		}
+	};
+} // namespace
+
+BEGIN_DEFINE_SPEC(FOculusXRAnchorLocatorSpec, TEXT("OculusXR.Anchors.Locator"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+UWorld* World;
+UOculusXRAnchorLocatorSubsystem* Locator;
+TSharedPtr<FStubAnchorPoseProvider> PoseProvider;
+TArray<AActor*> Owners;
+
+void SpawnAnchors(int32 NumAnchors);
+END_DEFINE_SPEC(FOculusXRAnchorLocatorSpec)
+
+void FOculusXRAnchorLocatorSpec::SpawnAnchors(int32 NumAnchors)
+{
+	for (int32 i = 0; i < NumAnchors; ++i)
+	{
+		AActor* Owner = World->SpawnActor<AActor>();
+		Owner->AddComponentByClass(USceneComponent::StaticClass(), false, FTransform::Identity, false);
+		UOculusXRAnchorComponent* Anchor = Cast<UOculusXRAnchorComponent>(Owner->AddComponentByClass(UOculusXRAnchorComponent::StaticClass(), false, FTransform::Identity, false));
+		Anchor->SetHandle(i + 1);
+		Owners.Add(Owner);
+	}
+}
+
+void FOculusXRAnchorLocatorSpec::Define()
+{
+	BeforeEach([this]() {
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		Locator = World->GetSubsystem<UOculusXRAnchorLocatorSubsystem>();
+		PoseProvider = MakeShared<FStubAnchorPoseProvider>();
+		Locator->SetPoseProvider(PoseProvider);
+	});
+
+	AfterEach([this]() {
+		// The handles are made up, don't let the components try to destroy them
+		for (AActor* Owner : Owners)
+		{
+			Owner->FindComponentByClass<UOculusXRAnchorComponent>()->SetHandle(0);
+		}
+		Owners.Reset();
+		PoseProvider.Reset();
+
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+		Locator = nullptr;
+	});
+
+	It(TEXT("Moves owners to the located poses"), [this]() {
+		SpawnAnchors(16);
+		PoseProvider->NumMoving = 16;
+		PoseProvider->Height = 50.0;
+
+		TestEqual(TEXT("Moved owners"), Locator->UpdateAnchorTransforms(), 16);
+		TestEqual(TEXT("Batches"), PoseProvider->NumBatches, 1);
+		for (int32 i = 0; i < Owners.Num(); ++i)
+		{
+			const FTransform Expected = FStubAnchorPoseProvider::GetPose(i + 1, 50.0);
+			TestTrue(TEXT("Location matches"), Owners[i]->GetActorLocation().Equals(Expected.GetLocation()));
+			TestTrue(TEXT("Rotation matches"), Owners[i]->GetActorQuat().Equals(Expected.GetRotation()));
+		}
+	});
+
+	It(TEXT("Skips owners that didn't move"), [this]() {
+		SpawnAnchors(16);
+		Locator->UpdateAnchorTransforms();
+
+		TestEqual(TEXT("Moved owners without changes"), Locator->UpdateAnchorTransforms(), 0);
+
+		PoseProvider->NumMoving = 4;
+		PoseProvider->Height = 50.0;
+		TestEqual(TEXT("Moved owners after some anchors moved"), Locator->UpdateAnchorTransforms(), 4);
+		TestEqual(TEXT("Height of moved owner"), Owners[3]->GetActorLocation().Z, 50.0);
+		TestEqual(TEXT("Height of static owner"), Owners[4]->GetActorLocation().Z, 0.0);
+	});
+
+	It(TEXT("Moves owners when the world ticks"), [this]() {
+		SpawnAnchors(4);
+		PoseProvider->NumMoving = 4;
+		PoseProvider->Height = 50.0;
+
+		World->Tick(LEVELTICK_All, 0.01f);
+		TestEqual(TEXT("Batches"), PoseProvider->NumBatches, 1);
+		TestEqual(TEXT("Height of owner"), Owners[0]->GetActorLocation().Z, 50.0);
+	});
+
+	It(TEXT("Stops locating destroyed anchors"), [this]() {
+		SpawnAnchors(4);
+		Owners[0]->FindComponentByClass<UOculusXRAnchorComponent>()->SetHandle(0);
+		Owners[0]->Destroy();
+		Owners.RemoveAt(0);
+
+		TestEqual(TEXT("Moved owners"), Locator->UpdateAnchorTransforms(), 3);
+	});
+
+	It(TEXT("Updates 1000 anchors"), [this]() {
+		constexpr int32 NumAnchors = 1000;
+		constexpr int32 NumFrames = 100;
+		SpawnAnchors(NumAnchors);
+		Locator->UpdateAnchorTransforms();
+
+		PoseProvider->NumMoving = NumAnchors;
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			PoseProvider->Height = Frame + 1.0;
+			Locator->UpdateAnchorTransforms();
+		}
+		const double MovingTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Locator->UpdateAnchorTransforms();
+		}
+		const double StaticTime = FPlatformTime::Seconds() - StartTime;
+
+		AddInfo(FString::Printf(TEXT("%d anchors per frame: all moving %.3f ms, all static %.3f ms"), NumAnchors, MovingTime * 1000.0 / NumFrames, StaticTime * 1000.0 / NumFrames));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,111 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRAnchorDelegates.h"
+#include "OculusXRAnchorsEventPolling.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Far away from any request id a real query would get
+	constexpr ovrpUInt64 SyntheticRequestId = 0xFFFF000000000000ull;
+
+	TArray<ovrpSpaceQueryResult> CreateQueryResults(int32 NumResults)
+	{
+		TArray<ovrpSpaceQueryResult> Results;
+		Results.SetNumZeroed(NumResults);
+		for (int32 i = 0; i < NumResults; ++i)
+		{
+			Results[i].space = i + 1;
+			FMemory::Memcpy(Results[i].uuid.data, &Results[i].space, sizeof(Results[i].space));
+		}
+		return Results;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(FOculusXRAnchorsEventPollingSpec, TEXT("OculusXR.Anchors.EventPolling"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+FDelegateHandle BatchHandle;
+FDelegateHandle ElementHandle;
+END_DEFINE_SPEC(FOculusXRAnchorsEventPollingSpec)
+
+void FOculusXRAnchorsEventPollingSpec::Define()
+{
+	using OculusXRAnchors::FOculusXRAnchorsEventPolling;
+
+	AfterEach([this]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Remove(BatchHandle);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Remove(ElementHandle);
+	});
+
+	It(TEXT("Broadcasts all results of a query at once"), [this]() {
+		const TArray<ovrpSpaceQueryResult> Results = CreateQueryResults(64);
+
+		int32 NumBatches = 0;
+		TArray<FOculusXRAnchor> BatchAnchors;
+		BatchHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddLambda([&](FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors) {
+			if (RequestId.GetValue() == SyntheticRequestId)
+			{
+				++NumBatches;
+				BatchAnchors = Anchors;
+			}
+		});
+		TArray<FOculusXRUInt64> ElementSpaces;
+		ElementHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.AddLambda([&](FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID) {
+			if (RequestId.GetValue() == SyntheticRequestId)
+			{
+				ElementSpaces.Add(Space);
+			}
+		});
+
+		FOculusXRAnchorsEventPolling::ProcessSpaceQueryResults(SyntheticRequestId, Results);
+
+		TestEqual(TEXT("Batches"), NumBatches, 1);
+		if (TestEqual(TEXT("Anchors in batch"), BatchAnchors.Num(), Results.Num()))
+		{
+			for (int32 i = 0; i < Results.Num(); ++i)
+			{
+				TestTrue(TEXT("Space"), BatchAnchors[i].AnchorHandle.GetValue() == Results[i].space);
+				TestTrue(TEXT("UUID"), BatchAnchors[i].Uuid == FOculusXRUUID(Results[i].uuid.data));
+			}
+		}
+		TestEqual(TEXT("Legacy per element broadcasts"), ElementSpaces.Num(), Results.Num());
+	});
+
+	It(TEXT("Processes 5000 results"), [this]() {
+		constexpr int32 NumResults = 5000;
+		constexpr int32 NumIterations = 20;
+		const TArray<ovrpSpaceQueryResult> Results = CreateQueryResults(NumResults);
+
+		// Listener that collects the results one by one, like the anchor queries used to
+		TArray<FOculusXRAnchor> Collected;
+		ElementHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.AddLambda([&](FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID) {
+			Collected.Add(FOculusXRAnchor(Space, UUID));
+		});
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Collected.Reset();
+			FOculusXRAnchorsEventPolling::ProcessSpaceQueryResults(SyntheticRequestId, Results);
+		}
+		const double ElementTime = FPlatformTime::Seconds() - StartTime;
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Remove(ElementHandle);
+		TestEqual(TEXT("Collected one by one"), Collected.Num(), NumResults);
+
+		BatchHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddLambda([&](FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors) {
+			Collected.Append(Anchors);
+		});
+		StartTime = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumIterations; ++i)
+		{
+			Collected.Reset();
+			FOculusXRAnchorsEventPolling::ProcessSpaceQueryResults(SyntheticRequestId, Results);
+		}
+		const double BatchTime = FPlatformTime::Seconds() - StartTime;
+		TestEqual(TEXT("Collected as batch"), Collected.Num(), NumResults);
+
+		AddInfo(FString::Printf(TEXT("%d query results: per element %.3f ms, batch %.3f ms"), NumResults, ElementTime * 1000.0 / NumIterations, BatchTime * 1000.0 / NumIterations));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
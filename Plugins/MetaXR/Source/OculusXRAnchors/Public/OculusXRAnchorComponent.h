@@ -51,6 +51,20 @@ private:
 	UPROPERTY()
 	class APlayerCameraManager* PlayerCameraManager;
 
+	// Whether the UOculusXRAnchorLocatorSubsystem moves the owner instead of the tick of this component
+	bool bLocatedBySubsystem = false;
+
+	friend class UOculusXRAnchorLocatorSubsystem;
+
 	void UpdateAnchorTransform() const;
+
+	/**
+	 * Move the owner to the located pose of the anchor.
+	 * @param AnchorTransform   The located pose of the anchor in world space.
+	 * @param LocationTolerance Maximum distance the owner can be away from the pose without being moved.
+	 * @param RotationTolerance Maximum angle in radians the owner can be rotated away from the pose without being moved.
+	 * @return                  Whether the owner was moved.
+	 */
+	bool ApplyAnchorTransform(FTransform AnchorTransform, double LocationTolerance, double RotationTolerance) const;
 	bool ToWorldSpacePose(FTransform CameraTransform, FTransform& OutTrackingSpaceTransform) const;
 };
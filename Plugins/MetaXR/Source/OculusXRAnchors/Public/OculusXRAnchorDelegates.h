@@ -53,6 +53,18 @@ public:
 	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOculusXRSpaceQueryResultDelegate, FOculusXRUInt64 /*requestId*/, FOculusXRUInt64 /* space*/, FOculusXRUUID /*uuid*/);
 	static OCULUSXRANCHORS_API FOculusXRSpaceQueryResultDelegate OculusSpaceQueryResult;
 
+	/* SpaceQueryResultBatch (no ovrp event type)
+	 * All results of a ovrpEventType_SpaceQueryResults event at once, broadcast before the SpaceQueryResult of each element.
+	 *
+	 *        SpaceQueryResultBatch
+	 * Prefix:
+	 * FOculusXRSpaceQueryResultBatch
+	 * Suffix:
+	 * FOculusXRSpaceQueryResultBatchDelegate
+	 */
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOculusXRSpaceQueryResultBatchDelegate, FOculusXRUInt64 /*requestId*/, const TArray<FOculusXRAnchor>& /*anchors*/);
+	static OCULUSXRANCHORS_API FOculusXRSpaceQueryResultBatchDelegate OculusSpaceQueryResultBatch;
+
 	/* ovrpEventType_SpaceQueryComplete
 	 *
 	 *        SpaceQueryComplete
@@ -0,0 +1,99 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OculusXRAnchorLocatorSubsystem.generated.h"
+
+class UOculusXRAnchorComponent;
+class UOculusXRAnchorLocatorSubsystem;
+
+/**
+ * Locates the poses of anchors for the UOculusXRAnchorLocatorSubsystem. The default provider asks the tracking system,
+ * a different one can be set with SetPoseProvider(), e.g. to run without a headset.
+ */
+class OCULUSXRANCHORS_API IOculusXRAnchorPoseProvider
+{
+public:
+	virtual ~IOculusXRAnchorPoseProvider() = default;
+
+	/**
+	 * Locate a batch of anchors in world space.
+	 * @param Handles       The handles of the anchors to locate.
+	 * @param OutTransforms Receives the world transform of each anchor. Has the same size as Handles.
+	 * @param OutLocated    Receives whether each anchor could be located. Has the same size as Handles.
+	 * @return              False if no anchor could be located at all, e.g. because there is no tracking system.
+	 */
+	virtual bool LocateAnchors(TConstArrayView<uint64> Handles, TArrayView<FTransform> OutTransforms, TArrayView<bool> OutLocated) = 0;
+};
+
+/**
+ * Updates the anchor transforms in TG_PostUpdateWork, the tick group the anchor components located their anchors in
+ * before, so that the poses are updated at the same point of the frame.
+ */
+USTRUCT()
+struct FOculusXRAnchorLocatorTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UOculusXRAnchorLocatorSubsystem* Subsystem = nullptr;
+
+	void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FOculusXRAnchorLocatorTickFunction> : public TStructOpsTypeTraitsBase2<FOculusXRAnchorLocatorTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Moves the owners of all anchor components in the world to the poses of their anchors. Once per frame all anchors are
+ * located in a single batch, owners whose pose didn't change by more than the tolerances are not moved.
+ * The tolerances can be changed with ovr.AnchorLocatorLocationTolerance and ovr.AnchorLocatorRotationTolerance.
+ */
+UCLASS()
+class OCULUSXRANCHORS_API UOculusXRAnchorLocatorSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(FSubsystemCollectionBase& Collection) override;
+	void Deinitialize() override;
+	void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	void Register(UOculusXRAnchorComponent* Anchor);
+	void Unregister(UOculusXRAnchorComponent* Anchor);
+
+	/**
+	 * Replace the source of the anchor poses.
+	 * @param NewPoseProvider The new pose provider, or nullptr to use the tracking system again.
+	 */
+	void SetPoseProvider(TSharedPtr<IOculusXRAnchorPoseProvider> NewPoseProvider);
+
+	/**
+	 * Locate all registered anchors and move their owners. Called every frame.
+	 * @return The number of owners that were moved.
+	 */
+	int32 UpdateAnchorTransforms();
+
+protected:
+	bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	TArray<TWeakObjectPtr<UOculusXRAnchorComponent>> Anchors;
+	TSharedPtr<IOculusXRAnchorPoseProvider> PoseProvider;
+	FOculusXRAnchorLocatorTickFunction TickFunction;
+
+	// Reused between frames to avoid allocations
+	TArray<UOculusXRAnchorComponent*> LocatedAnchors;
+	TArray<uint64> Handles;
+	TArray<FTransform> Transforms;
+	TArray<bool> Located;
+};
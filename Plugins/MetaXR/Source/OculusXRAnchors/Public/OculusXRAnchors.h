@@ -73,9 +73,9 @@ namespace OculusXRAnchors
 		void HandleAnchorSaveComplete(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, bool Success, int Result, FOculusXRUUID UUID);
 		void HandleAnchorSaveListComplete(FOculusXRUInt64 RequestId, int Result);
 
-		void HandleAnchorQueryResultElement(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
-		void UpdateQuerySpacesBinding(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
-		void UpdateGetSharedAnchorsBinding(GetSharedAnchorsBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
+		void HandleAnchorQueryResultBatch(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors);
+		void UpdateQuerySpacesBinding(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors);
+		void UpdateGetSharedAnchorsBinding(GetSharedAnchorsBinding* Binding, FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchor>& Anchors);
 
 		void HandleAnchorQueryComplete(FOculusXRUInt64 RequestId, int Result);
 		void QuerySpacesComplete(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, int Result);
@@ -194,7 +194,7 @@ namespace OculusXRAnchors
 		FDelegateHandle DelegateHandleAnchorSave;
 		FDelegateHandle DelegateHandleAnchorSaveList;
 		FDelegateHandle DelegateHandleQueryResultsBegin;
-		FDelegateHandle DelegateHandleQueryResultElement;
+		FDelegateHandle DelegateHandleQueryResultBatch;
 		FDelegateHandle DelegateHandleQueryComplete;
 		FDelegateHandle DelegateHandleAnchorShare;
 		FDelegateHandle DelegateHandleAnchorsSave;
@@ -25,7 +25,9 @@ public class OculusXREditor : ModuleRules
                 "EditorStyle",
                 "Core",
                 "OculusXRHMD",
+                "OculusXRInput",
                 "OculusXRMovement",
+                "OculusXRAnchors",
                 "OculusXRPassthrough",
                 "OVRPluginXR",
                 "OculusXRProjectSetupTool",
@@ -35,6 +37,7 @@ public class OculusXREditor : ModuleRules
                 "GameProjectGeneration",
                 "SharedSettingsWidgets",
                 "RHI",
+                "RenderCore",
                 "SourceControl",
             }
         );
@@ -49,7 +52,8 @@ public class OculusXREditor : ModuleRules
         PrivateIncludePathModuleNames.AddRange(
             new string[] {
                 "Settings",
-                "OculusXRProjectSetupTool"
+                "OculusXRProjectSetupTool",
+                "InputDevice"
             }
             );
     }
@@ -0,0 +1,348 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRFrameLoopBenchmarkCommandlet.h"
+#include "OculusXRHMDModule.h"
+#include "OculusXRHMDPrivate.h"
+#include "OculusXRHMD.h"
+#include "OculusXRPluginWrapperStub.h"
+#include "OculusXRAnchorComponent.h"
+#include "OculusXRAnchorLocatorSubsystem.h"
+#include "OculusXRPassthroughColorLut.h"
+#include "IOculusXRInputModule.h"
+#include "IInputDevice.h"
+#include "GenericPlatform/GenericApplicationMessageHandler.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "RenderGraphBuilder.h"
+#include "RenderingThread.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOculusXRFrameLoopBenchmark, Log, All);
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+namespace
+{
+	struct FSectionTiming
+	{
+		const TCHAR* Name;
+		uint64 TotalCycles = 0;
+		uint64 MaxCycles = 0;
+
+		void Add(uint64 Cycles)
+		{
+			TotalCycles += Cycles;
+			MaxCycles = FMath::Max(MaxCycles, Cycles);
+		}
+	};
+
+	class FScopedSectionTimer
+	{
+	public:
+		explicit FScopedSectionTimer(FSectionTiming& InTiming)
+			: Timing(InTiming)
+			, StartCycles(FPlatformTime::Cycles64())
+		{
+		}
+
+		~FScopedSectionTimer()
+		{
+			Timing.Add(FPlatformTime::Cycles64() - StartCycles);
+		}
+
+	private:
+		FSectionTiming& Timing;
+		uint64 StartCycles;
+	};
+
+	void LogTimings(const TCHAR* Thread, TConstArrayView<FSectionTiming> Timings, int32 NumFrames)
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Display, TEXT("%-14s %12s %12s"), Thread, TEXT("Avg ms"), TEXT("Max ms"));
+		for (const FSectionTiming& Timing : Timings)
+		{
+			UE_LOG(LogOculusXRFrameLoopBenchmark, Display, TEXT("%-14s %12.4f %12.4f"), Timing.Name, FPlatformTime::ToMilliseconds64(Timing.TotalCycles) / NumFrames, FPlatformTime::ToMilliseconds64(Timing.MaxCycles));
+		}
+	}
+
+	TArray<FColor> CreateLutColors(int32 Resolution, uint8 Tint)
+	{
+		TArray<FColor> Colors;
+		Colors.SetNumUninitialized(Resolution * Resolution * Resolution);
+		for (int32 i = 0; i < Colors.Num(); ++i)
+		{
+			const int32 R = i % Resolution;
+			const int32 G = (i / Resolution) % Resolution;
+			const int32 B = i / (Resolution * Resolution);
+			Colors[i] = FColor(R * 255 / (Resolution - 1), G * 255 / (Resolution - 1), FMath::Max(B * 255 / (Resolution - 1) - Tint, 0), 255);
+		}
+		return Colors;
+	}
+} // namespace
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
+
+UOculusXRFrameLoopBenchmarkCommandlet::UOculusXRFrameLoopBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UOculusXRFrameLoopBenchmarkCommandlet::Main(const FString& Params)
+{
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+	if (!FOculusXRPluginStub::IsRequested())
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Error, TEXT("The benchmark only runs on the OVRPlugin stub, add -OVRPluginStub to the command line."));
+		return 1;
+	}
+
+	int32 NumFrames = 1000;
+	int32 NumAnchors = 64;
+	int32 NumLayers = 8;
+	int32 NumEvents = 4;
+	int32 LutResolution = 32;
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	FParse::Value(*Params, TEXT("Anchors="), NumAnchors);
+	FParse::Value(*Params, TEXT("Layers="), NumLayers);
+	FParse::Value(*Params, TEXT("Events="), NumEvents);
+	FParse::Value(*Params, TEXT("LutResolution="), LutResolution);
+	if (NumFrames <= 0 || NumAnchors < 0 || NumLayers < 0 || NumEvents < 0 || LutResolution < 2 || !FMath::IsPowerOfTwo(LutResolution))
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Error, TEXT("-Frames has to be positive, -Anchors, -Layers and -Events not negative and -LutResolution a power of two."));
+		return 1;
+	}
+
+	// Commandlets don't pre-initialize the HMD module, this binds the plugin wrapper to the stub
+	if (!FOculusXRHMDModule::Get().PreInit())
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Error, TEXT("Failed binding the OVRPlugin stub."));
+		return 1;
+	}
+	FOculusXRPluginStub::Reset();
+
+	// The HMD is created on top of the stub with a present that doesn't need a device, see CreateCustomPresent_Stub
+	const TSharedPtr<IXRTrackingSystem, ESPMode::ThreadSafe> PreviousXRSystem = GEngine->XRSystem;
+	OculusXRHMD::FOculusXRHMD* HMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
+	if (!HMD)
+	{
+		GEngine->XRSystem = FOculusXRHMDModule::Get().CreateTrackingSystem();
+		HMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
+	}
+	if (!HMD)
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Error, TEXT("Failed creating the HMD on top of the OVRPlugin stub."));
+		GEngine->XRSystem = PreviousXRSystem;
+		return 1;
+	}
+
+	// Stereo can't be enabled without a viewport. The frame is still tracked, submitted with every layer and the layer
+	// textures are created, but they are not copied into, like while the app is not visible.
+	enum EGameThreadSection
+	{
+		GameSection_Input,
+		GameSection_Events,
+		GameSection_GameFrame,
+		GameSection_Layers,
+		GameSection_RenderFrame,
+		GameSection_Anchors,
+		GameSection_Passthrough,
+		GameSection_Num
+	};
+	FSectionTiming GameTimings[GameSection_Num] = {
+		{ TEXT("Input") },
+		{ TEXT("Events") },
+		{ TEXT("GameFrame") },
+		{ TEXT("Layers") },
+		{ TEXT("RenderFrame") },
+		{ TEXT("Anchors") },
+		{ TEXT("Passthrough") },
+	};
+
+	// Without a separate RHI thread, the RHI thread work is done on the render thread and included here
+	enum ERenderThreadSection
+	{
+		RenderSection_Layers,
+		RenderSection_BeginFrame,
+		RenderSection_FinishFrame,
+		RenderSection_Submit,
+		RenderSection_Num
+	};
+	FSectionTiming RenderTimings[RenderSection_Num] = {
+		{ TEXT("Layers") },
+		{ TEXT("BeginFrame") },
+		{ TEXT("FinishFrame") },
+		{ TEXT("Submit") },
+	};
+
+	// Hand tracking runs in the input module's update, the stub always reports tracked hands
+	TSharedPtr<IInputDevice> InputDevice = IOculusXRInputModule::Get().CreateInputDevice(MakeShared<FGenericApplicationMessageHandler>());
+	if (!InputDevice.IsValid())
+	{
+		UE_LOG(LogOculusXRFrameLoopBenchmark, Warning, TEXT("No input device was created, input and hand tracking are not timed."));
+	}
+
+	// The event polling delegates of the other modules are only added when the HMD exists at module startup. Delegates
+	// can't be removed again, the counter outlives the commandlet if the HMD does.
+	const TSharedRef<int32> NumPolledEvents = MakeShared<int32>(0);
+	HMD->AddEventPollingDelegate(OculusXRHMD::FOculusXRHMDEventPollingDelegate::CreateLambda([NumPolledEvents](ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult) {
+		EventPollResult = true;
+		++*NumPolledEvents;
+	}));
+	ovrpEventDataBuffer Event;
+	FMemory::Memzero(Event);
+	Event.EventType = ovrpEventType_SpaceSetComponentStatusComplete;
+
+	// Anchors are located by the anchor locator subsystem of a game world, the HMD runs its game frame for it
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	UOculusXRAnchorLocatorSubsystem* Locator = World->GetSubsystem<UOculusXRAnchorLocatorSubsystem>();
+	TArray<UOculusXRAnchorComponent*> Anchors;
+	for (int32 i = 0; i < NumAnchors; ++i)
+	{
+		AActor* Owner = World->SpawnActor<AActor>();
+		Owner->AddComponentByClass(USceneComponent::StaticClass(), false, FTransform::Identity, false);
+		UOculusXRAnchorComponent* Anchor = Cast<UOculusXRAnchorComponent>(Owner->AddComponentByClass(UOculusXRAnchorComponent::StaticClass(), false, FTransform::Identity, false));
+		Anchor->SetHandle(i + 1);
+		Anchors.Add(Anchor);
+	}
+
+	// World locked quads in front of the user that keep moving, like UI panels following the user would
+	TArray<IStereoLayers::FLayerDesc> LayerDescs;
+	TArray<uint32> LayerIds;
+	for (int32 i = 0; i < NumLayers; ++i)
+	{
+		IStereoLayers::FLayerDesc& LayerDesc = LayerDescs.AddDefaulted_GetRef();
+		LayerDesc.Flags = IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE;
+		LayerDesc.PositionType = IStereoLayers::WorldLocked;
+		LayerDesc.Priority = i;
+		LayerDesc.QuadSize = FVector2D(50.0, 50.0);
+		LayerDesc.LayerSize = FIntPoint(512, 512);
+		LayerDesc.Transform = FTransform(FVector(200.0, 60.0 * (i - NumLayers / 2), 150.0));
+		LayerIds.Add(HMD->CreateLayer(LayerDesc));
+	}
+
+	// The color LUT alternates between two looks every frame, like an animated LUT would
+	UOculusXRPassthroughColorLut* ColorLut = NewObject<UOculusXRPassthroughColorLut>();
+	const TArray<FColor> LutColors[2] = { CreateLutColors(LutResolution, 0), CreateLutColors(LutResolution, 64) };
+
+	int32 NumMovedAnchors = 0;
+	uint64 LayersStartCycles = 0;
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		// Same order as the engine loop: input devices are ticked before the game frame starts
+		if (InputDevice.IsValid())
+		{
+			FScopedSectionTimer Timer(GameTimings[GameSection_Input]);
+			InputDevice->SendControllerEvents();
+		}
+
+		for (int32 i = 0; i < NumEvents; ++i)
+		{
+			FOculusXRPluginStub::QueueEvent(Event);
+		}
+
+		{
+			// Drains the queue, the game frame polls again but doesn't find anything then
+			FScopedSectionTimer Timer(GameTimings[GameSection_Events]);
+			HMD->UpdateHMDEvents();
+		}
+
+		{
+			FScopedSectionTimer Timer(GameTimings[GameSection_GameFrame]);
+			HMD->OnStartGameFrame(WorldContext);
+		}
+
+		{
+			FScopedSectionTimer Timer(GameTimings[GameSection_Layers]);
+			for (int32 i = 0; i < LayerIds.Num(); ++i)
+			{
+				LayerDescs[i].Transform.SetLocation(FVector(200.0, 60.0 * (i - NumLayers / 2), 150.0 + 10.0 * FMath::Sin(Frame * 0.05 + i)));
+				HMD->SetLayerDesc(LayerIds[i], LayerDescs[i]);
+			}
+		}
+
+		{
+			// Snapshots the frame and layers for the render thread, which initializes the changed layers
+			FScopedSectionTimer Timer(GameTimings[GameSection_RenderFrame]);
+			HMD->OnBeginRendering_GameThread();
+			ENQUEUE_RENDER_COMMAND(OculusXRFrameLoopBenchmarkBeginLayers)
+			([&LayersStartCycles](FRHICommandListImmediate&) {
+				LayersStartCycles = FPlatformTime::Cycles64();
+			});
+			HMD->StartRenderFrame_GameThread();
+			ENQUEUE_RENDER_COMMAND(OculusXRFrameLoopBenchmarkEndLayers)
+			([&RenderTimings, &LayersStartCycles](FRHICommandListImmediate&) {
+				RenderTimings[RenderSection_Layers].Add(FPlatformTime::Cycles64() - LayersStartCycles);
+			});
+		}
+
+		{
+			FScopedSectionTimer Timer(GameTimings[GameSection_Anchors]);
+			NumMovedAnchors += Locator->UpdateAnchorTransforms();
+		}
+
+		{
+			FScopedSectionTimer Timer(GameTimings[GameSection_Passthrough]);
+			ColorLut->SetLutFromArray(LutColors[Frame % 2], false);
+		}
+
+		HMD->OnEndGameFrame(WorldContext);
+
+		// What the view extension and the present do for a rendered view family. Waits for the render thread, so the
+		// game thread doesn't run ahead of it.
+		ExecuteOnRenderThread([HMD, &RenderTimings](FRHICommandListImmediate& RHICmdList) {
+			{
+				FScopedSectionTimer Timer(RenderTimings[RenderSection_BeginFrame]);
+				HMD->StartRHIFrame_RenderThread();
+			}
+
+			{
+				FScopedSectionTimer Timer(RenderTimings[RenderSection_FinishFrame]);
+				FRDGBuilder GraphBuilder(RHICmdList);
+				HMD->FinishRenderFrame_RenderThread(GraphBuilder);
+				GraphBuilder.Execute();
+			}
+
+			ExecuteOnRHIThread([HMD, &RenderTimings]() {
+				FScopedSectionTimer Timer(RenderTimings[RenderSection_Submit]);
+				int32 SyncInterval = 0;
+				HMD->GetCustomPresent_Internal()->Present(SyncInterval);
+			});
+		});
+	}
+	const double TotalTime = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogOculusXRFrameLoopBenchmark, Display, TEXT("%d frames in %.2f s, %d layers, %d events per frame, %d anchors, %d^3 color LUT"), NumFrames, TotalTime, NumLayers, NumEvents, NumAnchors, LutResolution);
+	LogTimings(TEXT("Game thread"), GameTimings, NumFrames);
+	LogTimings(TEXT("Render thread"), RenderTimings, NumFrames);
+	UE_LOG(LogOculusXRFrameLoopBenchmark, Display, TEXT("%d events polled, %d anchor owners moved, %d layers in the stub"), *NumPolledEvents, NumMovedAnchors, FOculusXRPluginStub::GetNumLayers());
+
+	// The handles only exist in the stub, don't let the components try to destroy them
+	for (UOculusXRAnchorComponent* Anchor : Anchors)
+	{
+		Anchor->SetHandle(0);
+	}
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	for (uint32 LayerId : LayerIds)
+	{
+		HMD->DestroyLayer(LayerId);
+	}
+	InputDevice.Reset();
+	FlushRenderingCommands();
+	GEngine->XRSystem = PreviousXRSystem;
+
+	return 0;
+#else
+	UE_LOG(LogOculusXRFrameLoopBenchmark, Error, TEXT("The OVRPlugin stub is not available on this platform."));
+	return 1;
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
+}
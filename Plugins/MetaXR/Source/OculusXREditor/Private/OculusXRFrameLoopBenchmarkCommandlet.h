@@ -0,0 +1,25 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "OculusXRFrameLoopBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs simulated frames of the HMD on top of the OVRPlugin stub and reports the game thread and render thread cost of
+ * each subsystem: input and hand tracking, event polling, the game frame, stereo layers, frame submission, anchors and
+ * color LUT updates. Needs -OVRPluginStub, e.g.
+ *   UnrealEditor-Cmd.exe Project.uproject -run=OculusXRFrameLoopBenchmark -OVRPluginStub -Frames=1000 -Layers=8 -Events=4 -Anchors=64 -LutResolution=32
+ */
+UCLASS()
+class UOculusXRFrameLoopBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOculusXRFrameLoopBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -32,6 +32,7 @@
 #include "DynamicResolutionProxy.h"
 #include "OculusXRHMDRuntimeSettings.h"
 #include "OculusXRDelegates.h"
+#include "OculusXRPluginWrapperStub.h"
 #include "DataDrivenShaderPlatformInfo.h"
 #include "GenericPlatform/GenericPlatformMath.h"
 #include "LegacyScreenPercentageDriver.h"
@@ -2816,41 +2817,49 @@ namespace OculusXRHMD
 
 		check(!CustomPresent.IsValid());
 
-		FString RHIString;
+		// The stub has no compositor, frames are submitted to it without presenting anything
+		if (FOculusXRPluginStub::IsRequested())
 		{
-			FString HardwareDetails = FHardwareInfo::GetHardwareDetailsString();
-			FString RHILookup = NAME_RHI.ToString() + TEXT("=");
-
-			if (!FParse::Value(*HardwareDetails, *RHILookup, RHIString))
+			CustomPresent = CreateCustomPresent_Stub(this);
+		}
+		else
+		{
+			FString RHIString;
 			{
-				return false;
+				FString HardwareDetails = FHardwareInfo::GetHardwareDetailsString();
+				FString RHILookup = NAME_RHI.ToString() + TEXT("=");
+
+				if (!FParse::Value(*HardwareDetails, *RHILookup, RHIString))
+				{
+					return false;
+				}
 			}
-		}
 
 #if OCULUS_HMD_SUPPORTED_PLATFORMS_D3D11
-		if (RHIString == TEXT("D3D11"))
-		{
-			CustomPresent = CreateCustomPresent_D3D11(this);
-		}
-		else
+			if (RHIString == TEXT("D3D11"))
+			{
+				CustomPresent = CreateCustomPresent_D3D11(this);
+			}
+			else
 #endif
 #if OCULUS_HMD_SUPPORTED_PLATFORMS_D3D12
-			if (RHIString == TEXT("D3D12"))
-		{
-			CustomPresent = CreateCustomPresent_D3D12(this);
-		}
-		else
+				if (RHIString == TEXT("D3D12"))
+			{
+				CustomPresent = CreateCustomPresent_D3D12(this);
+			}
+			else
 #endif
 #if OCULUS_HMD_SUPPORTED_PLATFORMS_VULKAN
-			if (RHIString == TEXT("Vulkan"))
-		{
-			CustomPresent = CreateCustomPresent_Vulkan(this);
-		}
-		else
+				if (RHIString == TEXT("Vulkan"))
+			{
+				CustomPresent = CreateCustomPresent_Vulkan(this);
+			}
+			else
 #endif
-		{
-			UE_LOG(LogHMD, Warning, TEXT("%s is not currently supported by OculusXRHMD plugin"), *RHIString);
-			return false;
+			{
+				UE_LOG(LogHMD, Warning, TEXT("%s is not currently supported by OculusXRHMD plugin"), *RHIString);
+				return false;
+			}
 		}
 
 		// grab a pointer to the renderer module for displaying our mirror window
@@ -2911,6 +2920,7 @@ namespace OculusXRHMD
 
 		Settings.Reset();
 		LayerMap.Reset();
+		LayerSnapshots.Reset();
 	}
 
 	void FOculusXRHMD::ApplicationPauseDelegate()
@@ -4638,14 +4648,7 @@ namespace OculusXRHMD
 			FGameFramePtr XFrame = NextFrameToRender->Clone();
 			TArray<FLayerPtr> XLayers;
 
-			XLayers.Empty(LayerMap.Num());
-
-			for (auto Pair : LayerMap)
-			{
-				XLayers.Emplace(Pair.Value->Clone());
-			}
-
-			XLayers.Sort(FLayerPtr_CompareId());
+			INC_DWORD_STAT_BY(STAT_LayersCopied, LayerSnapshots.Update(LayerMap, XLayers));
 
 			ExecuteOnRenderThread_DoNotWait([this, XSettings, XFrame, XLayers](FRHICommandListImmediate& RHICmdList) {
 				if (XFrame.IsValid())
@@ -4674,6 +4677,12 @@ namespace OculusXRHMD
 						{
 							DeferredDeletion.AddLayerToDeferredDeletionQueue(Layers_RenderThread[LayerIndex_RenderThread++]);
 						}
+						else if (XLayers[XLayerIndex] == Layers_RenderThread[LayerIndex_RenderThread])
+						{
+							// Unchanged since the last frame, already initialized
+							ValidXLayers.Add(XLayers[XLayerIndex++]);
+							LayerIndex_RenderThread++;
+						}
 						else
 						{
 							if (XLayers[XLayerIndex]->Initialize_RenderThread(Settings_RenderThread.Get(), CustomPresent, &DeferredDeletion, RHICmdList, Layers_RenderThread[LayerIndex_RenderThread].Get()))
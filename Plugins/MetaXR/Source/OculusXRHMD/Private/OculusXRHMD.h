@@ -529,12 +529,14 @@ namespace OculusXRHMD
 		const FRotator GetSplashRotation() const { return SplashRotation; }
 		void SetSplashRotationToForward();
 
-		OCULUSXRHMD_API void StartGameFrame_GameThread();				// Called from OnStartGameFrame or from FOculusXRInput::SendControllerEvents (first actual call of the frame)
-		void FinishGameFrame_GameThread();								// Called from OnEndGameFrame
-		void StartRenderFrame_GameThread();								// Called from BeginRenderViewFamily
-		void FinishRenderFrame_RenderThread(FRDGBuilder& GraphBuilder); // Called from PostRenderViewFamily_RenderThread
-		void StartRHIFrame_RenderThread();								// Called from PreRenderViewFamily_RenderThread
-		void FinishRHIFrame_RHIThread();								// Called from FinishRendering_RHIThread
+		// Exported for the input module and the OculusXRFrameLoopBenchmark commandlet, which drives the frame without a viewport
+		OCULUSXRHMD_API void StartGameFrame_GameThread();								// Called from OnStartGameFrame or from FOculusXRInput::SendControllerEvents (first actual call of the frame)
+		OCULUSXRHMD_API void FinishGameFrame_GameThread();								// Called from OnEndGameFrame
+		OCULUSXRHMD_API void StartRenderFrame_GameThread();								// Called from BeginRenderViewFamily
+		OCULUSXRHMD_API void FinishRenderFrame_RenderThread(FRDGBuilder& GraphBuilder); // Called from PostRenderViewFamily_RenderThread
+		OCULUSXRHMD_API void StartRHIFrame_RenderThread();								// Called from PreRenderViewFamily_RenderThread
+		void FinishRHIFrame_RHIThread();												// Called from FinishRendering_RHIThread
+		OCULUSXRHMD_API void UpdateHMDEvents();											// Called from OnStartGameFrame
 
 		void GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel);
 		void SetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel CpuPerfLevel, EOculusXRProcessorPerformanceLevel GpuPerfLevel);
@@ -577,8 +579,6 @@ namespace OculusXRHMD
 		void UpdateHMDWornState();
 		EHMDWornState::Type HMDWornState = EHMDWornState::Unknown;
 
-		void UpdateHMDEvents();
-
 		void EnableInsightPassthrough_RenderThread(bool bEnablePassthrough);
 
 		void PrepareAndRenderHardOcclusions_RenderThread(FRHICommandList& RHICmdList, FSceneView& InView);
@@ -657,6 +657,7 @@ namespace OculusXRHMD
 		FGameFramePtr LastFrameToRender; // Valid from OnStartGameFrame to BeginRenderViewFamily
 		uint32 NextLayerId;
 		TMap<uint32, FLayerPtr> LayerMap;
+		FLayerSnapshots LayerSnapshots;
 		bool bNeedReAllocateViewportRenderTarget;
 
 		// Render thread
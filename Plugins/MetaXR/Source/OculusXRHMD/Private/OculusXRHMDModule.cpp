@@ -7,6 +7,7 @@
 #include "OculusXRHMDPrivateRHI.h"
 #include "OculusXRHMDRuntimeSettings.h"
 #include "OculusXRStereoLayersFlagsSupplier.h"
+#include "OculusXRPluginWrapperStub.h"
 #include "Containers/StringConv.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/Paths.h"
@@ -162,6 +163,14 @@ bool FOculusXRHMDModule::PreInit()
 		}
 #endif
 
+		// The HMD is created on top of the stub, with a present that doesn't need a device
+		if (FOculusXRPluginStub::IsRequested())
+		{
+			bPreInitCalled = true;
+			bPreInit = OculusPluginWrapper::InitializeOculusPluginWrapper(&PluginWrapper);
+			return bPreInit;
+		}
+
 		// Init module if app can render
 		if (FApp::CanEverRender())
 		{
@@ -25,6 +25,7 @@ DECLARE_FLOAT_COUNTER_STAT(TEXT("LatencyTimewarp"), STAT_LatencyTimewarp, STATGR
 DECLARE_FLOAT_COUNTER_STAT(TEXT("LatencyPostPresent"), STAT_LatencyPostPresent, STATGROUP_OculusXRHMD);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("ErrorRender"), STAT_ErrorRender, STATGROUP_OculusXRHMD);
 DECLARE_FLOAT_COUNTER_STAT(TEXT("ErrorTimewarp"), STAT_ErrorTimewarp, STATGROUP_OculusXRHMD);
+DECLARE_DWORD_COUNTER_STAT(TEXT("LayersCopied"), STAT_LayersCopied, STATGROUP_OculusXRHMD);
 
 namespace OculusXRHMD
 {
@@ -114,6 +115,8 @@ namespace OculusXRHMD
 #if OCULUS_HMD_SUPPORTED_PLATFORMS_VULKAN
 	FCustomPresent* CreateCustomPresent_Vulkan(FOculusXRHMD* InOculusXRHMD);
 #endif
+	// Used instead of the RHI specific present when the plugin wrapper is bound to the OVRPlugin stub
+	FCustomPresent* CreateCustomPresent_Stub(FOculusXRHMD* InOculusXRHMD);
 
 } // namespace OculusXRHMD
 
@@ -0,0 +1,82 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRHMD_CustomPresent.h"
+#include "OculusXRHMDPrivateRHI.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+#include "OculusXRHMD.h"
+
+namespace OculusXRHMD
+{
+
+	//-------------------------------------------------------------------------------------------------
+	// FStubCustomPresent
+	//-------------------------------------------------------------------------------------------------
+
+	// Present for the OVRPlugin stub. The stub has no compositor to hand textures to, so swap chains are backed by plain
+	// RHI textures and nothing is presented.
+	class FStubCustomPresent : public FCustomPresent
+	{
+	public:
+		FStubCustomPresent(FOculusXRHMD* InOculusXRHMD);
+
+		// Implementation of FCustomPresent, called by Plugin itself
+		virtual bool NeedsNativePresent() override;
+		virtual FTextureRHIRef CreateTexture_RenderThread(uint32 InSizeX, uint32 InSizeY, EPixelFormat InFormat, FClearValueBinding InBinding, uint32 InNumMips, uint32 InNumSamples, uint32 InNumSamplesTileMem, ERHIResourceType InResourceType, ovrpTextureHandle InTexture, ETextureCreateFlags InTexCreateFlags) override;
+	};
+
+	FStubCustomPresent::FStubCustomPresent(FOculusXRHMD* InOculusXRHMD)
+		: FCustomPresent(InOculusXRHMD, ovrpRenderAPI_None, PF_B8G8R8A8, true)
+	{
+	}
+
+	bool FStubCustomPresent::NeedsNativePresent()
+	{
+		return false;
+	}
+
+	FTextureRHIRef FStubCustomPresent::CreateTexture_RenderThread(uint32 InSizeX, uint32 InSizeY, EPixelFormat InFormat, FClearValueBinding InBinding, uint32 InNumMips, uint32 InNumSamples, uint32 InNumSamplesTileMem, ERHIResourceType InResourceType, ovrpTextureHandle InTexture, ETextureCreateFlags InTexCreateFlags)
+	{
+		CheckInRenderThread();
+
+		// The stub hands out fake texture handles, create the textures the runtime would own instead
+		FRHITextureCreateDesc Desc;
+		switch (InResourceType)
+		{
+			case RRT_Texture2D:
+				Desc = FRHITextureCreateDesc::Create2D(TEXT("FStubCustomPresent"), InSizeX, InSizeY, InFormat);
+				break;
+
+			case RRT_Texture2DArray:
+				Desc = FRHITextureCreateDesc::Create2DArray(TEXT("FStubCustomPresent"), InSizeX, InSizeY, 2, InFormat);
+				break;
+
+			case RRT_TextureCube:
+				Desc = FRHITextureCreateDesc::CreateCube(TEXT("FStubCustomPresent"), InSizeX, InFormat);
+				break;
+
+			default:
+				return nullptr;
+		}
+
+		Desc.SetClearValue(InBinding)
+			.SetNumMips(InNumMips)
+			.SetNumSamples(InNumSamples)
+			.SetFlags(InTexCreateFlags)
+			.SetInitialState(ERHIAccess::SRVMask);
+
+		return RHICreateTexture(Desc);
+	}
+
+	//-------------------------------------------------------------------------------------------------
+	// APIs
+	//-------------------------------------------------------------------------------------------------
+
+	FCustomPresent* CreateCustomPresent_Stub(FOculusXRHMD* InOculusXRHMD)
+	{
+		return new FStubCustomPresent(InOculusXRHMD);
+	}
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
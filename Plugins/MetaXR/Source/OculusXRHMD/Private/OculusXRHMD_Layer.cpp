@@ -24,6 +24,7 @@
 #include "OculusXRHMDModule.h"
 #include "OculusXRHMD_DeferredDeletionQueue.h"
 #include "OculusXRStereoLayersFlagsSupplier.h"
+#include "Algo/BinarySearch.h"
 
 namespace OculusXRHMD
 {
@@ -58,6 +59,7 @@ namespace OculusXRHMD
 	FLayer::FLayer(uint32 InId)
 		: bNeedsTexSrgbCreate(false)
 		, Id(InId)
+		, Generation(0)
 		, OvrpLayerId(0)
 		, bUpdateTexture(false)
 		, bInvertY(false)
@@ -73,6 +75,7 @@ namespace OculusXRHMD
 	FLayer::FLayer(const FLayer& Layer)
 		: bNeedsTexSrgbCreate(Layer.bNeedsTexSrgbCreate)
 		, Id(Layer.Id)
+		, Generation(Layer.Generation)
 		, Desc(Layer.Desc)
 		, OvrpLayerId(Layer.OvrpLayerId)
 		, OvrpLayer(Layer.OvrpLayer)
@@ -109,6 +112,7 @@ namespace OculusXRHMD
 		}
 
 		Desc = InDesc;
+		++Generation;
 
 		if (!UserDefinedGeometryMap)
 		{
@@ -433,6 +437,7 @@ namespace OculusXRHMD
 	void FLayer::SetEyeLayerDesc(const ovrpLayerDesc_EyeFov& InEyeLayerDesc)
 	{
 		OvrpLayerDesc.EyeFov = InEyeLayerDesc;
+		++Generation;
 
 		bHasDepth = InEyeLayerDesc.DepthFormat != ovrpTextureFormat_None;
 	}
@@ -1519,6 +1524,51 @@ namespace OculusXRHMD
 		}
 	}
 
+
+	//-------------------------------------------------------------------------------------------------
+	// FLayerSnapshots
+	//-------------------------------------------------------------------------------------------------
+
+	int32 FLayerSnapshots::Update(const TMap<uint32, FLayerPtr>& LayerMap, TArray<FLayerPtr>& OutLayers)
+	{
+		int32 NumCopied = 0;
+
+		for (const TPair<uint32, FLayerPtr>& Pair : LayerMap)
+		{
+			const FLayerPtr& Source = Pair.Value;
+			int32 Index = Algo::LowerBoundBy(Snapshots, Pair.Key, [](const FSnapshot& Snapshot) { return Snapshot.Id; });
+
+			if (Index == Snapshots.Num() || Snapshots[Index].Id != Pair.Key)
+			{
+				Snapshots.Insert(FSnapshot{ Pair.Key, 0, nullptr, nullptr }, Index);
+			}
+
+			FSnapshot& Snapshot = Snapshots[Index];
+
+			if (Snapshot.Source != Source || Snapshot.Generation != Source->GetGeneration() || !Snapshot.Layer.IsValid() || Source->UpdatesTextureContinuously())
+			{
+				Snapshot.Source = Source;
+				Snapshot.Generation = Source->GetGeneration();
+				Snapshot.Layer = Source->Clone();
+				NumCopied++;
+			}
+		}
+
+		if (Snapshots.Num() != LayerMap.Num())
+		{
+			Snapshots.RemoveAll([&LayerMap](const FSnapshot& Snapshot) { return !LayerMap.Contains(Snapshot.Id); });
+		}
+
+		OutLayers.Reset(Snapshots.Num());
+
+		for (const FSnapshot& Snapshot : Snapshots)
+		{
+			OutLayers.Add(Snapshot.Layer);
+		}
+
+		return NumCopied;
+	}
+
 } // namespace OculusXRHMD
 
 #endif // OCULUS_HMD_SUPPORTED_PLATFORMS
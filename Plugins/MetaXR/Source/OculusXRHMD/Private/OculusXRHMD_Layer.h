@@ -45,6 +45,8 @@ namespace OculusXRHMD
 		~FLayer();
 
 		uint32 GetId() const { return Id; }
+		// Changes whenever the layer is modified in place, so copies can tell whether they are still up to date
+		uint32 GetGeneration() const { return Generation; }
 		int GetOvrpId() const { return OvrpLayerId; }
 		void SetDesc(const IStereoLayers::FLayerDesc& InDesc);
 		void SetDesc(const FSettings* Settings, const IStereoLayers::FLayerDesc& InDesc);
@@ -56,7 +58,11 @@ namespace OculusXRHMD
 		const FXRSwapChainPtr& GetFoveationSwapChain() const { return FoveationSwapChain; }
 		const FXRSwapChainPtr& GetMotionVectorSwapChain() const { return MotionVectorSwapChain; }
 		const FXRSwapChainPtr& GetMotionVectorDepthSwapChain() const { return MotionVectorDepthSwapChain; }
-		void MarkTextureForUpdate() { bUpdateTexture = true; }
+		void MarkTextureForUpdate()
+		{
+			bUpdateTexture = true;
+			++Generation;
+		}
 		bool NeedsPokeAHole();
 		void HandlePokeAHoleComponent();
 		void BuildPokeAHoleMesh(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector2D>& UV0);
@@ -76,7 +82,9 @@ namespace OculusXRHMD
 		const ovrpLayerSubmit* UpdateLayer_RHIThread(const FSettings* Settings, const FGameFrame* Frame, const int LayerIndex);
 		void IncrementSwapChainIndex_RHIThread(FCustomPresent* CustomPresent);
 		void ReleaseResources_RHIThread();
-		bool IsVisible() { return (Desc.Flags & IStereoLayers::LAYER_FLAG_HIDDEN) == 0; }
+		bool IsVisible() const { return (Desc.Flags & IStereoLayers::LAYER_FLAG_HIDDEN) == 0; }
+		// Initialize_RenderThread marks the texture of these layers for update every frame
+		bool UpdatesTextureContinuously() const { return (Desc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && IsVisible(); }
 
 		bool bNeedsTexSrgbCreate;
 
@@ -118,6 +126,7 @@ namespace OculusXRHMD
 		void UpdatePassthroughPokeActors_GameThread();
 
 		uint32 Id;
+		uint32 Generation;
 		IStereoLayers::FLayerDesc Desc;
 		int OvrpLayerId;
 		ovrpLayerDescUnion OvrpLayerDesc;
@@ -145,6 +154,34 @@ namespace OculusXRHMD
 
 	typedef TSharedPtr<FLayer, ESPMode::ThreadSafe> FLayerPtr;
 
+	//-------------------------------------------------------------------------------------------------
+	// FLayerSnapshots
+	//-------------------------------------------------------------------------------------------------
+
+	// Copies of the game thread layers that are handed to the render thread every frame. The copies are kept sorted by
+	// layer id and a layer is only copied again when it was replaced or modified since the last frame, unchanged layers
+	// hand the same copy to the render thread again. Visible continuous update layers are copied every frame, so that the
+	// render thread initializes them again and copies their texture.
+	class FLayerSnapshots
+	{
+	public:
+		// Brings the copies up to date with LayerMap and fills OutLayers with them, sorted by layer id.
+		// Returns the number of layers that had to be copied.
+		int32 Update(const TMap<uint32, FLayerPtr>& LayerMap, TArray<FLayerPtr>& OutLayers);
+		void Reset() { Snapshots.Reset(); }
+
+	protected:
+		struct FSnapshot
+		{
+			uint32 Id;
+			uint32 Generation;
+			FLayerPtr Source;
+			FLayerPtr Layer;
+		};
+
+		TArray<FSnapshot> Snapshots;
+	};
+
 	//-------------------------------------------------------------------------------------------------
 	// FLayerPtr_CompareId
 	//-------------------------------------------------------------------------------------------------
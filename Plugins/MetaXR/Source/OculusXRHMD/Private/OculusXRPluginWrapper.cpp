@@ -3,6 +3,7 @@
 
 #include "OculusXRPluginWrapper.h"
 #include "OculusXRHMDModule.h"
+#include "OculusXRPluginWrapperStub.h"
 
 #if PLATFORM_ANDROID
 #include <dlfcn.h>
@@ -21,6 +22,8 @@ bool OculusPluginWrapper::InitializeOculusPluginWrapper(OculusPluginWrapper* wra
 		return true;
 	}
 
+	const bool bUseStub = FOculusXRPluginStub::IsRequested();
+
 #if OCULUS_HMD_SUPPORTED_PLATFORMS
 	void* LibraryHandle = nullptr;
 
@@ -30,7 +33,11 @@ bool OculusPluginWrapper::InitializeOculusPluginWrapper(OculusPluginWrapper* wra
 	const bool VersionValid = true;
 #endif
 
-	if (VersionValid)
+	if (bUseStub)
+	{
+		UE_LOG(LogOculusPluginWrapper, Log, TEXT("Using the OVRPlugin stub instead of the runtime"));
+	}
+	else if (VersionValid)
 	{
 		LibraryHandle = FOculusXRHMDModule::GetOVRPluginHandle();
 		if (LibraryHandle == nullptr)
@@ -51,11 +58,12 @@ bool OculusPluginWrapper::InitializeOculusPluginWrapper(OculusPluginWrapper* wra
 	{
 		const char* EntryPointName;
 		void** EntryPointPtr;
+		void* StubEntryPoint;
 	};
 
-#define OCULUS_BIND_ENTRY_POINT(Func)         \
-	{                                         \
-		"ovrp_" #Func, (void**)&wrapper->Func \
+#define OCULUS_BIND_ENTRY_POINT(Func)                                                                   \
+	{                                                                                                   \
+		"ovrp_" #Func, (void**)&wrapper->Func, (void*)&TOculusXRPluginStubEntryPoint<ovrp_##Func>::Call \
 	}
 
 	OculusEntryPoint entryPointArray[] = {
@@ -422,7 +430,7 @@ bool OculusPluginWrapper::InitializeOculusPluginWrapper(OculusPluginWrapper* wra
 	bool result = true;
 	for (int i = 0; i < UE_ARRAY_COUNT(entryPointArray); ++i)
 	{
-		*(entryPointArray[i].EntryPointPtr) = LoadEntryPoint(LibraryHandle, entryPointArray[i].EntryPointName);
+		*(entryPointArray[i].EntryPointPtr) = bUseStub ? entryPointArray[i].StubEntryPoint : LoadEntryPoint(LibraryHandle, entryPointArray[i].EntryPointName);
 
 		if (*entryPointArray[i].EntryPointPtr == nullptr)
 		{
@@ -431,6 +439,11 @@ bool OculusPluginWrapper::InitializeOculusPluginWrapper(OculusPluginWrapper* wra
 		}
 	}
 
+	if (bUseStub)
+	{
+		FOculusXRPluginStub::Bind(wrapper);
+	}
+
 	wrapper->Initialized = true;
 
 	if (result)
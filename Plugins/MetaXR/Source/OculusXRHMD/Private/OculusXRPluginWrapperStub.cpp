@@ -0,0 +1,420 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRPluginWrapperStub.h"
+#include "Containers/Queue.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+	// The scripted data advances as if the display ran at this rate
+	constexpr double StubDisplayFrequency = 72.0;
+
+	// Recommended eye buffer size at a pixel density of 1
+	constexpr int StubEyeTextureSize = 1024;
+
+	std::atomic<int32> StubFrameIndex{ 0 };
+	std::atomic<bool> bStubInitialized{ true };
+
+	FCriticalSection StubLock;
+	int StubNextLayerId = 1;
+	int StubEyeFovLayerId = 0;
+	TSet<int> StubLayerIds;
+	ovrpTextureHandle StubNextTexture = 1;
+	ovrpPassthroughColorLut StubNextColorLut = 1;
+	TSet<ovrpPassthroughColorLut> StubColorLuts;
+	TQueue<ovrpEventDataBuffer> StubEvents;
+
+	double GetStubTime(int32 FrameIndex)
+	{
+		return FrameIndex / StubDisplayFrequency;
+	}
+
+	ovrpQuatf MakeYawQuat(double Yaw)
+	{
+		return ovrpQuatf{ 0.0f, static_cast<float>(FMath::Sin(Yaw * 0.5)), 0.0f, static_cast<float>(FMath::Cos(Yaw * 0.5)) };
+	}
+
+	ovrpVector3f MakeVector(double X, double Y, double Z)
+	{
+		return ovrpVector3f{ static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z) };
+	}
+
+	bool IsTrackedNode(ovrpNode Node)
+	{
+		switch (Node)
+		{
+			case ovrpNode_EyeLeft:
+			case ovrpNode_EyeRight:
+			case ovrpNode_EyeCenter:
+			case ovrpNode_HandLeft:
+			case ovrpNode_HandRight:
+			case ovrpNode_Head:
+				return true;
+			default:
+				return false;
+		}
+	}
+
+	ovrpResult GetTrackedNodeFlag(ovrpNode Node, ovrpBool* Flag)
+	{
+		if (!Flag)
+		{
+			return ovrpFailure_InvalidParameter;
+		}
+		*Flag = IsTrackedNode(Node) ? ovrpBool_True : ovrpBool_False;
+		return ovrpSuccess;
+	}
+} // namespace
+
+bool FOculusXRPluginStub::IsRequested()
+{
+	return FParse::Param(FCommandLine::Get(), TEXT("OVRPluginStub"));
+}
+
+void FOculusXRPluginStub::Bind(OculusPluginWrapper* Wrapper)
+{
+	Reset();
+
+	Wrapper->GetInitialized = []() -> ovrpBool {
+		return bStubInitialized ? ovrpBool_True : ovrpBool_False;
+	};
+
+	Wrapper->PreInitialize5 = [](void*, ovrpRenderAPIType, ovrpPreinitializeFlags) {
+		return ovrpSuccess;
+	};
+
+	Wrapper->Shutdown2 = []() {
+		bStubInitialized = false;
+		return ovrpSuccess;
+	};
+
+	Wrapper->SetLogCallback2 = [](ovrpLogCallback2) {
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetVersion2 = [](char const** Version) {
+		*Version = "stub";
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetNativeXrApiType = [](ovrpXrApi* XrApi) {
+		*XrApi = ovrpXrApi_OpenXR;
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetAppHasVrFocus2 = [](ovrpBool* AppHasVrFocus) {
+		*AppHasVrFocus = ovrpBool_True;
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetUserPresent2 = [](ovrpBool* UserPresent) {
+		*UserPresent = ovrpBool_True;
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetSystemDisplayFrequency2 = [](float* SystemDisplayFrequency) {
+		*SystemDisplayFrequency = static_cast<float>(StubDisplayFrequency);
+		return ovrpSuccess;
+	};
+
+	// Tracking
+
+	Wrapper->Update3 = [](ovrpStep, int FrameIndex, double) {
+		StubFrameIndex = FrameIndex;
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetTrackingOriginType2 = [](ovrpTrackingOrigin* TrackingOrigin) {
+		*TrackingOrigin = ovrpTrackingOrigin_EyeLevel;
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetNodePresent2 = &GetTrackedNodeFlag;
+	Wrapper->GetNodeOrientationTracked2 = &GetTrackedNodeFlag;
+	Wrapper->GetNodePositionTracked2 = &GetTrackedNodeFlag;
+
+	Wrapper->GetNodePoseState3 = [](ovrpStep, int FrameIndex, ovrpNode Node, ovrpPoseStatef* PoseState) {
+		if (!IsTrackedNode(Node))
+		{
+			return ovrpFailure_InvalidParameter;
+		}
+		FMemory::Memzero(*PoseState);
+		PoseState->Pose = GetNodePose(Node, FrameIndex);
+		PoseState->Time = GetStubTime(FrameIndex);
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetHandState = [](ovrpStep, ovrpHand Hand, ovrpHandState* HandState) {
+		GetHandState(Hand, StubFrameIndex, *HandState);
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetHandState2 = [](ovrpStep, int FrameIndex, ovrpHand Hand, ovrpHandState* HandState) {
+		GetHandState(Hand, FrameIndex, *HandState);
+		return ovrpSuccess;
+	};
+
+	// Hands are tracked, controllers are never connected
+	Wrapper->GetControllerState6 = [](ovrpController ControllerMask, ovrpControllerState6* ControllerState) {
+		FMemory::Memzero(*ControllerState);
+		ControllerState->ConnectedControllerTypes = ControllerMask & ovrpController_Hands;
+		return ovrpSuccess;
+	};
+
+	Wrapper->LocateSpace2 = [](ovrpSpaceLocationf* Location, const ovrpSpace* Space, ovrpTrackingOrigin) {
+		// Position and orientation valid and tracked
+		Location->locationFlags = 0xF;
+		Location->pose = GetSpacePose(*Space, StubFrameIndex);
+		return ovrpSuccess;
+	};
+
+	// Layers
+
+	Wrapper->CalculateEyeLayerDesc3 = [](ovrpLayout Layout, float TextureScale, int MipLevels, int SampleCount, ovrpTextureFormat Format, ovrpTextureFormat DepthFormat, ovrpTextureFormat MotionVectorFormat, ovrpTextureFormat MotionVectorDepthFormat, float, int LayerFlags, ovrpLayerDesc_EyeFov* LayerDesc) {
+		FMemory::Memzero(*LayerDesc);
+		const int EyeTextureSize = FMath::Max(FMath::RoundToInt(StubEyeTextureSize * TextureScale), 1);
+		LayerDesc->Shape = ovrpShape_EyeFov;
+		LayerDesc->Layout = Layout;
+		LayerDesc->TextureSize = ovrpSizei{ Layout == ovrpLayout_DoubleWide ? EyeTextureSize * 2 : EyeTextureSize, EyeTextureSize };
+		LayerDesc->MipLevels = MipLevels;
+		LayerDesc->SampleCount = SampleCount;
+		LayerDesc->Format = Format;
+		LayerDesc->LayerFlags = LayerFlags;
+		for (int Eye = 0; Eye < ovrpEye_Count; ++Eye)
+		{
+			// 90 degrees both ways
+			LayerDesc->Fov[Eye] = ovrpFovf{ 1.0f, 1.0f, 1.0f, 1.0f };
+			LayerDesc->VisibleRect[Eye] = ovrpRectf{ { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+		}
+		LayerDesc->MaxViewportSize = ovrpSizei{ EyeTextureSize, EyeTextureSize };
+		LayerDesc->DepthFormat = DepthFormat;
+		LayerDesc->MotionVectorFormat = MotionVectorFormat;
+		LayerDesc->MotionVectorDepthFormat = MotionVectorDepthFormat;
+		LayerDesc->MotionVectorTextureSize = LayerDesc->MaxViewportSize;
+		return ovrpSuccess;
+	};
+
+	Wrapper->CalculateLayerDesc = [](ovrpShape Shape, ovrpLayout Layout, const ovrpSizei& TextureSize, int MipLevels, int SampleCount, ovrpTextureFormat Format, int LayerFlags, ovrpLayerDescUnion* LayerDesc) {
+		FMemory::Memzero(*LayerDesc);
+		LayerDesc->Shape = Shape;
+		LayerDesc->Layout = Layout;
+		LayerDesc->TextureSize = TextureSize;
+		LayerDesc->MipLevels = MipLevels;
+		LayerDesc->SampleCount = SampleCount;
+		LayerDesc->Format = Format;
+		LayerDesc->LayerFlags = LayerFlags;
+		return ovrpSuccess;
+	};
+
+	Wrapper->SetupLayer = [](void*, const ovrpLayerDesc&, int* LayerId) {
+		FScopeLock Lock(&StubLock);
+		*LayerId = StubNextLayerId++;
+		StubLayerIds.Add(*LayerId);
+		return ovrpSuccess;
+	};
+
+	Wrapper->GetEyeFovLayerId = [](int* LayerId) {
+		FScopeLock Lock(&StubLock);
+		if (StubEyeFovLayerId == 0)
+		{
+			StubEyeFovLayerId = StubNextLayerId++;
+			StubLayerIds.Add(StubEyeFovLayerId);
+		}
+		*LayerId = StubEyeFovLayerId;
+		return ovrpSuccess;
+	};
+
+	Wrapper->DestroyLayer = [](int LayerId) {
+		FScopeLock Lock(&StubLock);
+		if (LayerId == StubEyeFovLayerId)
+		{
+			StubEyeFovLayerId = 0;
+		}
+		return StubLayerIds.Remove(LayerId) > 0 ? ovrpSuccess : ovrpFailure_InvalidParameter;
+	};
+
+	Wrapper->GetLayerTextureStageCount = [](int, int* StageCount) {
+		*StageCount = 3;
+		return ovrpSuccess;
+	};
+
+	// Every stage and eye of a layer gets its own handle, the present creates the textures behind them
+	Wrapper->GetLayerTexture2 = [](int LayerId, int, ovrpEye, ovrpTextureHandle* TextureHandle, ovrpTextureHandle* DepthTextureHandle) {
+		FScopeLock Lock(&StubLock);
+		if (!StubLayerIds.Contains(LayerId))
+		{
+			return ovrpFailure_InvalidParameter;
+		}
+		*TextureHandle = StubNextTexture++;
+		if (DepthTextureHandle)
+		{
+			*DepthTextureHandle = StubNextTexture++;
+		}
+		return ovrpSuccess;
+	};
+
+	Wrapper->WaitToBeginFrame = [](int) {
+		return ovrpSuccess;
+	};
+
+	Wrapper->BeginFrame4 = [](int, void*) {
+		return ovrpSuccess;
+	};
+
+	Wrapper->EndFrame4 = [](int, ovrpLayerSubmit const* const*, int, void*) {
+		return ovrpSuccess;
+	};
+
+	// Events
+
+	Wrapper->PollEvent = [](ovrpEventDataBuffer* EventBuffer) {
+		FScopeLock Lock(&StubLock);
+		if (!StubEvents.Dequeue(*EventBuffer))
+		{
+			EventBuffer->EventType = ovrpEventType_None;
+		}
+		return ovrpSuccess;
+	};
+
+	// Passthrough color LUTs
+
+	Wrapper->GetPassthroughCapabilities = [](ovrpInsightPassthroughCapabilities* Capabilities) {
+		Capabilities->MaxColorLutResolution = 64;
+		return ovrpSuccess;
+	};
+
+	Wrapper->CreatePassthroughColorLut = [](ovrpPassthroughColorLutChannels, ovrpUInt32, ovrpPassthroughColorLutData, ovrpPassthroughColorLut* ColorLut) {
+		FScopeLock Lock(&StubLock);
+		*ColorLut = StubNextColorLut++;
+		StubColorLuts.Add(*ColorLut);
+		return ovrpSuccess;
+	};
+
+	Wrapper->UpdatePassthroughColorLut = [](ovrpPassthroughColorLut ColorLut, ovrpPassthroughColorLutData) {
+		FScopeLock Lock(&StubLock);
+		return StubColorLuts.Contains(ColorLut) ? ovrpSuccess : ovrpFailure_InvalidParameter;
+	};
+
+	Wrapper->DestroyPassthroughColorLut = [](ovrpPassthroughColorLut ColorLut) {
+		FScopeLock Lock(&StubLock);
+		return StubColorLuts.Remove(ColorLut) > 0 ? ovrpSuccess : ovrpFailure_InvalidParameter;
+	};
+}
+
+void FOculusXRPluginStub::Reset()
+{
+	FScopeLock Lock(&StubLock);
+	StubFrameIndex = 0;
+	bStubInitialized = true;
+	StubNextLayerId = 1;
+	StubEyeFovLayerId = 0;
+	StubLayerIds.Reset();
+	StubNextTexture = 1;
+	StubNextColorLut = 1;
+	StubColorLuts.Reset();
+	StubEvents.Empty();
+}
+
+int32 FOculusXRPluginStub::GetFrameIndex()
+{
+	return StubFrameIndex;
+}
+
+void FOculusXRPluginStub::QueueEvent(const ovrpEventDataBuffer& Event)
+{
+	FScopeLock Lock(&StubLock);
+	StubEvents.Enqueue(Event);
+}
+
+ovrpPosef FOculusXRPluginStub::GetNodePose(ovrpNode Node, int32 FrameIndex)
+{
+	// The head looks around slowly while swaying a little, eyes and hands follow the head
+	const double Time = GetStubTime(FrameIndex);
+	const double Yaw = FMath::DegreesToRadians(20.0) * FMath::Sin(Time * 0.5);
+	const ovrpVector3f HeadPosition = MakeVector(0.05 * FMath::Sin(Time), 1.6 + 0.02 * FMath::Sin(Time * 2.0), 0.05 * FMath::Cos(Time));
+
+	double OffsetX = 0.0;
+	double OffsetY = 0.0;
+	double OffsetZ = 0.0;
+	switch (Node)
+	{
+		case ovrpNode_EyeLeft:
+			OffsetX = -0.032;
+			break;
+		case ovrpNode_EyeRight:
+			OffsetX = 0.032;
+			break;
+		case ovrpNode_HandLeft:
+			OffsetX = -0.2;
+			OffsetY = -0.4 + 0.1 * FMath::Sin(Time * 3.0);
+			OffsetZ = -0.3;
+			break;
+		case ovrpNode_HandRight:
+			OffsetX = 0.2;
+			OffsetY = -0.4 + 0.1 * FMath::Cos(Time * 3.0);
+			OffsetZ = -0.3;
+			break;
+		default:
+			break;
+	}
+
+	// Rotate the offset with the head around the up axis
+	const double Cos = FMath::Cos(Yaw);
+	const double Sin = FMath::Sin(Yaw);
+	ovrpPosef Pose;
+	Pose.Orientation = MakeYawQuat(Yaw);
+	Pose.Position = MakeVector(HeadPosition.x + Cos * OffsetX + Sin * OffsetZ, HeadPosition.y + OffsetY, HeadPosition.z - Sin * OffsetX + Cos * OffsetZ);
+	return Pose;
+}
+
+ovrpPosef FOculusXRPluginStub::GetSpacePose(ovrpSpace Space, int32 FrameIndex)
+{
+	// Spaces are lined up along the forward axis, every other one bobs up and down
+	const double Bob = (Space % 2) == 0 ? 0.05 * FMath::Sin(GetStubTime(FrameIndex) + Space) : 0.0;
+	ovrpPosef Pose;
+	Pose.Orientation = MakeYawQuat(FMath::DegreesToRadians(static_cast<double>(Space % 360)));
+	Pose.Position = MakeVector(0.0, Bob, -0.1 * static_cast<double>(Space));
+	return Pose;
+}
+
+void FOculusXRPluginStub::GetHandState(ovrpHand Hand, int32 FrameIndex, ovrpHandState& OutHandState)
+{
+	const double Time = GetStubTime(FrameIndex);
+
+	FMemory::Memzero(OutHandState);
+	OutHandState.Status = ovrpHandStatus_HandTracked | ovrpHandStatus_InputValid;
+	OutHandState.RootPose = GetNodePose(Hand == ovrpHand_Left ? ovrpNode_HandLeft : ovrpNode_HandRight, FrameIndex);
+	OutHandState.PointerPose = OutHandState.RootPose;
+	for (ovrpQuatf& BoneRotation : OutHandState.BoneRotations)
+	{
+		BoneRotation.w = 1.0f;
+	}
+
+	// Every finger pinches in turn
+	for (int32 Finger = 0; Finger < ovrpHandFinger_Max; ++Finger)
+	{
+		OutHandState.PinchStrength[Finger] = 0.5f + 0.5f * static_cast<float>(FMath::Sin(Time * PI + Finger));
+		if (OutHandState.PinchStrength[Finger] > 0.9f)
+		{
+			OutHandState.Pinches |= 1 << Finger;
+		}
+		OutHandState.FingerConfidences[Finger] = ovrpTrackingConfidence_High;
+	}
+	OutHandState.HandScale = 1.0f;
+	OutHandState.HandConfidence = ovrpTrackingConfidence_High;
+	OutHandState.RequestedTimeStamp = Time;
+}
+
+int32 FOculusXRPluginStub::GetNumLayers()
+{
+	FScopeLock Lock(&StubLock);
+	return StubLayerIds.Num();
+}
+
+int32 FOculusXRPluginStub::GetNumColorLuts()
+{
+	FScopeLock Lock(&StubLock);
+	return StubColorLuts.Num();
+}
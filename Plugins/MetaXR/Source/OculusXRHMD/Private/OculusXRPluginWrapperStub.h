@@ -0,0 +1,56 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "OculusXRPluginWrapper.h"
+
+/**
+ * Deterministic in-process stand-in for OVRPlugin, bound to the plugin wrapper instead of the runtime when the command
+ * line contains -OVRPluginStub. Poses, hand states and space locations are generated from the frame index, layers,
+ * layer textures and color LUTs get increasing ids and events are returned in the order they were queued. Hands are
+ * tracked, controllers are never connected. All other entry points fail with ovrpFailure_Unsupported.
+ *
+ * The HMD is created on top of the stub with a present that backs the layer textures with plain RHI textures and doesn't
+ * present anything. This makes it possible to run the frame loop without a headset, e.g. in the
+ * OculusXRFrameLoopBenchmark commandlet.
+ */
+class OCULUSXRHMD_API FOculusXRPluginStub
+{
+public:
+	static bool IsRequested();
+
+	// Points the scripted entry points of the wrapper at the stub
+	static void Bind(OculusPluginWrapper* Wrapper);
+
+	// Starts over at frame 0 without any layers, color LUTs or queued events
+	static void Reset();
+
+	// Frame the scripted data is generated for when the caller doesn't pass one. Set by Update3.
+	static int32 GetFrameIndex();
+
+	// Returned by PollEvent in the order they were queued
+	static void QueueEvent(const ovrpEventDataBuffer& Event);
+
+	static ovrpPosef GetNodePose(ovrpNode Node, int32 FrameIndex);
+	static ovrpPosef GetSpacePose(ovrpSpace Space, int32 FrameIndex);
+	static void GetHandState(ovrpHand Hand, int32 FrameIndex, ovrpHandState& OutHandState);
+
+	static int32 GetNumLayers();
+	static int32 GetNumColorLuts();
+};
+
+// Default implementation for every entry point of the wrapper the stub doesn't script
+template <typename FuncType>
+struct TOculusXRPluginStubEntryPoint;
+
+template <typename... ArgTypes>
+struct TOculusXRPluginStubEntryPoint<ovrpResult(ArgTypes...)>
+{
+	static ovrpResult Call(ArgTypes...) { return ovrpFailure_Unsupported; }
+};
+
+template <typename... ArgTypes>
+struct TOculusXRPluginStubEntryPoint<ovrpBool(ArgTypes...)>
+{
+	static ovrpBool Call(ArgTypes...) { return ovrpBool_False; }
+};
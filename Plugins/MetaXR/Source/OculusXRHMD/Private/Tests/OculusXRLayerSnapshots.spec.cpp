@@ -0,0 +1,153 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRHMD_Layer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && OCULUS_HMD_SUPPORTED_PLATFORMS
+
+using namespace OculusXRHMD;
+
+BEGIN_DEFINE_SPEC(FOculusXRLayerSnapshotsSpec, TEXT("OculusXR.HMD.LayerSnapshots"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+TMap<uint32, FLayerPtr> LayerMap;
+FLayerSnapshots LayerSnapshots;
+TArray<FLayerPtr> Layers;
+
+void AddLayers(int32 NumLayers);
+void ReplaceLayer(uint32 Id);
+END_DEFINE_SPEC(FOculusXRLayerSnapshotsSpec)
+
+void FOculusXRLayerSnapshotsSpec::AddLayers(int32 NumLayers)
+{
+	// Add in descending order, the snapshots have to come out sorted anyway
+	for (int32 i = NumLayers - 1; i >= 0; --i)
+	{
+		LayerMap.Add(i, MakeShareable(new FLayer(i)));
+	}
+}
+
+void FOculusXRLayerSnapshotsSpec::ReplaceLayer(uint32 Id)
+{
+	// Same as FOculusXRHMD::SetLayerDesc
+	FLayerPtr& Layer = LayerMap[Id];
+	Layer = MakeShareable(new FLayer(*Layer));
+}
+
+void FOculusXRLayerSnapshotsSpec::Define()
+{
+	AfterEach([this]() {
+		LayerMap.Reset();
+		LayerSnapshots.Reset();
+		Layers.Reset();
+	});
+
+	It(TEXT("Hands out the layers sorted by id"), [this]() {
+		AddLayers(16);
+
+		TestEqual(TEXT("Copied layers"), LayerSnapshots.Update(LayerMap, Layers), 16);
+		if (TestEqual(TEXT("Layers"), Layers.Num(), 16))
+		{
+			for (int32 i = 0; i < Layers.Num(); ++i)
+			{
+				TestEqual(TEXT("Layer id"), Layers[i]->GetId(), static_cast<uint32>(i));
+				TestTrue(TEXT("Layer is a copy"), Layers[i] != LayerMap[i]);
+			}
+		}
+	});
+
+	It(TEXT("Only copies layers that changed"), [this]() {
+		AddLayers(16);
+		LayerSnapshots.Update(LayerMap, Layers);
+		const TArray<FLayerPtr> PreviousLayers = Layers;
+
+		TestEqual(TEXT("Copied layers without changes"), LayerSnapshots.Update(LayerMap, Layers), 0);
+		TestTrue(TEXT("Same copies without changes"), Layers == PreviousLayers);
+
+		ReplaceLayer(3);
+		LayerMap[7]->MarkTextureForUpdate();
+		TestEqual(TEXT("Copied layers after changes"), LayerSnapshots.Update(LayerMap, Layers), 2);
+		TestTrue(TEXT("Replaced layer is copied again"), Layers[3] != PreviousLayers[3]);
+		TestTrue(TEXT("Modified layer is copied again"), Layers[7] != PreviousLayers[7]);
+		TestTrue(TEXT("Unchanged layer keeps its copy"), Layers[4] == PreviousLayers[4]);
+	});
+
+	It(TEXT("Copies continuous update layers every frame"), [this]() {
+		AddLayers(4);
+		IStereoLayers::FLayerDesc Desc;
+		Desc.Flags = IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE;
+		LayerMap[1]->SetDesc(Desc);
+		Desc.Flags |= IStereoLayers::LAYER_FLAG_HIDDEN;
+		LayerMap[2]->SetDesc(Desc);
+		LayerSnapshots.Update(LayerMap, Layers);
+
+		// The render thread only initializes a layer again, and with it marks its texture for update, if it gets a new copy
+		for (int32 Frame = 1; Frame < 4; ++Frame)
+		{
+			const TArray<FLayerPtr> PreviousLayers = Layers;
+			TestEqual(TEXT("Copied layers"), LayerSnapshots.Update(LayerMap, Layers), 1);
+			TestTrue(TEXT("Continuous update layer is copied again"), Layers[1] != PreviousLayers[1]);
+			TestTrue(TEXT("Hidden continuous update layer keeps its copy"), Layers[2] == PreviousLayers[2]);
+			TestTrue(TEXT("Static layer keeps its copy"), Layers[0] == PreviousLayers[0]);
+		}
+	});
+
+	It(TEXT("Follows added and removed layers"), [this]() {
+		AddLayers(8);
+		LayerSnapshots.Update(LayerMap, Layers);
+
+		LayerMap.Remove(2);
+		LayerMap.Remove(5);
+		LayerMap.Add(20, MakeShareable(new FLayer(20)));
+		LayerMap.Add(10, MakeShareable(new FLayer(10)));
+
+		TestEqual(TEXT("Copied layers"), LayerSnapshots.Update(LayerMap, Layers), 2);
+		TArray<uint32> Ids;
+		for (const FLayerPtr& Layer : Layers)
+		{
+			Ids.Add(Layer->GetId());
+		}
+		TestTrue(TEXT("Layer ids"), Ids == TArray<uint32>({ 0, 1, 3, 4, 6, 7, 10, 20 }));
+	});
+
+	It(TEXT("Hands out 64 static and 4 animated layers"), [this]() {
+		constexpr int32 NumStaticLayers = 64;
+		constexpr int32 NumAnimatedLayers = 4;
+		constexpr int32 NumFrames = 1000;
+		AddLayers(NumStaticLayers + NumAnimatedLayers);
+
+		// What FOculusXRHMD::StartGameFrame used to do every frame
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 i = 0; i < NumAnimatedLayers; ++i)
+			{
+				ReplaceLayer(NumStaticLayers + i);
+			}
+			Layers.Empty(LayerMap.Num());
+			for (auto Pair : LayerMap)
+			{
+				Layers.Emplace(Pair.Value->Clone());
+			}
+			Layers.Sort(FLayerPtr_CompareId());
+		}
+		const double CloneAllTime = FPlatformTime::Seconds() - StartTime;
+
+		LayerSnapshots.Update(LayerMap, Layers);
+		int32 NumCopied = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			for (int32 i = 0; i < NumAnimatedLayers; ++i)
+			{
+				ReplaceLayer(NumStaticLayers + i);
+			}
+			NumCopied += LayerSnapshots.Update(LayerMap, Layers);
+		}
+		const double SnapshotTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Copied layers"), NumCopied, NumAnimatedLayers * NumFrames);
+		TestEqual(TEXT("Layers"), Layers.Num(), NumStaticLayers + NumAnimatedLayers);
+		AddInfo(FString::Printf(TEXT("%d static and %d animated layers per frame: clone all %.4f ms, snapshots %.4f ms"), NumStaticLayers, NumAnimatedLayers, CloneAllTime * 1000.0 / NumFrames, SnapshotTime * 1000.0 / NumFrames));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && OCULUS_HMD_SUPPORTED_PLATFORMS
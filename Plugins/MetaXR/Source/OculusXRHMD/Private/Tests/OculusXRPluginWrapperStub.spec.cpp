@@ -0,0 +1,82 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRPluginWrapperStub.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && OCULUS_HMD_SUPPORTED_PLATFORMS
+
+BEGIN_DEFINE_SPEC(FOculusXRPluginWrapperStubSpec, TEXT("OculusXR.HMD.PluginWrapperStub"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+OculusPluginWrapper Wrapper;
+END_DEFINE_SPEC(FOculusXRPluginWrapperStubSpec)
+
+void FOculusXRPluginWrapperStubSpec::Define()
+{
+	BeforeEach([this]() {
+		Wrapper.Reset();
+		FOculusXRPluginStub::Bind(&Wrapper);
+	});
+
+	AfterEach([this]() {
+		FOculusXRPluginStub::Reset();
+	});
+
+	It(TEXT("Returns the same poses for the same frame"), [this]() {
+		ovrpPoseStatef First;
+		ovrpPoseStatef Second;
+		TestTrue(TEXT("Head pose"), OVRP_SUCCESS(Wrapper.GetNodePoseState3(ovrpStep_Render, 42, ovrpNode_Head, &First)));
+		Wrapper.GetNodePoseState3(ovrpStep_Render, 43, ovrpNode_Head, &Second);
+		Wrapper.GetNodePoseState3(ovrpStep_Render, 42, ovrpNode_Head, &Second);
+		TestEqual(TEXT("Position"), Second.Pose.Position.y, First.Pose.Position.y);
+		TestEqual(TEXT("Orientation"), Second.Pose.Orientation.y, First.Pose.Orientation.y);
+
+		TestFalse(TEXT("Untracked node"), OVRP_SUCCESS(Wrapper.GetNodePoseState3(ovrpStep_Render, 42, ovrpNode_DeviceObjectZero, &First)));
+	});
+
+	It(TEXT("Hands out layer ids"), [this]() {
+		ovrpLayerDesc Desc;
+		FMemory::Memzero(Desc);
+		int FirstLayer = 0;
+		int SecondLayer = 0;
+		Wrapper.SetupLayer(nullptr, Desc, &FirstLayer);
+		Wrapper.SetupLayer(nullptr, Desc, &SecondLayer);
+		TestNotEqual(TEXT("Layer ids"), FirstLayer, SecondLayer);
+		TestEqual(TEXT("Layers"), FOculusXRPluginStub::GetNumLayers(), 2);
+
+		TestTrue(TEXT("Destroy layer"), OVRP_SUCCESS(Wrapper.DestroyLayer(FirstLayer)));
+		TestFalse(TEXT("Destroy layer twice"), OVRP_SUCCESS(Wrapper.DestroyLayer(FirstLayer)));
+		TestEqual(TEXT("Layers after destroying one"), FOculusXRPluginStub::GetNumLayers(), 1);
+	});
+
+	It(TEXT("Describes the eye layer and hands out layer textures"), [this]() {
+		ovrpLayerDesc_EyeFov EyeDesc;
+		TestTrue(TEXT("Eye layer desc"), OVRP_SUCCESS(Wrapper.CalculateEyeLayerDesc3(ovrpLayout_DoubleWide, 1.0f, 1, 1, ovrpTextureFormat_B8G8R8A8_sRGB, ovrpTextureFormat_None, ovrpTextureFormat_None, ovrpTextureFormat_None, 1.0f, 0, &EyeDesc)));
+		TestEqual(TEXT("Double wide texture"), EyeDesc.TextureSize.w, EyeDesc.MaxViewportSize.w * 2);
+
+		int LayerId = 0;
+		Wrapper.SetupLayer(nullptr, EyeDesc.Base, &LayerId);
+		ovrpTextureHandle Color = 0;
+		ovrpTextureHandle Depth = 0;
+		TestTrue(TEXT("Layer texture"), OVRP_SUCCESS(Wrapper.GetLayerTexture2(LayerId, 0, ovrpEye_Left, &Color, &Depth)));
+		TestTrue(TEXT("Texture handles"), Color != 0 && Depth != 0 && Color != Depth);
+		TestFalse(TEXT("Texture of an unknown layer"), OVRP_SUCCESS(Wrapper.GetLayerTexture2(LayerId + 1, 0, ovrpEye_Left, &Color, &Depth)));
+	});
+
+	It(TEXT("Returns queued events in order"), [this]() {
+		ovrpEventDataBuffer Event;
+		FMemory::Memzero(Event);
+		Event.EventType = ovrpEventType_DisplayRefreshRateChange;
+		FOculusXRPluginStub::QueueEvent(Event);
+		Event.EventType = ovrpEventType_SpaceQueryResults;
+		FOculusXRPluginStub::QueueEvent(Event);
+
+		TArray<ovrpEventType> EventTypes;
+		ovrpEventDataBuffer Buffer;
+		while (Wrapper.PollEvent(&Buffer) == ovrpSuccess && Buffer.EventType != ovrpEventType_None)
+		{
+			EventTypes.Add(Buffer.EventType);
+		}
+		TestTrue(TEXT("Event types"), EventTypes == TArray<ovrpEventType>({ ovrpEventType_DisplayRefreshRateChange, ovrpEventType_SpaceQueryResults }));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -24,7 +24,10 @@ int UOculusXRBodyTrackingComponent::TrackingInstanceCount = 0;
 UOculusXRBodyTrackingComponent::UOculusXRBodyTrackingComponent()
 	: BodyTrackingMode(EOculusXRBodyTrackingMode::PositionAndRotation)
 	, ConfidenceThreshold(0.f)
+	, bApplyPoseInBulk(false)
+	, bSkipUnchangedBodyState(false)
 	, WorldToMeters(100.f)
+	, LastAppliedBodyStateTime(-1.f)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
@@ -173,59 +176,152 @@ void UOculusXRBodyTrackingComponent::TickComponent(float DeltaTime, enum ELevelT
 
 	if (UOculusXRMovementFunctionLibrary::TryGetBodyState(BodyState, WorldToMeters))
 	{
-		if (BodyState.IsActive && BodyState.Confidence > ConfidenceThreshold)
-		{
-			for (int i = 0; i < BodyState.Joints.Num(); ++i)
-			{
-				const FOculusXRBodyJoint& Joint = BodyState.Joints[i];
-				if (!Joint.bIsValid)
-				{
-					continue;
-				}
+		UpdateBonesFromBodyState();
+	}
+	else
+	{
+		UE_LOG(LogOculusXRMovement, Verbose, TEXT("Failed to get body state (%s:%s)."), *GetOwner()->GetName(), *GetName());
+	}
+}
 
-				const FVector& Position = Joint.Position;
-				const FRotator& Orientation = Joint.Orientation;
+bool UOculusXRBodyTrackingComponent::ApplyBodyState(const FOculusXRBodyState& InBodyState)
+{
+	// The component may not have begun play yet, or its mesh changed since
+	const int32 NumBones = GetSkinnedAsset() != nullptr ? GetSkinnedAsset()->GetRefSkeleton().GetNum() : 0;
+	if (BoneJointIndices.Num() != NumBones)
+	{
+		InitializeBodyBones();
+	}
+
+	BodyState = InBodyState;
+	return UpdateBonesFromBodyState();
+}
+
+bool UOculusXRBodyTrackingComponent::UpdateBonesFromBodyState()
+{
+	if (!BodyState.IsActive || BodyState.Confidence <= ConfidenceThreshold)
+	{
+		return false;
+	}
 
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				if (CVarOVRBodyDebugDraw.GetValueOnGameThread() > 0)
-				{
-					const FTransform& ParentTransform = GetOwner()->GetActorTransform();
+	// Drawn every tick, also when the bones are already up to date
+	if (CVarOVRBodyDebugDraw.GetValueOnGameThread() > 0)
+	{
+		const FTransform& ParentTransform = GetOwner()->GetActorTransform();
+		for (const FOculusXRBodyJoint& Joint : BodyState.Joints)
+		{
+			if (!Joint.bIsValid)
+			{
+				continue;
+			}
 
-					FVector DebugPosition = ParentTransform.TransformPosition(Position);
-					FRotator DebugOrientation = ParentTransform.TransformRotation(Orientation.Quaternion()).Rotator();
+			FVector DebugPosition = ParentTransform.TransformPosition(Joint.Position);
+			FRotator DebugOrientation = ParentTransform.TransformRotation(Joint.Orientation.Quaternion()).Rotator();
 
-					DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetUpVector(), FColor::Blue);
-					DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetForwardVector(), FColor::Red);
-					DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetRightVector(), FColor::Green);
-				}
+			DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetUpVector(), FColor::Blue);
+			DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetForwardVector(), FColor::Red);
+			DrawDebugLine(GetWorld(), DebugPosition, DebugPosition + DebugOrientation.Quaternion().GetRightVector(), FColor::Green);
+		}
+	}
 #endif
 
-				int32* BoneIndex = MappedBoneIndices.Find(static_cast<EOculusXRBoneID>(i));
-				if (BoneIndex != nullptr)
-				{
-					switch (BodyTrackingMode)
-					{
-						case EOculusXRBodyTrackingMode::PositionAndRotation:
-							SetBoneTransformByName(BoneNames[static_cast<EOculusXRBoneID>(i)], FTransform(Orientation, Position), EBoneSpaces::ComponentSpace);
-							break;
-						case EOculusXRBodyTrackingMode::RotationOnly:
-							SetBoneRotationByName(BoneNames[static_cast<EOculusXRBoneID>(i)], Orientation, EBoneSpaces::ComponentSpace);
-							break;
-						case EOculusXRBodyTrackingMode::NoTracking:
-							break;
-					}
-				}
+	if (bSkipUnchangedBodyState && BodyState.Time == LastAppliedBodyStateTime)
+	{
+		return false;
+	}
+
+	if (bApplyPoseInBulk)
+	{
+		if (!ApplyBodyStateInBulk())
+		{
+			return false;
+		}
+		LastAppliedBodyStateTime = BodyState.Time;
+		return true;
+	}
+
+	for (int i = 0; i < BodyState.Joints.Num(); ++i)
+	{
+		const FOculusXRBodyJoint& Joint = BodyState.Joints[i];
+		if (!Joint.bIsValid)
+		{
+			continue;
+		}
+
+		int32* BoneIndex = MappedBoneIndices.Find(static_cast<EOculusXRBoneID>(i));
+		if (BoneIndex != nullptr)
+		{
+			switch (BodyTrackingMode)
+			{
+				case EOculusXRBodyTrackingMode::PositionAndRotation:
+					SetBoneTransformByName(BoneNames[static_cast<EOculusXRBoneID>(i)], FTransform(Joint.Orientation, Joint.Position), EBoneSpaces::ComponentSpace);
+					break;
+				case EOculusXRBodyTrackingMode::RotationOnly:
+					SetBoneRotationByName(BoneNames[static_cast<EOculusXRBoneID>(i)], Joint.Orientation, EBoneSpaces::ComponentSpace);
+					break;
+				case EOculusXRBodyTrackingMode::NoTracking:
+					break;
 			}
 		}
 	}
-	else
+	LastAppliedBodyStateTime = BodyState.Time;
+	return true;
+}
+
+bool UOculusXRBodyTrackingComponent::ApplyBodyStateInBulk()
+{
+	if (BodyTrackingMode == EOculusXRBodyTrackingMode::NoTracking)
 	{
-		UE_LOG(LogOculusXRMovement, Verbose, TEXT("Failed to get body state (%s:%s)."), *GetOwner()->GetName(), *GetName());
+		return true;
+	}
+
+	if (GetSkinnedAsset() == nullptr)
+	{
+		return false;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = GetSkinnedAsset()->GetRefSkeleton();
+	const int32 NumBones = RefSkeleton.GetNum();
+	if (BoneSpaceTransforms.Num() != NumBones || BoneJointIndices.Num() != NumBones)
+	{
+		return false;
+	}
+
+	// Parents always come before their children, so a single pass computes the component space transform of
+	// every bone. Tracked bones take the joint transform and get converted back to bone space right away.
+	ComponentSpaceScratch.SetNumUninitialized(NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+		const FTransform& ParentTransform = ParentIndex != INDEX_NONE ? ComponentSpaceScratch[ParentIndex] : FTransform::Identity;
+		FTransform& BoneTransform = ComponentSpaceScratch[BoneIndex];
+		BoneTransform = BoneSpaceTransforms[BoneIndex] * ParentTransform;
+
+		const int32 JointIndex = BoneJointIndices[BoneIndex];
+		if (JointIndex == INDEX_NONE || !BodyState.Joints.IsValidIndex(JointIndex) || !BodyState.Joints[JointIndex].bIsValid)
+		{
+			continue;
+		}
+
+		const FOculusXRBodyJoint& Joint = BodyState.Joints[JointIndex];
+		BoneTransform.SetRotation(Joint.Orientation.Quaternion());
+		if (BodyTrackingMode == EOculusXRBodyTrackingMode::PositionAndRotation)
+		{
+			BoneTransform.SetTranslation(Joint.Position);
+			BoneTransform.SetScale3D(FVector::OneVector);
+		}
+		BoneSpaceTransforms[BoneIndex] = BoneTransform.GetRelativeTransform(ParentTransform);
 	}
+
+	MarkRefreshTransformDirty();
+	return true;
 }
 
 void UOculusXRBodyTrackingComponent::ResetAllBoneTransforms()
 {
+	LastAppliedBodyStateTime = -1.f;
+
 	for (int i = 0; i < BodyState.Joints.Num(); ++i)
 	{
 		int32* BoneIndex = MappedBoneIndices.Find(static_cast<EOculusXRBoneID>(i));
@@ -245,6 +341,7 @@ bool UOculusXRBodyTrackingComponent::InitializeBodyBones()
 		return false;
 	}
 
+	MappedBoneIndices.Reset();
 	for (const auto& it : BoneNames)
 	{
 		int32 BoneIndex = GetBoneIndex(it.Value);
@@ -259,5 +356,14 @@ bool UOculusXRBodyTrackingComponent::InitializeBodyBones()
 		}
 	}
 
+	BoneJointIndices.Init(INDEX_NONE, BodyMesh->GetRefSkeleton().GetNum());
+	for (const auto& it : MappedBoneIndices)
+	{
+		if (BoneJointIndices.IsValidIndex(it.Value))
+		{
+			BoneJointIndices[it.Value] = static_cast<int32>(it.Key);
+		}
+	}
+
 	return true;
 }
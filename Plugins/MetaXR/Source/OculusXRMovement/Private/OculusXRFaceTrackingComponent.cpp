@@ -11,6 +11,7 @@
 #include "Engine/SkeletalMesh.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Math/UnrealMathUtility.h"
+#include "Math/VectorRegister.h"
 
 int UOculusXRFaceTrackingComponent::TrackingInstanceCount = 0;
 
@@ -19,6 +20,7 @@ UOculusXRFaceTrackingComponent::UOculusXRFaceTrackingComponent()
 	, InvalidFaceDataResetTime(2.0f)
 	, bUpdateFace(true)
 	, TargetMeshComponent(nullptr)
+	, ResolvedMesh(nullptr)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
@@ -198,38 +200,11 @@ void UOculusXRFaceTrackingComponent::TickComponent(float DeltaTime, enum ELevelT
 	{
 		InvalidFaceStateTimer = 0.0f;
 
-		MorphTargets.ResetMorphTargetCurves(TargetMeshComponent);
-
-		for (int32 FaceExpressionIndex = 0; FaceExpressionIndex < static_cast<int32>(EOculusXRFaceExpression::COUNT); ++FaceExpressionIndex)
-		{
-			if (ExpressionValid[FaceExpressionIndex])
-			{
-				FName ExpressionName = ExpressionNames[static_cast<EOculusXRFaceExpression>(FaceExpressionIndex)];
-				MorphTargets.SetMorphTarget(ExpressionName, FaceState.ExpressionWeights[FaceExpressionIndex]);
-			}
-		}
+		ExpressionWeights.SetWeights(FaceState.ExpressionWeights);
 
 		if (bUseModifiers)
 		{
-			for (int32 FaceExpressionModifierIndex = 0; FaceExpressionModifierIndex < ExpressionModifiers.Num(); ++FaceExpressionModifierIndex)
-			{
-				for (int32 FaceExpressionIndex = 0; FaceExpressionIndex < ExpressionModifiers[FaceExpressionModifierIndex].FaceExpressions.Num(); ++FaceExpressionIndex)
-				{
-					auto Expression = ExpressionModifiers[FaceExpressionModifierIndex].FaceExpressions[FaceExpressionIndex];
-					if (ExpressionValid[static_cast<int32>(Expression)])
-					{
-						FName ExpressionName = ExpressionNames[Expression];
-						float currentValue = MorphTargets.GetMorphTarget(ExpressionName);
-
-						currentValue = FMath::Clamp(
-							currentValue * ExpressionModifiers[FaceExpressionModifierIndex].Multiplier,
-							ExpressionModifiers[FaceExpressionModifierIndex].MinValue,
-							ExpressionModifiers[FaceExpressionModifierIndex].MaxValue);
-
-						MorphTargets.SetMorphTarget(ExpressionName, currentValue);
-					}
-				}
-			}
+			ExpressionWeights.ApplyModifiers();
 		}
 	}
 	else
@@ -237,11 +212,16 @@ void UOculusXRFaceTrackingComponent::TickComponent(float DeltaTime, enum ELevelT
 		InvalidFaceStateTimer += DeltaTime;
 		if (InvalidFaceStateTimer >= InvalidFaceDataResetTime)
 		{
-			MorphTargets.ResetMorphTargetCurves(TargetMeshComponent);
+			ClearExpressionValues();
 		}
 	}
 
-	MorphTargets.ApplyMorphTargets(TargetMeshComponent);
+	if (TargetMeshComponent->GetSkinnedAsset() != ResolvedMesh)
+	{
+		ResolveExpressionMorphTargets();
+	}
+
+	ExpressionWeights.ApplyToMesh(MorphTargets, TargetMeshComponent);
 }
 
 void UOculusXRFaceTrackingComponent::SetExpressionValue(EOculusXRFaceExpression Expression, float Value)
@@ -252,14 +232,13 @@ void UOculusXRFaceTrackingComponent::SetExpressionValue(EOculusXRFaceExpression
 		return;
 	}
 
-	if (!ExpressionValid[static_cast<int32>(Expression)])
+	if (!ExpressionWeights.IsValid(Expression))
 	{
 		UE_LOG(LogOculusXRMovement, Warning, TEXT("Cannot set expression value for an expression with an invalid associated morph target name. Expression name: %s"), *StaticEnum<EOculusXRFaceExpression>()->GetValueAsString(Expression));
 		return;
 	}
 
-	FName ExpressionName = ExpressionNames[Expression];
-	MorphTargets.SetMorphTarget(ExpressionName, Value);
+	ExpressionWeights.Weights[static_cast<int32>(Expression)] = Value;
 }
 
 float UOculusXRFaceTrackingComponent::GetExpressionValue(EOculusXRFaceExpression Expression) const
@@ -270,19 +249,18 @@ float UOculusXRFaceTrackingComponent::GetExpressionValue(EOculusXRFaceExpression
 		return 0.0f;
 	}
 
-	FName ExpressionName = ExpressionNames[Expression];
-	if (ExpressionName == NAME_None)
+	if (!ExpressionWeights.IsValid(Expression))
 	{
 		UE_LOG(LogOculusXRMovement, Warning, TEXT("Cannot request expression value for an expression with an invalid associated morph target name. Expression name: %s"), *StaticEnum<EOculusXRFaceExpression>()->GetValueAsString(Expression));
 		return 0.0f;
 	}
 
-	return MorphTargets.GetMorphTarget(ExpressionName);
+	return ExpressionWeights.Weights[static_cast<int32>(Expression)];
 }
 
 void UOculusXRFaceTrackingComponent::ClearExpressionValues()
 {
-	MorphTargets.ClearMorphTargets();
+	ExpressionWeights.Clear();
 }
 
 bool UOculusXRFaceTrackingComponent::InitializeFaceTracking()
@@ -295,21 +273,112 @@ bool UOculusXRFaceTrackingComponent::InitializeFaceTracking()
 		return false;
 	}
 
-	if (TargetMeshComponent != nullptr)
+	if (Cast<USkeletalMesh>(TargetMeshComponent->GetSkinnedAsset()) == nullptr)
+	{
+		return false;
+	}
+
+	ExpressionWeights.Clear();
+	ResolveExpressionMorphTargets();
+
+	return true;
+}
+
+void UOculusXRFaceTrackingComponent::ResolveExpressionMorphTargets()
+{
+	ResolvedMesh = TargetMeshComponent->GetSkinnedAsset();
+	ExpressionWeights.Resolve(Cast<USkeletalMesh>(ResolvedMesh), ExpressionNames, ExpressionModifiers);
+}
+
+FOculusXRFaceExpressionWeights::FOculusXRFaceExpressionWeights()
+{
+	MorphTargetIndices.Init(INDEX_NONE, static_cast<int32>(EOculusXRFaceExpression::COUNT));
+	Weights.Init(0.0f, NumPaddedExpressions);
+	ModifierMultipliers.Init(1.0f, NumPaddedExpressions);
+	ModifierMinValues.Init(-UE_BIG_NUMBER, NumPaddedExpressions);
+	ModifierMaxValues.Init(UE_BIG_NUMBER, NumPaddedExpressions);
+}
+
+void FOculusXRFaceExpressionWeights::Resolve(const USkeletalMesh* Mesh, const TMap<EOculusXRFaceExpression, FName>& ExpressionNames, TConstArrayView<FOculusXRFaceExpressionModifier> ExpressionModifiers)
+{
+	MorphTargetIndices.Init(INDEX_NONE, static_cast<int32>(EOculusXRFaceExpression::COUNT));
+	if (Mesh != nullptr)
 	{
-		USkeletalMesh* TargetMesh = Cast<USkeletalMesh>(TargetMeshComponent->GetSkinnedAsset());
-		if (TargetMesh != nullptr)
+		const TMap<FName, int32>& MorphTargetIndexMap = Mesh->GetMorphTargetIndexMap();
+		for (const auto& it : ExpressionNames)
 		{
-			const TMap<FName, int32>& MorphTargetIndexMap = TargetMesh->GetMorphTargetIndexMap();
+			if (const int32* MorphTargetIndex = MorphTargetIndexMap.Find(it.Value))
+			{
+				MorphTargetIndices[static_cast<int32>(it.Key)] = *MorphTargetIndex;
+			}
+		}
+	}
 
-			for (const auto& it : ExpressionNames)
+	ModifierMultipliers.Init(1.0f, NumPaddedExpressions);
+	ModifierMinValues.Init(-UE_BIG_NUMBER, NumPaddedExpressions);
+	ModifierMaxValues.Init(UE_BIG_NUMBER, NumPaddedExpressions);
+	ChainedModifiers.Reset();
+
+	TBitArray<> HasModifier(false, NumPaddedExpressions);
+	for (const FOculusXRFaceExpressionModifier& Modifier : ExpressionModifiers)
+	{
+		for (const EOculusXRFaceExpression Expression : Modifier.FaceExpressions)
+		{
+			const int32 FaceExpressionIndex = static_cast<int32>(Expression);
+			if (!IsValid(Expression))
 			{
-				ExpressionValid[static_cast<int32>(it.Key)] = MorphTargetIndexMap.Contains(it.Value);
+				continue;
 			}
 
-			return true;
+			if (HasModifier[FaceExpressionIndex])
+			{
+				ChainedModifiers.Add({ FaceExpressionIndex, Modifier.Multiplier, Modifier.MinValue, Modifier.MaxValue });
+				continue;
+			}
+
+			HasModifier[FaceExpressionIndex] = true;
+			ModifierMultipliers[FaceExpressionIndex] = Modifier.Multiplier;
+			ModifierMinValues[FaceExpressionIndex] = Modifier.MinValue;
+			ModifierMaxValues[FaceExpressionIndex] = Modifier.MaxValue;
 		}
 	}
+}
 
-	return false;
+bool FOculusXRFaceExpressionWeights::IsValid(EOculusXRFaceExpression Expression) const
+{
+	return Expression < EOculusXRFaceExpression::COUNT && MorphTargetIndices[static_cast<int32>(Expression)] != INDEX_NONE;
+}
+
+void FOculusXRFaceExpressionWeights::SetWeights(TConstArrayView<float> InWeights)
+{
+	if (InWeights.Num() >= static_cast<int32>(EOculusXRFaceExpression::COUNT))
+	{
+		FMemory::Memcpy(Weights.GetData(), InWeights.GetData(), static_cast<int32>(EOculusXRFaceExpression::COUNT) * sizeof(float));
+	}
+}
+
+void FOculusXRFaceExpressionWeights::ApplyModifiers()
+{
+	float* WeightData = Weights.GetData();
+	for (int32 Index = 0; Index < NumPaddedExpressions; Index += 4)
+	{
+		VectorRegister4Float Weight = VectorMultiply(VectorLoad(WeightData + Index), VectorLoad(ModifierMultipliers.GetData() + Index));
+		Weight = VectorMin(VectorMax(Weight, VectorLoad(ModifierMinValues.GetData() + Index)), VectorLoad(ModifierMaxValues.GetData() + Index));
+		VectorStore(Weight, WeightData + Index);
+	}
+
+	for (const FChainedModifier& Modifier : ChainedModifiers)
+	{
+		WeightData[Modifier.ExpressionIndex] = FMath::Clamp(WeightData[Modifier.ExpressionIndex] * Modifier.Multiplier, Modifier.MinValue, Modifier.MaxValue);
+	}
+}
+
+void FOculusXRFaceExpressionWeights::Clear()
+{
+	FMemory::Memzero(Weights.GetData(), Weights.Num() * sizeof(float));
+}
+
+void FOculusXRFaceExpressionWeights::ApplyToMesh(FOculusXRMorphTargetsController& MorphTargets, USkinnedMeshComponent* TargetMeshComponent) const
+{
+	MorphTargets.ApplyMorphTargetWeights(TargetMeshComponent, MorphTargetIndices, MakeArrayView(Weights.GetData(), static_cast<int32>(EOculusXRFaceExpression::COUNT)));
 }
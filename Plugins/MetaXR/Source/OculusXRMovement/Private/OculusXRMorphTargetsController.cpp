@@ -3,6 +3,7 @@
 #include "OculusXRMorphTargetsController.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/SkeletalMesh.h"
+#include "Animation/MorphTarget.h"
 
 #include "AnimationRuntime.h"
 
@@ -44,6 +45,54 @@ void FOculusXRMorphTargetsController::ApplyMorphTargets(USkinnedMeshComponent* T
 	}
 }
 
+void FOculusXRMorphTargetsController::ApplyMorphTargetWeights(USkinnedMeshComponent* TargetMeshComponent, TConstArrayView<int32> MorphTargetIndices, TConstArrayView<float> Weights)
+{
+	check(MorphTargetIndices.Num() == Weights.Num());
+
+	if (TargetMeshComponent == nullptr)
+	{
+		return;
+	}
+
+	const USkeletalMesh* TargetMesh = Cast<USkeletalMesh>(TargetMeshComponent->GetSkinnedAsset());
+	if (TargetMesh == nullptr)
+	{
+		return;
+	}
+
+	const TArray<TObjectPtr<UMorphTarget>>& MeshMorphTargets = TargetMesh->GetMorphTargets();
+	TArray<float>& MorphTargetWeights = TargetMeshComponent->MorphTargetWeights;
+	if (MorphTargetWeights.Num() != MeshMorphTargets.Num())
+	{
+		MorphTargetWeights.SetNumZeroed(MeshMorphTargets.Num());
+	}
+
+	for (int32 Index = 0; Index < MorphTargetIndices.Num(); ++Index)
+	{
+		const int32 MorphTargetIndex = MorphTargetIndices[Index];
+		if (!MeshMorphTargets.IsValidIndex(MorphTargetIndex))
+		{
+			continue;
+		}
+
+		const float Weight = FPlatformMath::Abs(Weights[Index]) > ZERO_ANIMWEIGHT_THRESH ? Weights[Index] : 0.0f;
+		if (MorphTargetWeights[MorphTargetIndex] == Weight)
+		{
+			continue;
+		}
+
+		MorphTargetWeights[MorphTargetIndex] = Weight;
+		if (Weight != 0.0f)
+		{
+			TargetMeshComponent->ActiveMorphTargets.Add(MeshMorphTargets[MorphTargetIndex], MorphTargetIndex);
+		}
+		else
+		{
+			TargetMeshComponent->ActiveMorphTargets.Remove(MeshMorphTargets[MorphTargetIndex]);
+		}
+	}
+}
+
 void FOculusXRMorphTargetsController::SetMorphTarget(FName MorphTargetName, float Value)
 {
 	float* CurveValPtr = MorphTargetCurves.Find(MorphTargetName);
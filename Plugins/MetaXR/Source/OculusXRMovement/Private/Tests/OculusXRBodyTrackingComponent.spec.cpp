@@ -0,0 +1,169 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "Animation/Skeleton.h"
+#include "Engine/SkeletalMesh.h"
+#include "OculusXRBodyTrackingComponent.h"
+#include "ReferenceSkeleton.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	FOculusXRBodyState CreateBodyState(float Time)
+	{
+		FOculusXRBodyState State;
+		State.IsActive = true;
+		State.Confidence = 1.0f;
+		State.Time = Time;
+		State.Joints.SetNum(static_cast<int32>(EOculusXRBoneID::COUNT));
+		for (int32 i = 0; i < State.Joints.Num(); ++i)
+		{
+			State.Joints[i].bIsValid = true;
+			State.Joints[i].Orientation = FRotator(Time, 2.0f * i, 0.0f);
+			State.Joints[i].Position = FVector(Time, 0.0f, 10.0f * i);
+		}
+		return State;
+	}
+
+	// Chain of all bones of the default bone names, followed by a bone without a joint
+	USkeletalMesh* CreateBodyMesh(const TMap<EOculusXRBoneID, FName>& BoneNames)
+	{
+		TArray<EOculusXRBoneID> BoneIds;
+		BoneNames.GetKeys(BoneIds);
+		BoneIds.Sort();
+
+		USkeletalMesh* Mesh = NewObject<USkeletalMesh>(GetTransientPackage());
+		{
+			FReferenceSkeletonModifier Modifier(Mesh->GetRefSkeleton(), nullptr);
+			for (int32 i = 0; i < BoneIds.Num(); ++i)
+			{
+				const FName BoneName = BoneNames[BoneIds[i]];
+				Modifier.Add(FMeshBoneInfo(BoneName, BoneName.ToString(), i - 1), FTransform(FRotator(0.0f, 5.0f, 0.0f), FVector(0.0f, 0.0f, i == 0 ? 0.0f : 10.0f)));
+			}
+			Modifier.Add(FMeshBoneInfo(TEXT("Unmapped"), TEXT("Unmapped"), BoneIds.Num() - 1), FTransform(FVector(0.0f, 0.0f, 10.0f)));
+		}
+
+		USkeleton* Skeleton = NewObject<USkeleton>(GetTransientPackage());
+		Skeleton->MergeAllBonesToBoneTree(Mesh);
+		Mesh->SetSkeleton(Skeleton);
+		return Mesh;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(FOculusXRBodyTrackingComponentSpec, TEXT("OculusXR.Movement.BodyTrackingComponent"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	USkeletalMesh* Mesh;
+	UOculusXRBodyTrackingComponent* Component;
+
+	UOculusXRBodyTrackingComponent* CreateComponent() const;
+END_DEFINE_SPEC(FOculusXRBodyTrackingComponentSpec)
+
+UOculusXRBodyTrackingComponent* FOculusXRBodyTrackingComponentSpec::CreateComponent() const
+{
+	UOculusXRBodyTrackingComponent* NewComponent = NewObject<UOculusXRBodyTrackingComponent>(GetTransientPackage());
+	NewComponent->SetSkinnedAssetAndUpdate(Mesh);
+	NewComponent->AllocateTransformData();
+	return NewComponent;
+}
+
+void FOculusXRBodyTrackingComponentSpec::Define()
+{
+	BeforeEach([this]() {
+		Mesh = CreateBodyMesh(GetDefault<UOculusXRBodyTrackingComponent>()->BoneNames);
+		Component = CreateComponent();
+	});
+
+	AfterEach([this]() {
+		Component->MarkAsGarbage();
+		Component = nullptr;
+	});
+
+	It(TEXT("Applies every body state by default"), [this]() {
+		TestFalse(TEXT("Bulk update is off by default"), Component->bApplyPoseInBulk);
+		TestFalse(TEXT("Skipping unchanged body states is off by default"), Component->bSkipUnchangedBodyState);
+
+		const FOculusXRBodyState State = CreateBodyState(1.0f);
+		TestTrue(TEXT("First body state is applied"), Component->ApplyBodyState(State));
+		TestTrue(TEXT("Same body state is applied again"), Component->ApplyBodyState(State));
+	});
+
+	It(TEXT("Skips unchanged body states"), [this]() {
+		for (const bool bApplyPoseInBulk : { false, true })
+		{
+			Component->bApplyPoseInBulk = bApplyPoseInBulk;
+			Component->bSkipUnchangedBodyState = true;
+			Component->ResetAllBoneTransforms();
+
+			const FString Mode = bApplyPoseInBulk ? TEXT("bulk") : TEXT("by name");
+			TestTrue(FString::Printf(TEXT("First body state is applied (%s)"), *Mode), Component->ApplyBodyState(CreateBodyState(1.0f)));
+			TestFalse(FString::Printf(TEXT("Unchanged body state is skipped (%s)"), *Mode), Component->ApplyBodyState(CreateBodyState(1.0f)));
+			TestTrue(FString::Printf(TEXT("Changed body state is applied (%s)"), *Mode), Component->ApplyBodyState(CreateBodyState(2.0f)));
+			TestFalse(FString::Printf(TEXT("Changed body state is applied once (%s)"), *Mode), Component->ApplyBodyState(CreateBodyState(2.0f)));
+
+			// Resetting the bones drops the applied body state, so the same one has to be applied again
+			Component->ResetAllBoneTransforms();
+			TestTrue(FString::Printf(TEXT("Body state is applied after a reset (%s)"), *Mode), Component->ApplyBodyState(CreateBodyState(2.0f)));
+		}
+	});
+
+	It(TEXT("Applies the same pose in bulk and by name"), [this]() {
+		for (const EOculusXRBodyTrackingMode Mode : { EOculusXRBodyTrackingMode::PositionAndRotation, EOculusXRBodyTrackingMode::RotationOnly })
+		{
+			UOculusXRBodyTrackingComponent* ByName = CreateComponent();
+			UOculusXRBodyTrackingComponent* InBulk = CreateComponent();
+			ByName->BodyTrackingMode = Mode;
+			InBulk->BodyTrackingMode = Mode;
+			InBulk->bApplyPoseInBulk = true;
+
+			const FString ModeName = StaticEnum<EOculusXRBodyTrackingMode>()->GetNameStringByValue(static_cast<int64>(Mode));
+			for (int32 Frame = 1; Frame <= 3; ++Frame)
+			{
+				// Invalid joints keep the pose of the previous frame
+				FOculusXRBodyState State = CreateBodyState(Frame);
+				State.Joints[Frame * 7].bIsValid = false;
+
+				TestTrue(FString::Printf(TEXT("Frame %d is applied by name (%s)"), Frame, *ModeName), ByName->ApplyBodyState(State));
+				TestTrue(FString::Printf(TEXT("Frame %d is applied in bulk (%s)"), Frame, *ModeName), InBulk->ApplyBodyState(State));
+				if (!TestEqual(FString::Printf(TEXT("Number of bones (%s)"), *ModeName), InBulk->BoneSpaceTransforms.Num(), ByName->BoneSpaceTransforms.Num()))
+				{
+					break;
+				}
+
+				int32 Mismatches = 0;
+				for (int32 BoneIndex = 0; BoneIndex < ByName->BoneSpaceTransforms.Num(); ++BoneIndex)
+				{
+					if (!InBulk->BoneSpaceTransforms[BoneIndex].Equals(ByName->BoneSpaceTransforms[BoneIndex], 1.e-3f))
+					{
+						++Mismatches;
+					}
+				}
+				TestEqual(FString::Printf(TEXT("Frame %d: mismatching bone transforms (%s)"), Frame, *ModeName), Mismatches, 0);
+			}
+
+			ByName->MarkAsGarbage();
+			InBulk->MarkAsGarbage();
+		}
+	});
+
+	It(TEXT("Does not apply a bulk update without a mesh"), [this]() {
+		UOculusXRBodyTrackingComponent* WithoutMesh = NewObject<UOculusXRBodyTrackingComponent>(GetTransientPackage());
+		WithoutMesh->bApplyPoseInBulk = true;
+		TestFalse(TEXT("Body state is not applied"), WithoutMesh->ApplyBodyState(CreateBodyState(1.0f)));
+		WithoutMesh->MarkAsGarbage();
+	});
+
+	It(TEXT("Does not apply inactive or low confidence body states"), [this]() {
+		Component->ConfidenceThreshold = 0.5f;
+
+		FOculusXRBodyState State = CreateBodyState(1.0f);
+		State.Confidence = 0.25f;
+		TestFalse(TEXT("Low confidence body state is not applied"), Component->ApplyBodyState(State));
+
+		State.Confidence = 1.0f;
+		State.IsActive = false;
+		TestFalse(TEXT("Inactive body state is not applied"), Component->ApplyBodyState(State));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
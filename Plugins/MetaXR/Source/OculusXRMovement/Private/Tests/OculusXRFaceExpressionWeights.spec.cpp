@@ -0,0 +1,184 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "Animation/MorphTarget.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/SkeletalMesh.h"
+#include "Math/RandomStream.h"
+#include "OculusXRFaceTrackingComponent.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Applies a face state like the face tracking component did before the expressions were resolved to indices
+	void ApplyByName(FOculusXRMorphTargetsController& MorphTargets, USkinnedMeshComponent* Component, const TMap<EOculusXRFaceExpression, FName>& ExpressionNames,
+		const TArray<FOculusXRFaceExpressionModifier>& ExpressionModifiers, const TArray<float>& FaceWeights, bool bUseModifiers)
+	{
+		const TMap<FName, int32>& MorphTargetIndexMap = Cast<USkeletalMesh>(Component->GetSkinnedAsset())->GetMorphTargetIndexMap();
+		const auto IsValid = [&](EOculusXRFaceExpression Expression) {
+			const FName* Name = ExpressionNames.Find(Expression);
+			return Name && MorphTargetIndexMap.Contains(*Name);
+		};
+
+		MorphTargets.ResetMorphTargetCurves(Component);
+		for (int32 FaceExpressionIndex = 0; FaceExpressionIndex < static_cast<int32>(EOculusXRFaceExpression::COUNT); ++FaceExpressionIndex)
+		{
+			if (IsValid(static_cast<EOculusXRFaceExpression>(FaceExpressionIndex)))
+			{
+				MorphTargets.SetMorphTarget(ExpressionNames[static_cast<EOculusXRFaceExpression>(FaceExpressionIndex)], FaceWeights[FaceExpressionIndex]);
+			}
+		}
+
+		if (bUseModifiers)
+		{
+			for (const FOculusXRFaceExpressionModifier& Modifier : ExpressionModifiers)
+			{
+				for (const EOculusXRFaceExpression Expression : Modifier.FaceExpressions)
+				{
+					if (IsValid(Expression))
+					{
+						const FName ExpressionName = ExpressionNames[Expression];
+						MorphTargets.SetMorphTarget(ExpressionName, FMath::Clamp(MorphTargets.GetMorphTarget(ExpressionName) * Modifier.Multiplier, Modifier.MinValue, Modifier.MaxValue));
+					}
+				}
+			}
+		}
+
+		MorphTargets.ApplyMorphTargets(Component);
+	}
+
+	// Mesh with a morph target for every other expression of the default expression names
+	USkeletalMesh* CreateFaceMesh(const TMap<EOculusXRFaceExpression, FName>& ExpressionNames)
+	{
+		USkeletalMesh* Mesh = NewObject<USkeletalMesh>(GetTransientPackage());
+		for (const auto& it : ExpressionNames)
+		{
+			if (static_cast<int32>(it.Key) % 2 == 0)
+			{
+				Mesh->GetMorphTargets().Add(NewObject<UMorphTarget>(Mesh, it.Value));
+			}
+		}
+		Mesh->InitMorphTargets();
+		return Mesh;
+	}
+
+	FOculusXRFaceExpressionModifier CreateModifier(TArray<EOculusXRFaceExpression> FaceExpressions, float Multiplier, float MinValue, float MaxValue)
+	{
+		FOculusXRFaceExpressionModifier Modifier;
+		Modifier.FaceExpressions = MoveTemp(FaceExpressions);
+		Modifier.Multiplier = Multiplier;
+		Modifier.MinValue = MinValue;
+		Modifier.MaxValue = MaxValue;
+		return Modifier;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(FOculusXRFaceExpressionWeightsSpec, TEXT("OculusXR.Movement.FaceExpressionWeights"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+	TMap<EOculusXRFaceExpression, FName> ExpressionNames;
+	TArray<FOculusXRFaceExpressionModifier> ExpressionModifiers;
+	USkeletalMesh* Mesh;
+
+	void TestSameMorphTargets(const FString& What, const USkinnedMeshComponent* Actual, const USkinnedMeshComponent* Expected);
+END_DEFINE_SPEC(FOculusXRFaceExpressionWeightsSpec)
+
+void FOculusXRFaceExpressionWeightsSpec::TestSameMorphTargets(const FString& What, const USkinnedMeshComponent* Actual, const USkinnedMeshComponent* Expected)
+{
+	if (!TestEqual(What + TEXT(": number of morph target weights"), Actual->MorphTargetWeights.Num(), Expected->MorphTargetWeights.Num()))
+	{
+		return;
+	}
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < Expected->MorphTargetWeights.Num(); ++i)
+	{
+		if (!FMath::IsNearlyEqual(Actual->MorphTargetWeights[i], Expected->MorphTargetWeights[i]))
+		{
+			++Mismatches;
+		}
+	}
+	TestEqual(What + TEXT(": mismatching morph target weights"), Mismatches, 0);
+	TestEqual(What + TEXT(": number of active morph targets"), Actual->ActiveMorphTargets.Num(), Expected->ActiveMorphTargets.Num());
+}
+
+void FOculusXRFaceExpressionWeightsSpec::Define()
+{
+	BeforeEach([this]() {
+		ExpressionNames = GetDefault<UOculusXRFaceTrackingComponent>()->ExpressionNames;
+		Mesh = CreateFaceMesh(ExpressionNames);
+
+		// Expressions with one modifier, with several modifiers, and without a morph target
+		ExpressionModifiers.Reset();
+		ExpressionModifiers.Add(CreateModifier({ EOculusXRFaceExpression::BrowLowererL, EOculusXRFaceExpression::BrowLowererR, EOculusXRFaceExpression::JawDrop }, 1.5f, 0.0f, 1.0f));
+		ExpressionModifiers.Add(CreateModifier({ EOculusXRFaceExpression::JawDrop, EOculusXRFaceExpression::LipCornerPullerL }, 0.5f, 0.1f, 0.8f));
+		ExpressionModifiers.Add(CreateModifier({ EOculusXRFaceExpression::JawDrop }, 2.0f, 0.2f, 0.6f));
+	});
+
+	It(TEXT("Drives the morph targets like the name based path"), [this]() {
+		USkeletalMeshComponent* ExpectedComponent = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+		USkeletalMeshComponent* Component = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+		ExpectedComponent->SetSkeletalMeshAsset(Mesh);
+		Component->SetSkeletalMeshAsset(Mesh);
+
+		FOculusXRMorphTargetsController ExpectedMorphTargets;
+		FOculusXRMorphTargetsController MorphTargets;
+		FOculusXRFaceExpressionWeights Weights;
+		Weights.Resolve(Mesh, ExpressionNames, ExpressionModifiers);
+
+		FRandomStream Random(7);
+		TArray<float> FaceWeights;
+		FaceWeights.SetNum(static_cast<int32>(EOculusXRFaceExpression::COUNT));
+		for (int32 Frame = 0; Frame < 16; ++Frame)
+		{
+			// Some expressions stay neutral, some keep their weight, so that unchanged and zero weights are covered
+			for (int32 i = 0; i < FaceWeights.Num(); ++i)
+			{
+				if ((i + Frame) % 5 == 0)
+				{
+					FaceWeights[i] = 0.0f;
+				}
+				else if ((i + Frame) % 3 != 0)
+				{
+					FaceWeights[i] = Random.FRand();
+				}
+			}
+			const bool bUseModifiers = Frame % 4 != 3;
+
+			ApplyByName(ExpectedMorphTargets, ExpectedComponent, ExpressionNames, ExpressionModifiers, FaceWeights, bUseModifiers);
+
+			Weights.SetWeights(FaceWeights);
+			if (bUseModifiers)
+			{
+				Weights.ApplyModifiers();
+			}
+			Weights.ApplyToMesh(MorphTargets, Component);
+
+			TestSameMorphTargets(FString::Printf(TEXT("Frame %d"), Frame), Component, ExpectedComponent);
+		}
+
+		// What the component does once the face data has been invalid for too long
+		ExpectedMorphTargets.ResetMorphTargetCurves(ExpectedComponent);
+		Weights.Clear();
+		Weights.ApplyToMesh(MorphTargets, Component);
+		TestSameMorphTargets(TEXT("Cleared"), Component, ExpectedComponent);
+	});
+
+	It(TEXT("Only resolves expressions with a morph target"), [this]() {
+		FOculusXRFaceExpressionWeights Weights;
+		TestFalse(TEXT("Unresolved expression is invalid"), Weights.IsValid(EOculusXRFaceExpression::BrowLowererL));
+
+		Weights.Resolve(Mesh, ExpressionNames, ExpressionModifiers);
+		const TMap<FName, int32>& MorphTargetIndexMap = Mesh->GetMorphTargetIndexMap();
+		for (const auto& it : ExpressionNames)
+		{
+			TestTrue(FString::Printf(TEXT("Validity of %s"), *it.Value.ToString()), Weights.IsValid(it.Key) == MorphTargetIndexMap.Contains(it.Value));
+		}
+		TestFalse(TEXT("COUNT is invalid"), Weights.IsValid(EOculusXRFaceExpression::COUNT));
+
+		Weights.Resolve(nullptr, ExpressionNames, ExpressionModifiers);
+		TestFalse(TEXT("Expression is invalid without a mesh"), Weights.IsValid(EOculusXRFaceExpression::BrowLowererL));
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
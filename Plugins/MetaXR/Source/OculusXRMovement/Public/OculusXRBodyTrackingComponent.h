@@ -34,6 +34,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "OculusXR|Movement")
 	void ResetAllBoneTransforms();
 
+	/**
+	 * Apply a body state to the bones, like every tick does with the tracked body state.
+	 * @return Whether the bones were updated. False if the body state is inactive, below the confidence threshold,
+	 *         skipped by bSkipUnchangedBodyState, or the mesh is not set up for bApplyPoseInBulk.
+	 */
+	bool ApplyBodyState(const FOculusXRBodyState& InBodyState);
+
 	/**
 	 * How are the results of body tracking applied to the mesh.
 	 */
@@ -52,15 +59,44 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OculusXR|Movement", meta = (ClampMin = "0", ClampMax = "1", UIMin = "0", UIMax = "1"))
 	float ConfidenceThreshold;
 
+	/**
+	 * Apply the whole tracked pose to the bone space transforms in a single pass instead of setting each bone by name.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OculusXR|Movement")
+	bool bApplyPoseInBulk;
+
+	/**
+	 * Do not apply the body state again if its time didn't advance since the last applied body state.
+	 * Bones that are changed by something else in the meantime are not reset to the body state then.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OculusXR|Movement")
+	bool bSkipUnchangedBodyState;
+
 private:
 	bool InitializeBodyBones();
 
+	// Applies the saved body state to the bones, see ApplyBodyState.
+	bool UpdateBonesFromBodyState();
+
+	// Writes the body state into the bone space transforms, converting from component space once for all bones.
+	// Returns false if the mesh or its bone mapping is missing.
+	bool ApplyBodyStateInBulk();
+
 	// One meter in unreal world units.
 	float WorldToMeters;
 
 	// The index of each mapped bone after the discovery and association of bone names.
 	TMap<EOculusXRBoneID, int32> MappedBoneIndices;
 
+	// The body joint mapped to each bone of the mesh, INDEX_NONE for bones without a joint.
+	TArray<int32> BoneJointIndices;
+
+	// Component space transforms of all bones, reused by every bulk update.
+	TArray<FTransform> ComponentSpaceScratch;
+
+	// Time of the last body state that was applied to the mesh, negative if none was applied yet.
+	float LastAppliedBodyStateTime;
+
 	// Saved body state.
 	FOculusXRBodyState BodyState;
 
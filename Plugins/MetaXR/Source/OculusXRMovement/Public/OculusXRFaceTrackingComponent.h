@@ -9,6 +9,60 @@
 
 #include "OculusXRFaceTrackingComponent.generated.h"
 
+/**
+ * Weights of all face expressions, resolved against the morph targets of one mesh.
+ * The first modifier of each expression is folded into per-expression arrays and applied to all expressions in a
+ * single vectorized pass, any further modifiers of an expression are applied afterwards in order.
+ */
+struct OCULUSXRMOVEMENT_API FOculusXRFaceExpressionWeights
+{
+public:
+	// Number of expressions, padded to a multiple of the vector width
+	static constexpr int32 NumPaddedExpressions = Align(static_cast<int32>(EOculusXRFaceExpression::COUNT), 4);
+
+	FOculusXRFaceExpressionWeights();
+
+	// Resolves the expression names and modifiers against the morph targets of the mesh, keeps the current weights
+	void Resolve(const USkeletalMesh* Mesh, const TMap<EOculusXRFaceExpression, FName>& ExpressionNames, TConstArrayView<FOculusXRFaceExpressionModifier> ExpressionModifiers);
+
+	// Whether the expression has a morph target on the resolved mesh
+	bool IsValid(EOculusXRFaceExpression Expression) const;
+
+	// Copies the weights of all expressions, e.g. the expression weights of a face state
+	void SetWeights(TConstArrayView<float> InWeights);
+
+	// Applies the resolved expression modifiers to the weights
+	void ApplyModifiers();
+
+	// Sets all weights to zero
+	void Clear();
+
+	// Writes the weights into the morph target weights of the component, which has to use the resolved mesh
+	void ApplyToMesh(FOculusXRMorphTargetsController& MorphTargets, USkinnedMeshComponent* TargetMeshComponent) const;
+
+	// Morph target index for each expression, INDEX_NONE for expressions without a valid morph target
+	TArray<int32> MorphTargetIndices;
+
+	// Current weight of each expression, padded to NumPaddedExpressions
+	TArray<float> Weights;
+
+private:
+	// Multiplier and range of the first modifier of each expression, identity for expressions without a modifier
+	TArray<float> ModifierMultipliers;
+	TArray<float> ModifierMinValues;
+	TArray<float> ModifierMaxValues;
+
+	// Further modifiers of expressions that are part of more than one modifier
+	struct FChainedModifier
+	{
+		int32 ExpressionIndex;
+		float Multiplier;
+		float MinValue;
+		float MaxValue;
+	};
+	TArray<FChainedModifier> ChainedModifiers;
+};
+
 UCLASS(Blueprintable, meta = (BlueprintSpawnableComponent, DisplayName = "OculusXR Face Tracking Component"), ClassGroup = OculusXRHMD)
 class OCULUSXRMOVEMENT_API UOculusXRFaceTrackingComponent : public UActorComponent
 {
@@ -88,8 +142,14 @@ private:
 	UPROPERTY()
 	USkinnedMeshComponent* TargetMeshComponent;
 
-	// Which mapped expressions are valid
-	TStaticArray<bool, static_cast<uint32>(EOculusXRFaceExpression::COUNT)> ExpressionValid;
+	// Resolves the expression names and modifiers against the current mesh of the target mesh component
+	void ResolveExpressionMorphTargets();
+
+	// The mesh the expressions were resolved for
+	const USkinnedAsset* ResolvedMesh;
+
+	// Current weight of each expression, written into the morph target weights of the mesh every tick
+	FOculusXRFaceExpressionWeights ExpressionWeights;
 
 	// Morph targets controller
 	FOculusXRMorphTargetsController MorphTargets;
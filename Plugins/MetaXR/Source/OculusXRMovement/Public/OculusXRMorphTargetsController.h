@@ -12,6 +12,9 @@
  * 1) ResetMorphTargetCurves(Component) at the start of the update.
  * 2) SetMorphTarget(...) as many times as needed based on your data set.
  * 3) ApplyMorphTargets(Component) at the end of the update to apply the morph targets to the anim runtime.
+ *
+ * Alternatively, if the morph target indices are known, ApplyMorphTargetWeights(...) writes the weights directly
+ * without any name lookups and without the need to reset the curves every update.
  */
 struct OCULUSXRMOVEMENT_API FOculusXRMorphTargetsController
 {
@@ -22,6 +25,10 @@ public:
 	// Will apply morph target data to the underlying runtime skeletal mesh
 	void ApplyMorphTargets(USkinnedMeshComponent* TargetMeshComponent);
 
+	// Writes weights directly into the morph target weights of the component, skipping weights that didn't change.
+	// MorphTargetIndices and Weights are parallel arrays, entries with an index of INDEX_NONE are ignored.
+	void ApplyMorphTargetWeights(USkinnedMeshComponent* TargetMeshComponent, TConstArrayView<int32> MorphTargetIndices, TConstArrayView<float> Weights);
+
 	// Sets a specific morph target value
 	void SetMorphTarget(FName MorphTargetName, float Value);
 
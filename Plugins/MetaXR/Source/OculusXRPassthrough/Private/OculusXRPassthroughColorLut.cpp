@@ -1,6 +1,7 @@
 // Copyright (c) Meta Platforms, Inc. and affiliates.
 
 #include "OculusXRPassthroughColorLut.h"
+#include "OculusXRPassthroughColorLutConversion.h"
 #include "OculusXRPassthroughXR.h"
 #include "OculusXRPassthroughLayerComponent.h"
 #include "OculusXRPassthroughXRFunctions.h"
@@ -12,6 +13,11 @@
 #include "UObject/ObjectSaveContext.h"
 #include "OculusXRHMD.h"
 #include "TextureResource.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "Math/VectorRegister.h"
+#include "Tasks/Task.h"
 
 namespace
 {
@@ -28,76 +34,218 @@ namespace
 		}
 	}
 
-	TArray<uint8> ColorArrayToColorData(const TArray<FColor>& InColorArray, bool IgnoreAlphaChannel)
+	bool IsTextureDataValid(const FLutTextureData& Data)
 	{
-		TArray<uint8> Data;
-		const size_t ElementSize = IgnoreAlphaChannel ? 3 : 4;
-		Data.SetNum(InColorArray.Num() * ElementSize);
-		uint8* Dest = Data.GetData();
-		for (size_t i = 0; i < InColorArray.Num(); i++)
+		return Data.Data.Num() > 0 && Data.Resolution > 0;
+	}
+
+	// A 64^3 LUT is converted by 16 tasks, smaller ones aren't worth splitting
+	constexpr int32 ColorsPerTask = 16 * 1024;
+
+	void ConvertColorsRGBA(const FColor* RESTRICT Src, uint8* RESTRICT Dest, int32 Num)
+	{
+		int32 i = 0;
+#if PLATFORM_LITTLE_ENDIAN
+		// FColor is stored as BGRA, swap R and B of four colors at a time
+		const VectorRegister4Int MaskGA = MakeVectorRegisterInt(static_cast<int32>(0xFF00FF00), static_cast<int32>(0xFF00FF00), static_cast<int32>(0xFF00FF00), static_cast<int32>(0xFF00FF00));
+		const VectorRegister4Int MaskLow = MakeVectorRegisterInt(0xFF, 0xFF, 0xFF, 0xFF);
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister4Int Colors = VectorIntLoad(Src + i);
+			const VectorRegister4Int R = VectorIntAnd(VectorShiftRightImmLogical(Colors, 16), MaskLow);
+			const VectorRegister4Int B = VectorShiftLeftImm(VectorIntAnd(Colors, MaskLow), 16);
+			VectorIntStore(VectorIntOr(VectorIntAnd(Colors, MaskGA), VectorIntOr(R, B)), Dest + i * 4);
+		}
+#endif
+		for (; i < Num; i++)
 		{
-			Data[i * ElementSize + 0] = InColorArray[i].R;
-			Data[i * ElementSize + 1] = InColorArray[i].G;
-			Data[i * ElementSize + 2] = InColorArray[i].B;
+			Dest[i * 4 + 0] = Src[i].R;
+			Dest[i * 4 + 1] = Src[i].G;
+			Dest[i * 4 + 2] = Src[i].B;
+			Dest[i * 4 + 3] = Src[i].A;
+		}
+	}
+
+	void ConvertColorsRGB(const FColor* RESTRICT Src, uint8* RESTRICT Dest, int32 Num)
+	{
+		for (int32 i = 0; i < Num; i++)
+		{
+			Dest[i * 3 + 0] = Src[i].R;
+			Dest[i * 3 + 1] = Src[i].G;
+			Dest[i * 3 + 2] = Src[i].B;
+		}
+	}
+
+	void ConvertColors(const FColor* Src, uint8* Dest, int32 Num, bool IgnoreAlphaChannel)
+	{
+		if (IgnoreAlphaChannel)
+		{
+			ConvertColorsRGB(Src, Dest, Num);
+		}
+		else
+		{
+			ConvertColorsRGBA(Src, Dest, Num);
+		}
+	}
+} // namespace
+
+namespace OculusXRPassthrough
+{
+	TArray<uint8> ColorArrayToColorData(TConstArrayView<FColor> InColorArray, bool IgnoreAlphaChannel)
+	{
+		TArray<uint8> Data;
+		const int32 ElementSize = IgnoreAlphaChannel ? 3 : 4;
+		const int32 NumColors = InColorArray.Num();
+		Data.SetNumUninitialized(NumColors * ElementSize);
 
-			if (!IgnoreAlphaChannel)
+		const int32 NumTasks = FMath::DivideAndRoundUp(NumColors, ColorsPerTask);
+		ParallelFor(NumTasks, [&](int32 Task) {
+			const int32 Start = Task * ColorsPerTask;
+			ConvertColors(InColorArray.GetData() + Start, Data.GetData() + Start * ElementSize, FMath::Min(ColorsPerTask, NumColors - Start), IgnoreAlphaChannel);
+		});
+
+		return Data;
+	}
+
+	TArray<uint8> ExplodedCubeToColorData(const FColor* InImageData, uint32 TextureWidth, uint32 ColorMapSize, uint32 SlicesPerRow, bool IgnoreAlphaChannel)
+	{
+		TArray<uint8> Data;
+		const uint32 ElementSize = IgnoreAlphaChannel ? 3 : 4;
+		const uint32 SliceSize = ColorMapSize * ColorMapSize;
+		Data.SetNumUninitialized(SliceSize * ColorMapSize * ElementSize);
+
+		// Every row of a slice is contiguous in both the texture and the LUT
+		const int32 MinSlicesPerTask = FMath::Max(1, ColorsPerTask / static_cast<int32>(SliceSize));
+		ParallelFor(TEXT("OculusXRColorLutSlices"), ColorMapSize, MinSlicesPerTask, [&](int32 bi) {
+			const uint32 bi_row = bi % SlicesPerRow;
+			const uint32 bi_col = bi / SlicesPerRow;
+			for (uint32 gi = 0; gi < ColorMapSize; gi++)
 			{
-				Data[i * ElementSize + 3] = InColorArray[i].A;
+				const FColor* Src = InImageData + bi_row * ColorMapSize + (gi + bi_col * ColorMapSize) * TextureWidth;
+				uint8* Dest = Data.GetData() + (bi * SliceSize + gi * ColorMapSize) * ElementSize;
+				ConvertColors(Src, Dest, ColorMapSize, IgnoreAlphaChannel);
 			}
-		}
+		});
 
 		return Data;
 	}
 
-	bool IsTextureDataValid(const FLutTextureData& Data)
+	uint64 HashColorData(const void* InData, int32 NumBytes, uint64 Seed)
 	{
-		return Data.Data.Num() > 0 && Data.Resolution > 0;
+		const uint64 Hash = CityHash64WithSeed(static_cast<const char*>(InData), NumBytes, Seed);
+		return Hash != 0 ? Hash : 1;
 	}
-} // namespace
+} // namespace OculusXRPassthrough
 
 void UOculusXRPassthroughColorLut::SetLutFromArray(const TArray<FColor>& InColorArray, bool InIgnoreAlphaChannel)
+{
+	const int32 Resolution = GetColorArrayResolution(InColorArray);
+	if (Resolution == 0)
+	{
+		return;
+	}
+	ColorArrayRequest++;
+
+	const uint64 Hash = OculusXRPassthrough::HashColorData(InColorArray.GetData(), InColorArray.Num() * sizeof(FColor), InIgnoreAlphaChannel);
+	if (LutHandle != 0 && ColorLutType == EColorLutType::Array && Hash == ColorArrayHash)
+	{
+		return;
+	}
+
+	ApplyColorData(OculusXRPassthrough::ColorArrayToColorData(InColorArray, InIgnoreAlphaChannel), Resolution, InIgnoreAlphaChannel, Hash);
+}
+
+void UOculusXRPassthroughColorLut::SetLutFromArrayAsync(const TArray<FColor>& InColorArray, bool InIgnoreAlphaChannel, const FOculusXRColorLutReady& OnReady)
+{
+	const int32 Resolution = GetColorArrayResolution(InColorArray);
+	if (Resolution == 0)
+	{
+		return;
+	}
+
+	const uint32 Request = ++ColorArrayRequest;
+	const uint64 CurrentHash = LutHandle != 0 && ColorLutType == EColorLutType::Array ? ColorArrayHash : 0;
+	TWeakObjectPtr<UOculusXRPassthroughColorLut> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Request, CurrentHash, Resolution, InIgnoreAlphaChannel, OnReady, Colors = InColorArray]() mutable {
+		const uint64 Hash = OculusXRPassthrough::HashColorData(Colors.GetData(), Colors.Num() * sizeof(FColor), InIgnoreAlphaChannel);
+		TArray<uint8> Data;
+		if (Hash != CurrentHash)
+		{
+			Data = OculusXRPassthrough::ColorArrayToColorData(Colors, InIgnoreAlphaChannel);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Request, Hash, Resolution, InIgnoreAlphaChannel, OnReady, Colors = MoveTemp(Colors), Data = MoveTemp(Data)]() {
+			UOculusXRPassthroughColorLut* This = WeakThis.Get();
+			if (This == nullptr || This->ColorArrayRequest != Request)
+			{
+				return;
+			}
+
+			if (This->LutHandle == 0 || This->ColorLutType != EColorLutType::Array || Hash != This->ColorArrayHash)
+			{
+				// Conversion was skipped for unchanged colors, but the LUT object has been destroyed since
+				This->ApplyColorData(Data.Num() > 0 ? Data : OculusXRPassthrough::ColorArrayToColorData(Colors, InIgnoreAlphaChannel), Resolution, InIgnoreAlphaChannel, Hash);
+			}
+			OnReady.ExecuteIfBound(This);
+		});
+	});
+}
+
+int32 UOculusXRPassthroughColorLut::GetColorArrayResolution(const TArray<FColor>& InColorArray)
 {
 	const int32 Size = InColorArray.Num();
 	const int32 Resolution = FPlatformMath::RoundToInt(FPlatformMath::Pow(Size, 1.0 / 3));
 	if (Resolution > GetMaxResolution())
 	{
 		UE_LOG(LogOculusPassthrough, Warning, TEXT("Setting array ignored: Resoluton is exceeding maximum resoluton of %d."), GetMaxResolution());
-		return;
+		return 0;
 	}
 	if (Resolution * Resolution * Resolution != Size)
 	{
 		UE_LOG(LogOculusPassthrough, Warning, TEXT("Setting array ignored: Provided array size is not cube."));
-		return;
+		return 0;
 	}
 
 	/* Check if size if power of 2 */
 	if ((Size & (Size - 1)) != 0)
 	{
 		UE_LOG(LogOculusPassthrough, Warning, TEXT("Setting array ignored: Provided array does not result in a resolution that is a power of two."));
-		return;
+		return 0;
 	}
 
-	ColorLutType = EColorLutType::Array;
+	return Resolution;
+}
 
-	const TArray<uint8>& Data = ColorArrayToColorData(InColorArray, InIgnoreAlphaChannel);
+void UOculusXRPassthroughColorLut::ApplyColorData(const TArray<uint8>& InData, int32 Resolution, bool InIgnoreAlphaChannel, uint64 Hash)
+{
+	ColorLutType = EColorLutType::Array;
+	ColorArrayHash = Hash;
 
-	if (LutHandle == 0)
+	if (LutHandle != 0 && InIgnoreAlphaChannel == IgnoreAlphaChannel && Resolution == ColorArrayResolution)
 	{
-		LutHandle = CreateLutObject(Data, Resolution);
+		UpdateLutObject(LutHandle, InData);
 		return;
 	}
 
-	if (InIgnoreAlphaChannel == IgnoreAlphaChannel && Resolution == ColorArrayResolution)
-	{
-		UpdateLutObject(LutHandle, Data);
-		return;
-	}
+	// The channels and resolution need to be known before creating the object
+	IgnoreAlphaChannel = InIgnoreAlphaChannel;
+	ColorArrayResolution = Resolution;
 
+	const uint64 PreviousHandle = LutHandle;
 	DestroyLutObject(LutHandle);
-	LutHandle = CreateLutObject(Data, Resolution);
+	LutHandle = CreateLutObject(InData, Resolution);
 
-	IgnoreAlphaChannel = InIgnoreAlphaChannel;
-	ColorArrayResolution = Resolution;
+	// Layers that already use this LUT need to pick up the new handle
+	if (LutHandle != PreviousHandle)
+	{
+		for (const TWeakObjectPtr<UOculusXRPassthroughLayerBase>& LayerRef : LayerRefs)
+		{
+			if (LayerRef.IsValid())
+			{
+				LayerRef->MarkStereoLayerDirty();
+			}
+		}
+	}
 }
 
 uint64 UOculusXRPassthroughColorLut::GetHandle(UOculusXRPassthroughLayerBase* LayerRef)
@@ -108,7 +256,7 @@ uint64 UOculusXRPassthroughColorLut::GetHandle(UOculusXRPassthroughLayerBase* La
 	}
 
 	// Add layer to reference list
-	LayerRefs.AddUnique(LayerRef->GetUniqueID());
+	LayerRefs.AddUnique(LayerRef);
 
 	return LutHandle;
 }
@@ -123,7 +271,7 @@ void UOculusXRPassthroughColorLut::PreSave(FObjectPreSaveContext ObjectSaveConte
 
 void UOculusXRPassthroughColorLut::RemoveReference(UOculusXRPassthroughLayerBase* LayerRef)
 {
-	LayerRefs.Remove(LayerRef->GetUniqueID());
+	LayerRefs.Remove(LayerRef);
 
 	if (LayerRefs.Num() == 0)
 	{
@@ -132,7 +280,7 @@ void UOculusXRPassthroughColorLut::RemoveReference(UOculusXRPassthroughLayerBase
 	}
 }
 
-FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2D* InLutTexture) const
+FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2D* InLutTexture)
 {
 
 	if (ColorLutType != EColorLutType::TextureLUT)
@@ -195,25 +343,18 @@ FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2
 	FByteBulkData* BulkData = &MipMap.BulkData;
 	const FColor* FormatedImageData = reinterpret_cast<const FColor*>(BulkData->Lock(LOCK_READ_ONLY));
 
-	TArray<FColor> Colors;
-	Colors.SetNum(ColorMapSize * ColorMapSize * ColorMapSize);
-
-	for (uint32 bi = 0; bi < ColorMapSize; bi++)
+	// Saving doesn't need to reconvert a texture that didn't change
+	const uint64 Hash = OculusXRPassthrough::HashColorData(FormatedImageData, TextureWidth * TextureHeight * sizeof(FColor), (static_cast<uint64>(TextureWidth) << 1) | IgnoreAlphaChannel);
+	if (Hash == StoredTextureHash && IsTextureDataValid(StoredTextureData))
 	{
-		uint32 bi_row = bi % SlicesPerRow;
-		uint32 bi_col = bi / SlicesPerRow;
-		for (uint32 gi = 0; gi < ColorMapSize; gi++)
-		{
-			for (uint32 ri = 0; ri < ColorMapSize; ri++)
-			{
-				uint32 sX = ri + bi_row * ColorMapSize;
-				uint32 sY = gi + bi_col * ColorMapSize;
-				Colors[bi * ColorMapSize * ColorMapSize + gi * ColorMapSize + ri] = FormatedImageData[sX + sY * TextureWidth];
-			}
-		}
+		BulkData->Unlock();
+		return StoredTextureData;
 	}
+
+	FLutTextureData TextureData(OculusXRPassthrough::ExplodedCubeToColorData(FormatedImageData, TextureWidth, ColorMapSize, SlicesPerRow, IgnoreAlphaChannel), ColorMapSize);
 	BulkData->Unlock();
-	return FLutTextureData(ColorArrayToColorData(Colors, IgnoreAlphaChannel), ColorMapSize);
+	StoredTextureHash = Hash;
+	return TextureData;
 }
 
 uint64 UOculusXRPassthroughColorLut::CreateLutObject(const TArray<uint8>& InData, uint32 Resolution) const
@@ -0,0 +1,17 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace OculusXRPassthrough
+{
+	// Packs colors into the RGB or RGBA byte layout color LUT objects are created from. Large arrays are converted in parallel.
+	TArray<uint8> ColorArrayToColorData(TConstArrayView<FColor> InColorArray, bool IgnoreAlphaChannel);
+
+	// Same as ColorArrayToColorData, but reads the colors from an "exploded cube" texture with ColorMapSize slices laid out SlicesPerRow per row
+	TArray<uint8> ExplodedCubeToColorData(const FColor* InImageData, uint32 TextureWidth, uint32 ColorMapSize, uint32 SlicesPerRow, bool IgnoreAlphaChannel);
+
+	// Content hash used to skip converting and uploading colors that didn't change. Never returns 0.
+	uint64 HashColorData(const void* InData, int32 NumBytes, uint64 Seed);
+} // namespace OculusXRPassthrough
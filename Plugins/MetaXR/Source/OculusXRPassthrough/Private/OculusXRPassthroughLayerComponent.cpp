@@ -12,6 +12,7 @@
 #include "OculusXRPersistentPassthroughInstance.h"
 #include "OculusXRPassthroughSubsystem.h"
 #include "Curves/CurveLinearColor.h"
+#include "Hash/CityHash.h"
 #include "StaticMeshResources.h"
 
 DEFINE_LOG_CATEGORY(LogOculusPassthrough);
@@ -631,6 +632,27 @@ TArray<FLinearColor> UOculusXRPassthroughLayerBase::GenerateColorArrayFromColorC
 		return TArray<FLinearColor>();
 	}
 
+	// Only reevaluate the curve if its keys or color adjustments changed
+	const float Adjustments[] = { InColorMapCurve->AdjustHue, InColorMapCurve->AdjustSaturation, InColorMapCurve->AdjustBrightness, InColorMapCurve->AdjustBrightnessCurve, InColorMapCurve->AdjustVibrance, InColorMapCurve->AdjustMinAlpha, InColorMapCurve->AdjustMaxAlpha };
+	uint64 Hash = CityHash64(reinterpret_cast<const char*>(Adjustments), sizeof(Adjustments));
+	for (const FRichCurve& Curve : InColorMapCurve->FloatCurves)
+	{
+		const TArray<FRichCurveKey>& Keys = Curve.GetConstRefOfKeys();
+		const float CurveParams[] = { Curve.DefaultValue, static_cast<float>(Curve.PreInfinityExtrap), static_cast<float>(Curve.PostInfinityExtrap) };
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(CurveParams), sizeof(CurveParams), Hash);
+		// Field by field, the padding of FRichCurveKey is not initialized
+		for (const FRichCurveKey& Key : Keys)
+		{
+			const float KeyParams[] = { Key.Time, Key.Value, Key.ArriveTangent, Key.ArriveTangentWeight, Key.LeaveTangent, Key.LeaveTangentWeight,
+				static_cast<float>(Key.InterpMode), static_cast<float>(Key.TangentMode), static_cast<float>(Key.TangentWeightMode) };
+			Hash = CityHash64WithSeed(reinterpret_cast<const char*>(KeyParams), sizeof(KeyParams), Hash);
+		}
+	}
+	if (Hash == CurveColorArrayHash && CurveColorArray.Num() > 0)
+	{
+		return CurveColorArray;
+	}
+
 	TArray<FLinearColor> NewColorArray;
 	constexpr uint32 TotalEntries = 256;
 	NewColorArray.Empty();
@@ -641,6 +663,9 @@ TArray<FLinearColor> UOculusXRPassthroughLayerBase::GenerateColorArrayFromColorC
 		const float Alpha = ((float)Index / TotalEntries);
 		NewColorArray[Index] = InColorMapCurve->GetLinearColorValue(Alpha);
 	}
+
+	CurveColorArray = NewColorArray;
+	CurveColorArrayHash = Hash;
 	return NewColorArray;
 }
 
@@ -0,0 +1,161 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+#include "OculusXRPassthroughColorLutConversion.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Conversions as they were done before they were vectorized, used as reference
+	TArray<uint8> ScalarColorArrayToColorData(const TArray<FColor>& InColorArray, bool IgnoreAlphaChannel)
+	{
+		TArray<uint8> Data;
+		const size_t ElementSize = IgnoreAlphaChannel ? 3 : 4;
+		Data.SetNum(InColorArray.Num() * ElementSize);
+		for (size_t i = 0; i < InColorArray.Num(); i++)
+		{
+			Data[i * ElementSize + 0] = InColorArray[i].R;
+			Data[i * ElementSize + 1] = InColorArray[i].G;
+			Data[i * ElementSize + 2] = InColorArray[i].B;
+
+			if (!IgnoreAlphaChannel)
+			{
+				Data[i * ElementSize + 3] = InColorArray[i].A;
+			}
+		}
+		return Data;
+	}
+
+	TArray<uint8> ScalarExplodedCubeToColorData(const FColor* FormatedImageData, uint32 TextureWidth, uint32 ColorMapSize, uint32 SlicesPerRow, bool IgnoreAlphaChannel)
+	{
+		TArray<FColor> Colors;
+		Colors.SetNum(ColorMapSize * ColorMapSize * ColorMapSize);
+
+		for (uint32 bi = 0; bi < ColorMapSize; bi++)
+		{
+			uint32 bi_row = bi % SlicesPerRow;
+			uint32 bi_col = bi / SlicesPerRow;
+			for (uint32 gi = 0; gi < ColorMapSize; gi++)
+			{
+				for (uint32 ri = 0; ri < ColorMapSize; ri++)
+				{
+					uint32 sX = ri + bi_row * ColorMapSize;
+					uint32 sY = gi + bi_col * ColorMapSize;
+					Colors[bi * ColorMapSize * ColorMapSize + gi * ColorMapSize + ri] = FormatedImageData[sX + sY * TextureWidth];
+				}
+			}
+		}
+		return ScalarColorArrayToColorData(Colors, IgnoreAlphaChannel);
+	}
+
+	TArray<FColor> CreateColors(int32 NumColors, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<FColor> Colors;
+		Colors.SetNumUninitialized(NumColors);
+		for (FColor& Color : Colors)
+		{
+			Color.DWColor() = Random.GetUnsignedInt();
+		}
+		return Colors;
+	}
+} // namespace
+
+BEGIN_DEFINE_SPEC(FOculusXRPassthroughColorLutSpec, TEXT("OculusXR.Passthrough.ColorLut"), EAutomationTestFlags::ProductFilter | EAutomationTestFlags::ApplicationContextMask)
+END_DEFINE_SPEC(FOculusXRPassthroughColorLutSpec)
+
+void FOculusXRPassthroughColorLutSpec::Define()
+{
+	using namespace OculusXRPassthrough;
+
+	It(TEXT("Converts color arrays like the scalar path"), [this]() {
+		// Odd sizes exercise the colors left over after the vectorized part
+		for (const int32 NumColors : { 1, 7, 4096, 32 * 1024 + 3, 64 * 64 * 64 })
+		{
+			const TArray<FColor> Colors = CreateColors(NumColors, NumColors);
+			TestTrue(FString::Printf(TEXT("RGBA data of %d colors"), NumColors), ColorArrayToColorData(Colors, false) == ScalarColorArrayToColorData(Colors, false));
+			TestTrue(FString::Printf(TEXT("RGB data of %d colors"), NumColors), ColorArrayToColorData(Colors, true) == ScalarColorArrayToColorData(Colors, true));
+		}
+	});
+
+	It(TEXT("Converts exploded cube textures like the scalar path"), [this]() {
+		for (const uint32 ColorMapSize : { 4, 16, 64 })
+		{
+			// Square texture with sqrt(ColorMapSize) slices per row, and a rectangular one with all slices in one row
+			const uint32 SquareSlicesPerRow = FMath::Sqrt(static_cast<float>(ColorMapSize));
+			const TArray<FColor> Image = CreateColors(ColorMapSize * ColorMapSize * ColorMapSize, ColorMapSize);
+			const uint32 SquareWidth = SquareSlicesPerRow * ColorMapSize;
+			TestTrue(FString::Printf(TEXT("Square %d^3 LUT"), ColorMapSize),
+				ExplodedCubeToColorData(Image.GetData(), SquareWidth, ColorMapSize, SquareSlicesPerRow, false) == ScalarExplodedCubeToColorData(Image.GetData(), SquareWidth, ColorMapSize, SquareSlicesPerRow, false));
+			TestTrue(FString::Printf(TEXT("Rectangular %d^3 LUT without alpha"), ColorMapSize),
+				ExplodedCubeToColorData(Image.GetData(), ColorMapSize * ColorMapSize, ColorMapSize, ColorMapSize, true) == ScalarExplodedCubeToColorData(Image.GetData(), ColorMapSize * ColorMapSize, ColorMapSize, ColorMapSize, true));
+		}
+	});
+
+	It(TEXT("Hashes colors by content"), [this]() {
+		TArray<FColor> Colors = CreateColors(16 * 16 * 16, 1);
+		const int32 NumBytes = Colors.Num() * sizeof(FColor);
+		const uint64 Hash = HashColorData(Colors.GetData(), NumBytes, 0);
+		TestEqual(TEXT("Hash of a copy"), HashColorData(TArray<FColor>(Colors).GetData(), NumBytes, 0), Hash);
+		TestNotEqual(TEXT("Hash with other seed"), HashColorData(Colors.GetData(), NumBytes, 1), Hash);
+		Colors.Last().A ^= 1;
+		TestNotEqual(TEXT("Hash after changing one channel"), HashColorData(Colors.GetData(), NumBytes, 0), Hash);
+	});
+
+	It(TEXT("Converts 16, 32 and 64 resolution LUTs"), [this]() {
+		constexpr int32 NumIterations = 20;
+		for (const uint32 ColorMapSize : { 16, 32, 64 })
+		{
+			const TArray<FColor> Image = CreateColors(ColorMapSize * ColorMapSize * ColorMapSize, ColorMapSize);
+			const uint32 TextureWidth = ColorMapSize * ColorMapSize;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				ScalarExplodedCubeToColorData(Image.GetData(), TextureWidth, ColorMapSize, ColorMapSize, false);
+			}
+			const double ScalarTextureTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				ExplodedCubeToColorData(Image.GetData(), TextureWidth, ColorMapSize, ColorMapSize, false);
+			}
+			const double TextureTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				ScalarColorArrayToColorData(Image, false);
+			}
+			const double ScalarArrayTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				ColorArrayToColorData(Image, false);
+			}
+			const double ArrayTime = FPlatformTime::Seconds() - StartTime;
+
+			// What an unchanged texture or array costs now that it isn't reconverted
+			StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumIterations; ++i)
+			{
+				HashColorData(Image.GetData(), Image.Num() * sizeof(FColor), 0);
+			}
+			const double HashTime = FPlatformTime::Seconds() - StartTime;
+
+			AddInfo(FString::Printf(TEXT("%d^3 LUT: texture scalar %.3f ms, vectorized %.3f ms; array scalar %.3f ms, vectorized %.3f ms; unchanged %.3f ms"),
+				ColorMapSize,
+				ScalarTextureTime * 1000.0 / NumIterations,
+				TextureTime * 1000.0 / NumIterations,
+				ScalarArrayTime * 1000.0 / NumIterations,
+				ArrayTime * 1000.0 / NumIterations,
+				HashTime * 1000.0 / NumIterations));
+		}
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
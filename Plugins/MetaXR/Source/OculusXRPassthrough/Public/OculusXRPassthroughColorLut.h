@@ -9,6 +9,9 @@
 #include "OculusXRPassthroughColorLut.generated.h"
 
 class UOculusXRPassthroughLayerBase;
+class UOculusXRPassthroughColorLut;
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOculusXRColorLutReady, UOculusXRPassthroughColorLut*, ColorLut);
 
 enum EColorLutChannels
 {
@@ -63,6 +66,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Passthrough Color LUT")
 	void SetLutFromArray(const TArray<FColor>& InColorArray, bool InIgnoreAlphaChannel);
 
+	/**
+	 * Same as SetLutFromArray, but converts the array on a background task. The LUT is applied to this object and the layers using it
+	 * on the game thread once the conversion is done, then OnReady is called. Only the latest request is applied if several are pending.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Passthrough Color LUT")
+	void SetLutFromArrayAsync(const TArray<FColor>& InColorArray, bool InIgnoreAlphaChannel, const FOculusXRColorLutReady& OnReady);
+
 	// Gets the handle of the lut object. It asks for a layer reference to track the list of objects who currently need the handle.
 	// Call "RemoveReference()" when you don't need the lut anymore.
 	uint64 GetHandle(UOculusXRPassthroughLayerBase* LayerRef);
@@ -78,8 +88,15 @@ private:
 	uint64 LutHandle = 0;
 	int32 ColorArrayResolution = 0;
 	int MaxResolution = -1;
-	TArray<uint32> LayerRefs;
-	FLutTextureData TextureToColorData(class UTexture2D* InLutTexture) const;
+	TArray<TWeakObjectPtr<UOculusXRPassthroughLayerBase>> LayerRefs;
+	// Content hashes of the colors the LUT object and StoredTextureData were last generated from
+	uint64 ColorArrayHash = 0;
+	uint64 StoredTextureHash = 0;
+	// Incremented by every SetLutFromArray call so that outdated async results are dropped
+	uint32 ColorArrayRequest = 0;
+	int32 GetColorArrayResolution(const TArray<FColor>& InColorArray);
+	void ApplyColorData(const TArray<uint8>& InData, int32 Resolution, bool InIgnoreAlphaChannel, uint64 Hash);
+	FLutTextureData TextureToColorData(class UTexture2D* InLutTexture);
 	uint64 CreateLutObject(const TArray<uint8>& InData, uint32 Resolution) const;
 	void UpdateLutObject(uint64 Handle, const TArray<uint8>& InData) const;
 	void DestroyLutObject(uint64 Handle) const;
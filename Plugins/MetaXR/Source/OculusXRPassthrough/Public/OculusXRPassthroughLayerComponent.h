@@ -172,8 +172,14 @@ public:
 	virtual void BeginDestroy();
 
 protected:
+	// Marks the layers dirty when the handle of a color LUT they use changes
+	friend class UOculusXRPassthroughColorLut;
+
 	TArray<FLinearColor> ColorArray;
 	TArray<FLinearColor> NeutralColorArray;
+	// Last array generated from a color curve and the content hash of the curve it was generated from
+	mutable TArray<FLinearColor> CurveColorArray;
+	mutable uint64 CurveColorArrayHash = 0;
 	TArray<FLinearColor> GenerateColorArrayFromColorCurve(const UCurveLinearColor* InColorMapCurve) const;
 	TArray<FLinearColor> GetOrGenerateNeutralColorArray();
 	TArray<FLinearColor> GenerateColorArray(bool bInUseColorMapCurve, const UCurveLinearColor* InColorMapCurve);
@@ -129,6 +129,10 @@ void UIsdkExternalHandDataSource::SetImplHandData(const FTransform& WorldTransfo
 
     EnsureDataSourceResult(static_cast<EIsdkDataSourceUpdateDataResult>(RetVal));
   }
+
+  // Joints set from outside the tick are final as well, publish them right away so snapshot
+  // readers don't keep showing the previous joints
+  HandData->PublishSnapshot();
 }
 
 void UIsdkExternalHandDataSource::BeginDestroy()
@@ -55,6 +55,12 @@ void UIsdkHandDataModifier::TickComponent(
       ModifiedRootPose =
           StructTypesUtils::ConvertTransform(GetApiIHandDataModifier()->getRootPose());
     }
+
+    // The modified joints are only read after the base class published, publish them again
+    if (IsValid(HandData))
+    {
+      HandData->PublishSnapshot();
+    }
   }
 }
 
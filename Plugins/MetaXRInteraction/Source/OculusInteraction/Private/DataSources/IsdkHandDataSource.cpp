@@ -68,6 +68,12 @@ void UIsdkHandDataSource::TickComponent(
       EnsureDataSourceResult(static_cast<EIsdkDataSourceUpdateDataResult>(RetVal));
     }
   }
+
+  // Derived data sources write their joints before calling into this, so they are final now
+  if (IsValid(HandData))
+  {
+    HandData->PublishSnapshot();
+  }
 }
 
 UIsdkHandData* UIsdkHandDataSource::GetHandData_Implementation()
@@ -43,7 +43,25 @@ void UIsdkHandDigitRecognizer::UpdateState(float DeltaTime)
     }
   }
 
-  return ApiDigitRecognizer->update(DeltaTime);
+  // The recognizer only sees the hand through the hand position frame of the mesh. A state change
+  // can still be pending for MinTimeToTransition after the pose last changed, so it keeps updating
+  // until one update past that time, and only then skips while the pose stays the same.
+  const uint64 PoseRevision = IsValid(HandMesh) ? HandMesh->GetPoseRevision() : 0;
+  if (PoseRevision != LastHandPoseRevision)
+  {
+    LastHandPoseRevision = PoseRevision;
+    TimeSincePoseChange = 0.f;
+  }
+  else if (TimeSincePoseChange > RangeParameters.MinTimeToTransition)
+  {
+    return;
+  }
+  else
+  {
+    TimeSincePoseChange += DeltaTime;
+  }
+
+  ApiDigitRecognizer->update(DeltaTime);
 }
 
 bool UIsdkHandDigitRecognizer::IsActive()
@@ -105,6 +105,8 @@ void UIsdkHandPalmGrabRecognizer::UpdateState(float DeltaTime)
     return;
   }
 
+  // Updated every frame, even while the hand pose doesn't change: the native recognizer debounces
+  // its state over time, and doesn't tell whether a state change is still pending
   const bool bWasActive = !!Recognizer->isActive();
   Recognizer->update(DeltaTime);
   const bool bIsActive = !!Recognizer->isActive();
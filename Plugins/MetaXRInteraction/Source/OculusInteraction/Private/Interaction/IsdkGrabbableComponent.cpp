@@ -83,6 +83,7 @@ void UIsdkGrabbableComponent::BeginPlay()
   {
     GrabCollider->SetGenerateOverlapEvents(true);
   }
+  RegisterGrabCollider();
 
   // This is just for debugging, so let's turn it off in non-editor builds
 #if WITH_EDITOR && !WITH_DEV_AUTOMATION_TESTS
@@ -107,6 +108,10 @@ void UIsdkGrabbableComponent::BeginPlay()
 
 void UIsdkGrabbableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+  if (UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld()))
+  {
+    WorldSubsystem->UnregisterGrabbableCollider(this);
+  }
   Super::EndPlay(EndPlayReason);
 }
 
@@ -231,6 +236,10 @@ void UIsdkGrabbableComponent::SetGrabCollider(UPrimitiveComponent* NewGrabCollid
   if (IsValid(NewGrabCollider))
   {
     GrabCollider = NewGrabCollider;
+    if (HasBegunPlay())
+    {
+      RegisterGrabCollider();
+    }
   }
 }
 
@@ -272,6 +281,14 @@ void UIsdkGrabbableComponent::SetState(EIsdkInteractableState NewState)
   Super::SetState(NewState);
 }
 
+void UIsdkGrabbableComponent::RegisterGrabCollider()
+{
+  if (UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld()))
+  {
+    WorldSubsystem->RegisterGrabbableCollider(this, GrabCollider);
+  }
+}
+
 UPrimitiveComponent* UIsdkGrabbableComponent::FindCollider()
 {
   bool Found{false};
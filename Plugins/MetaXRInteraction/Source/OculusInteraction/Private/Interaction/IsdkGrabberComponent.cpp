@@ -24,6 +24,7 @@
 
 #include "IsdkRuntimeSettings.h"
 #include "OculusInteractionLog.h"
+#include "OculusInteractionStats.h"
 #include "Components/BoxComponent.h"
 #include "Interaction/IsdkGrabbableComponent.h"
 #include "Subsystem/IsdkWorldSubsystem.h"
@@ -36,6 +37,11 @@ namespace isdk
 extern TAutoConsoleVariable<bool> CVar_Meta_InteractionSDK_DebugInteractionVisuals;
 }
 
+DECLARE_CYCLE_STAT(
+    TEXT("Grabber Query Hover Candidates"),
+    STAT_IsdkGrabberQueryHoverCandidates,
+    STATGROUP_OculusInteraction);
+
 UIsdkGrabberComponent::UIsdkGrabberComponent()
 {
   PrimaryComponentTick.bCanEverTick = true;
@@ -106,6 +112,7 @@ void UIsdkGrabberComponent::BeginPlay()
     DefaultPalmCollider->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     DefaultPalmCollider->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
     DefaultPalmCollider->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
+    DefaultPalmCollider->SetGenerateOverlapEvents(!bQueryHoverCandidates);
     DefaultPalmCollider->SetMobility(EComponentMobility::Movable);
     DefaultPalmCollider->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
     DefaultPalmCollider->RegisterComponent();
@@ -119,6 +126,7 @@ void UIsdkGrabberComponent::BeginPlay()
     Sphere->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     Sphere->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
     Sphere->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
+    Sphere->SetGenerateOverlapEvents(!bQueryHoverCandidates);
     Sphere->SetMobility(EComponentMobility::Movable);
     Sphere->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
     Sphere->RegisterComponent();
@@ -201,56 +209,20 @@ void UIsdkGrabberComponent::BeginOverlap(
     bool bFromSweep,
     const FHitResult& SweepResult)
 {
-  FIsdkColliderInfo Info;
+  // Hover candidates come from UpdateQueriedHoverCandidates instead
+  if (bQueryHoverCandidates || !IsValid(OtherComp))
+  {
+    return;
+  }
 
-  auto Type = FindColliderType(OverlappedComponent);
-  // first make sure it's one of the collider components we care about and we've got a legit other
-  // component
-  if (IsValid(OtherComp) && GetColliderInfo(OverlappedComponent, Type, Info))
+  if (UIsdkGrabbableComponent* Grabbable = FindGrabbableInActor(OtherComp->GetOwner()))
   {
-    if (UIsdkGrabbableComponent* Grabbable = FindGrabbableInActor(OtherComp->GetOwner()))
+    if (OtherComp == Grabbable->GetCollider(true)) // Use grab collider
     {
-      if (OtherComp == Grabbable->GetCollider(true)) // Use grab collider
-      {
-        if (!Grabbable->AllowsGrabType(Type))
-        {
-          return;
-        }
-
-        if (Type == EIsdkGrabColliderType::Palm && !bAllowPalmGrab)
-        {
-          return;
-        }
-
-        if (Type == EIsdkGrabColliderType::Pinch && !bAllowPinchGrab)
-        {
-          return;
-        }
-
-        if (!Info.HoverObjects.Contains(OtherComp))
-        {
-          Info.HoverObjects.Add(OtherComp, Grabbable);
-        }
-        Info.RankIndex = NextRankIndex++;
-        if (Info.State == EIsdkInteractorState::Normal)
-        {
-          Info.State = EIsdkInteractorState::Hover;
-        }
-        SetColliderInfo(OverlappedComponent, Type, Info);
-        PostEvent(EIsdkPointerEventType::Hover, Grabbable);
-
-        UPrimitiveComponent* MyCollider;
-        UPrimitiveComponent* BestCollider;
-        UIsdkGrabbableComponent* BestGrabbable;
-        ComputeBestGrabbableColliderForGrabType(Type, MyCollider, BestCollider, BestGrabbable);
-        CandidateGrabbable = BestGrabbable;
-
-        UpdateState();
-      }
+      AddHoverObject(
+          OverlappedComponent, FindColliderType(OverlappedComponent), OtherComp, Grabbable);
     }
   }
-
-  UpdateOverlappedSet();
 }
 
 void UIsdkGrabberComponent::EndOverlap(
@@ -258,48 +230,114 @@ void UIsdkGrabberComponent::EndOverlap(
     AActor* OtherActor,
     UPrimitiveComponent* OtherComp,
     int32 OtherBodyIndex)
+{
+  if (bQueryHoverCandidates)
+  {
+    return;
+  }
+
+  RemoveHoverObject(OverlappedComponent, FindColliderType(OverlappedComponent), OtherComp);
+}
+
+void UIsdkGrabberComponent::AddHoverObject(
+    UPrimitiveComponent* Collider,
+    EIsdkGrabColliderType Type,
+    UPrimitiveComponent* OtherComp,
+    UIsdkGrabbableComponent* Grabbable)
 {
   FIsdkColliderInfo Info;
 
-  auto Type = FindColliderType(OverlappedComponent);
   // first make sure it's one of the collider components we care about
-  if (!GetColliderInfo(OverlappedComponent, Type, Info))
+  if (!GetColliderInfo(Collider, Type, Info))
+  {
+    return;
+  }
+
+  if (!Grabbable->AllowsGrabType(Type))
+  {
+    return;
+  }
+
+  if (Type == EIsdkGrabColliderType::Palm && !bAllowPalmGrab)
+  {
+    return;
+  }
+
+  if (Type == EIsdkGrabColliderType::Pinch && !bAllowPinchGrab)
+  {
+    return;
+  }
+
+  if (!Info.HoverObjects.Contains(OtherComp))
+  {
+    Info.HoverObjects.Add(OtherComp, Grabbable);
+  }
+  Info.RankIndex = NextRankIndex++;
+  if (Info.State == EIsdkInteractorState::Normal)
+  {
+    Info.State = EIsdkInteractorState::Hover;
+  }
+  SetColliderInfo(Collider, Type, Info);
+  PostEvent(EIsdkPointerEventType::Hover, Grabbable);
+
+  UPrimitiveComponent* MyCollider;
+  UPrimitiveComponent* BestCollider;
+  UIsdkGrabbableComponent* BestGrabbable;
+  ComputeBestGrabbableColliderForGrabType(Type, MyCollider, BestCollider, BestGrabbable);
+  CandidateGrabbable = BestGrabbable;
+
+  UpdateState();
+  UpdateOverlappedSet(Grabbable);
+}
+
+void UIsdkGrabberComponent::RemoveHoverObject(
+    UPrimitiveComponent* Collider,
+    EIsdkGrabColliderType Type,
+    UPrimitiveComponent* OtherComp)
+{
+  FIsdkColliderInfo Info;
+
+  // first make sure it's one of the collider components we care about
+  if (!GetColliderInfo(Collider, Type, Info))
   {
     return;
   }
 
   // have we already started tracking this particular component of the grabbable's?
+  UIsdkGrabbableComponent* HoveredGrabbable = nullptr;
   if (UIsdkGrabbableComponent** Grabbable = Info.HoverObjects.Find(OtherComp))
   {
-    if (IsValid(*Grabbable))
+    HoveredGrabbable = *Grabbable;
+    if (IsValid(HoveredGrabbable))
     {
-      PostEvent(EIsdkPointerEventType::Unhover, *Grabbable);
+      PostEvent(EIsdkPointerEventType::Unhover, HoveredGrabbable);
     }
     Info.HoverObjects.Remove(OtherComp);
     if (Info.HoverObjects.IsEmpty() && Info.State != EIsdkInteractorState::Select)
     {
       Info.State = EIsdkInteractorState::Normal;
     }
-    SetColliderInfo(OverlappedComponent, Type, Info);
+    SetColliderInfo(Collider, Type, Info);
   }
 
+  UIsdkGrabbableComponent* OwnerGrabbable = nullptr;
   if (IsValid(OtherComp))
   {
-    UIsdkGrabbableComponent* Grabbable = FindGrabbableInActor(OtherComp->GetOwner());
-    if (Grabbable)
+    OwnerGrabbable = FindGrabbableInActor(OtherComp->GetOwner());
+    if (OwnerGrabbable)
     {
       // if hand moves too fast it can move outside the currently grabbed object, so check here to
       // see if we're currently grabbing something
       if (State != EIsdkInteractorState::Select)
       {
-        if (Grabbable == Info.SelectObject)
+        if (OwnerGrabbable == Info.SelectObject)
         {
           Info.SelectObject = nullptr;
-          SetColliderInfo(OverlappedComponent, Type, Info);
+          SetColliderInfo(Collider, Type, Info);
         }
       }
 
-      if (CandidateGrabbable == Grabbable)
+      if (CandidateGrabbable == OwnerGrabbable)
       {
         UPrimitiveComponent* BestCollider;
         UIsdkGrabbableComponent* BestGrabbable;
@@ -312,34 +350,126 @@ void UIsdkGrabberComponent::EndOverlap(
     }
   }
 
-  UpdateOverlappedSet();
+  UpdateOverlappedSet(HoveredGrabbable);
+  if (OwnerGrabbable != HoveredGrabbable)
+  {
+    UpdateOverlappedSet(OwnerGrabbable);
+  }
+}
+
+void UIsdkGrabberComponent::UpdateQueriedHoverCandidates()
+{
+  SCOPE_CYCLE_COUNTER(STAT_IsdkGrabberQueryHoverCandidates);
+
+  UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld());
+  if (!IsValid(WorldSubsystem))
+  {
+    return;
+  }
+
+  for (const auto& TypeIT : CollidersByType)
+  {
+    const auto Type = TypeIT.Key;
+    const bool bTypeAllowed = (Type != EIsdkGrabColliderType::Palm || bAllowPalmGrab) &&
+        (Type != EIsdkGrabColliderType::Pinch || bAllowPinchGrab);
+
+    GetCollidersByType(Type, QueryColliders);
+    for (UPrimitiveComponent* Collider : QueryColliders)
+    {
+      FIsdkColliderInfo Info;
+      if (!GetColliderInfo(Collider, Type, Info))
+      {
+        continue;
+      }
+
+      // Broadphase against the spatial hash, then an exact test of the collider shape against
+      // each candidate's grab collider
+      QueryCandidates.Reset();
+      if (bTypeAllowed && IsValid(Collider) && Collider->IsCollisionEnabled())
+      {
+        WorldSubsystem->QueryGrabbableColliders(Collider->Bounds.GetBox(), QueryCandidates);
+
+        const FVector Location = Collider->GetComponentLocation();
+        const FQuat Rotation = Collider->GetComponentQuat();
+        const FCollisionShape Shape = Collider->GetCollisionShape();
+        QueryCandidates.RemoveAllSwap(
+            [Type, &Location, &Rotation, &Shape](
+                const TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>& Candidate)
+            {
+              return !Candidate.Value->AllowsGrabType(Type) ||
+                  !Candidate.Key->OverlapComponent(Location, Rotation, Shape);
+            });
+      }
+
+      // Only hovers that ended or started since the last frame produce events
+      QueryEndedHovers.Reset();
+      for (const TTuple<UPrimitiveComponent*, UIsdkGrabbableComponent*>& HoverObject :
+           Info.HoverObjects)
+      {
+        const bool bStillHovered = QueryCandidates.ContainsByPredicate(
+            [&HoverObject](const TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>& Candidate)
+            { return Candidate.Key == HoverObject.Key; });
+        if (!bStillHovered)
+        {
+          QueryEndedHovers.Add(HoverObject.Key);
+        }
+      }
+      for (UPrimitiveComponent* OtherComp : QueryEndedHovers)
+      {
+        RemoveHoverObject(Collider, Type, OtherComp);
+      }
+      for (const TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>& Candidate :
+           QueryCandidates)
+      {
+        if (!Info.HoverObjects.Contains(Candidate.Key))
+        {
+          AddHoverObject(Collider, Type, Candidate.Key, Candidate.Value);
+        }
+      }
+    }
+  }
 }
 
-void UIsdkGrabberComponent::UpdateOverlappedSet()
+void UIsdkGrabberComponent::UpdateOverlappedSet(UIsdkGrabbableComponent* Grabbable)
 {
-  OverlappedGrabbables.Empty();
+  if (Grabbable == nullptr)
+  {
+    return;
+  }
+
+  if (IsValid(Grabbable) && IsTrackedByAnyCollider(Grabbable))
+  {
+    OverlappedGrabbables.Add(Grabbable);
+  }
+  else
+  {
+    OverlappedGrabbables.Remove(Grabbable);
+  }
+}
 
+bool UIsdkGrabberComponent::IsTrackedByAnyCollider(const UIsdkGrabbableComponent* Grabbable) const
+{
   for (const TTuple<EIsdkGrabColliderType, PrimitiveComponentToColliderInfoMap>&
            ColliderTypeInfoMapPair : CollidersByType)
   {
     for (const TTuple<UPrimitiveComponent*, FIsdkColliderInfo>& ColliderEntry :
          ColliderTypeInfoMapPair.Value)
     {
+      if (ColliderEntry.Value.SelectObject == Grabbable)
+      {
+        return true;
+      }
       for (const TTuple<UPrimitiveComponent*, UIsdkGrabbableComponent*>& HoverObject :
            ColliderEntry.Value.HoverObjects)
       {
-        UIsdkGrabbableComponent* HoveredGrabbable = HoverObject.Value;
-        if (IsValid(HoveredGrabbable))
+        if (HoverObject.Value == Grabbable)
         {
-          OverlappedGrabbables.FindOrAdd(HoveredGrabbable);
+          return true;
         }
       }
-      if (IsValid(ColliderEntry.Value.SelectObject))
-      {
-        OverlappedGrabbables.FindOrAdd(ColliderEntry.Value.SelectObject);
-      }
     }
   }
+  return false;
 }
 
 void UIsdkGrabberComponent::UpdateState()
@@ -547,6 +677,11 @@ void UIsdkGrabberComponent::TickComponent(
 {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+  if (bQueryHoverCandidates)
+  {
+    UpdateQueriedHoverCandidates();
+  }
+
   if (isdk::CVar_Meta_InteractionSDK_DebugInteractionVisuals.GetValueOnAnyThread())
   {
     DrawDebugVisuals();
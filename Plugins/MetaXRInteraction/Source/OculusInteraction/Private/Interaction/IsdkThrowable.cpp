@@ -27,25 +27,40 @@ UIsdkThrowable::UIsdkThrowable()
   PrimaryComponentTick.bCanEverTick = true;
 }
 
-void UIsdkThrowable::SetSamplePositions(TArray<TPair<FVector, float>>& Positions)
+void UIsdkThrowable::SetSamplePositions(const TArray<TPair<FVector, float>>& Positions)
 {
-  LastNPositions = Positions;
+  PositionSamples.Reset(GetSampleCapacity());
+  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  {
+    // Zero positions stand for samples that were never tracked
+    if (PositionTimestampPair.Key != FVector::ZeroVector)
+    {
+      PositionSamples.Push(FVector4(PositionTimestampPair.Key, PositionTimestampPair.Value));
+    }
+  }
+}
+
+void UIsdkThrowable::SetSampleRotations(const TArray<TPair<FQuat, float>>& Rotations)
+{
+  RotationSamples.Reset(GetSampleCapacity());
+  for (const TPair<FQuat, float>& RotationTimestampPair : Rotations)
+  {
+    RotationSamples.Push(
+        TPair<FQuat, double>(RotationTimestampPair.Key, RotationTimestampPair.Value));
+  }
 }
 
-void UIsdkThrowable::SetSampleRotations(TArray<TPair<FQuat, float>>& Rotations)
+int32 UIsdkThrowable::GetSampleCapacity() const
 {
-  LastNRotations = Rotations;
+  return FMath::Max(Settings.SampleSize, 1);
 }
 
 void UIsdkThrowable::BeginPlay()
 {
   Super::BeginPlay();
   IsFirstFrame = true;
-  LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Settings.SampleSize);
-  LastNRotations.Init(TPair<FQuat, float>(FQuat::Identity, 0.0f), Settings.SampleSize);
-  CurrentPositionIndex = 0;
-  CurrentRotationIndex = 0;
-  PreviousPositionIndex = 0;
+  PositionSamples.Reset(GetSampleCapacity());
+  RotationSamples.Reset(GetSampleCapacity());
 
   ResetKalmanFilter();
 
@@ -76,114 +91,100 @@ void UIsdkThrowable::TickComponent(
     ProcessKalmanFilter();
   }
 
-  // Store the current position and timestamp
-  LastNPositions[CurrentPositionIndex] =
-      TPair<FVector, float>(TrackedComponent->GetComponentLocation(), GetWorld()->GetTimeSeconds());
-  PreviousPositionIndex = CurrentPositionIndex;
-  CurrentPositionIndex = (CurrentPositionIndex + 1) % Settings.SampleSize;
-  LastNRotations[CurrentRotationIndex] =
-      TPair<FQuat, float>(TrackedComponent->GetComponentQuat(), GetWorld()->GetTimeSeconds());
-  CurrentRotationIndex = (CurrentRotationIndex + 1) % Settings.SampleSize;
-}
-
-void UIsdkThrowable::GetLastNPositions(int32 N, TArray<TPair<FVector, float>>& OutPositions)
-{
-  OutPositions.Empty();
-
-  for (int32 i = 0; i < N; i++)
+  // The sample size may have been changed through the settings since the buffers were allocated
+  if (PositionSamples.GetCapacity() != GetSampleCapacity())
   {
-    const int32 Index = (CurrentPositionIndex - i - 1 + Settings.SampleSize) % Settings.SampleSize;
-    TPair<FVector, float> PositionTimestampPair = LastNPositions[Index];
-
-    // Add initialized positions only
-    if (PositionTimestampPair.Key != FVector::ZeroVector)
-    {
-      OutPositions.Insert(PositionTimestampPair, 0);
-    }
+    PositionSamples.Reset(GetSampleCapacity());
+    RotationSamples.Reset(GetSampleCapacity());
   }
+
+  // Store the current position, rotation and timestamp
+  const double Time = GetWorld()->GetTimeSeconds();
+  PositionSamples.Push(FVector4(TrackedComponent->GetComponentLocation(), Time));
+  RotationSamples.Push(TPair<FQuat, double>(TrackedComponent->GetComponentQuat(), Time));
 }
 
 FVector UIsdkThrowable::GetVelocity()
 {
-  TArray<TPair<FVector, float>> Positions;
-  GetLastNPositions(LastNPositions.Num(), Positions);
-
-  int32 numPositions = Positions.Num();
-
   // Check if there are enough tracked positions
-  if (numPositions <= 1)
+  if (PositionSamples.Num() <= 1)
   {
     return FVector::ZeroVector;
   }
 
-  TArray<FVector> PositionValues;
-  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
-  {
-    PositionValues.Add(PositionTimestampPair.Key);
-  }
-
-  const FVector Mean = FIsdkMathUtils::GetMean(PositionValues);
-  const FVector StandardDeviation = FIsdkMathUtils::GetStandardDeviation(PositionValues, Mean);
-
-  // Filter out positions that are more than a certain number of standard deviations away from the
-  // mean
-  TArray<TPair<FVector, float>> FilteredPositions;
-  FilteredPositions.Reserve(numPositions);
-
-  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
-  {
-    FVector Position = PositionTimestampPair.Key;
-    FVector ZScore = (Position - Mean) / StandardDeviation;
-    if (ZScore.GetMax() <= Settings.Z_Score_Threshold)
-    {
-      FilteredPositions.Add(PositionTimestampPair);
-    }
-  }
-
-  LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Settings.SampleSize);
+  TConstArrayView<FVector4> OlderSamples;
+  TConstArrayView<FVector4> NewerSamples;
+  PositionSamples.GetSpans(OlderSamples, NewerSamples);
 
+  // Positions that are more than a certain number of standard deviations away from the mean are
+  // filtered out as part of the fit
+  FVector Velocity = FVector::ZeroVector;
   switch (Settings.VelocityEstimationMethod)
   {
     case EIsdkVelocityEstimationMethod::VE_LeastSquares:
-      return FIsdkMathUtils::LeastSquares(FilteredPositions)
-          .GetClampedToSize(MinVelocity, MaxVelocity);
+      Velocity = FIsdkMathUtils::FilteredLeastSquares(
+                     OlderSamples, NewerSamples, Settings.Z_Score_Threshold)
+                     .GetClampedToSize(MinVelocity, MaxVelocity);
+      break;
     case EIsdkVelocityEstimationMethod::VE_RANSAC:
-      return FIsdkMathUtils::Ransac(FilteredPositions, Ransac_Iterations, Ransac_Score_Threshold);
+      RansacPositions.Reset();
+      FIsdkMathUtils::FilteredLeastSquares(
+          OlderSamples, NewerSamples, Settings.Z_Score_Threshold, &RansacPositions);
+      if (RansacPositions.Num() > 0)
+      {
+        Velocity =
+            FIsdkMathUtils::Ransac(RansacPositions, Ransac_Iterations, Ransac_Score_Threshold);
+      }
+      break;
     case EIsdkVelocityEstimationMethod::VE_KalmanFilter:
-      return KalmanParams.V;
+      Velocity = KalmanParams.V;
+      break;
     default:
-      return FVector::ZeroVector;
+      break;
   }
+
+  PositionSamples.Clear();
+  return Velocity;
 }
 
 FQuat UIsdkThrowable::GetAngularVelocity()
 {
   FVector SumAngularVelocity = FVector::ZeroVector;
-  for (int i = 0; i < LastNRotations.Num() - 1; i++)
+  int32 NumIntervals = 0;
+  for (int32 i = 0; i + 1 < RotationSamples.Num(); i++)
   {
-    const FQuat CurrentRotation = LastNRotations[i].Key;
-    const FQuat NextRotation = LastNRotations[i + 1].Key;
-    const FQuat RotationDifference = FQuat::Slerp(
-        CurrentRotation,
-        NextRotation,
-        (LastNRotations[i + 1].Value - LastNRotations[i].Value) / Settings.SampleSize);
+    const TPair<FQuat, double>& Current = RotationSamples[i];
+    const TPair<FQuat, double>& Next = RotationSamples[i + 1];
+    const double TimeDelta = Next.Value - Current.Value;
+    if (FMath::IsNearlyZero(TimeDelta))
+    {
+      continue;
+    }
+
+    const FQuat RotationDifference =
+        FQuat::Slerp(Current.Key, Next.Key, TimeDelta / Settings.SampleSize);
     FVector Axis;
     float Angle;
     RotationDifference.ToAxisAndAngle(Axis, Angle);
     Angle = FMath::Fmod(Angle, 2 * PI);
-    const FVector AngularVelocity =
-        Axis * Angle / (LastNRotations[i + 1].Value - LastNRotations[i].Value);
-    SumAngularVelocity += AngularVelocity;
+    SumAngularVelocity += Axis * Angle / TimeDelta;
+    NumIntervals++;
   }
 
-  LastNRotations.Init(TPair<FQuat, float>(FQuat::Identity, 0.0f), Settings.SampleSize);
+  RotationSamples.Clear();
+
+  if (NumIntervals == 0)
+  {
+    return FQuat::Identity;
+  }
 
-  const FVector AverageAngularVelocity = SumAngularVelocity / (LastNRotations.Num() - 1);
-  FMath::Clamp(AverageAngularVelocity.X, -MaxAngularSpeed, MaxAngularSpeed);
-  FMath::Clamp(AverageAngularVelocity.Y, -MaxAngularSpeed, MaxAngularSpeed);
-  FMath::Clamp(AverageAngularVelocity.Z, -MaxAngularSpeed, MaxAngularSpeed);
+  const FVector AverageAngularVelocity = SumAngularVelocity / NumIntervals;
+  const FVector ClampedAngularVelocity(
+      FMath::Clamp<double>(AverageAngularVelocity.X, -MaxAngularSpeed, MaxAngularSpeed),
+      FMath::Clamp<double>(AverageAngularVelocity.Y, -MaxAngularSpeed, MaxAngularSpeed),
+      FMath::Clamp<double>(AverageAngularVelocity.Z, -MaxAngularSpeed, MaxAngularSpeed));
   const FQuat AverageAngularVelocityQuat =
-      FQuat::MakeFromEuler(AverageAngularVelocity * Settings.AngularVelocityScale);
+      FQuat::MakeFromEuler(ClampedAngularVelocity * Settings.AngularVelocityScale);
   return AverageAngularVelocityQuat;
 }
 
@@ -228,15 +229,15 @@ bool UIsdkThrowable::CheckPositionConstraints()
 {
   if (!IsFirstFrame)
   {
-    if (LastNPositions[PreviousPositionIndex].Key != FVector::ZeroVector)
+    if (!PositionSamples.IsEmpty())
     {
       // Check for erratic movement and lack of movement
       if (auto Distance = FVector::Dist(
-              LastNPositions[PreviousPositionIndex].Key, TrackedComponent->GetComponentLocation());
+              FVector(PositionSamples.Last()), TrackedComponent->GetComponentLocation());
           Distance < MinPositionThreshold || Distance > MaxPositionThreshold)
       {
         ResetKalmanFilter();
-        LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Settings.SampleSize);
+        PositionSamples.Clear();
 
         return false;
       }
@@ -94,6 +94,27 @@ void UIsdkHandData::ReadJoints(isdk_HandData& HandData)
   }
 }
 
+void UIsdkHandData::PublishSnapshot()
+{
+  const bool bChanged = SnapshotFrameCounter == 0 ||
+      PublishedJointPoses.Num() != JointPoses.Num() ||
+      PublishedJointRadii.Num() != JointRadii.Num() ||
+      FMemory::Memcmp(
+          PublishedJointPoses.GetData(),
+          JointPoses.GetData(),
+          JointPoses.Num() * sizeof(FTransform)) != 0 ||
+      FMemory::Memcmp(
+          PublishedJointRadii.GetData(),
+          JointRadii.GetData(),
+          JointRadii.Num() * sizeof(float)) != 0;
+  if (bChanged)
+  {
+    PublishedJointPoses = JointPoses;
+    PublishedJointRadii = JointRadii;
+    ++SnapshotFrameCounter;
+  }
+}
+
 void UIsdkHandData::SetJointsToIdentity()
 {
   const auto DestJointCount = GetNumJoints();
@@ -196,6 +196,9 @@ UObject* UIsdkHandMeshComponent::GetSkeletalMesh() const
 
 void UIsdkHandMeshComponent::InitializeSkeleton()
 {
+  BoneJointIndices.Reset();
+  AppliedSnapshotFrame = 0;
+
   // map bones to indices for quicker lookup
   for (int BoneNameIndex = 0; BoneNameIndex < static_cast<int>(EIsdkHandBones::EHandBones_MAX);
        ++BoneNameIndex)
@@ -213,6 +216,13 @@ void UIsdkHandMeshComponent::InitializeSkeleton()
     }
     MappedBoneIndices[BoneNameIndex] = BoneIndex;
   }
+
+  // Reverse lookup so that UpdateSkeleton can walk the skeleton once in parent before child order
+  BoneJointIndices.Init(INDEX_NONE, GetNumBones());
+  for (int JointIndex = 0; JointIndex < static_cast<int>(MappedBoneCount); ++JointIndex)
+  {
+    BoneJointIndices[MappedBoneIndices[JointIndex]] = JointIndex;
+  }
   SetValidMappingState(GetSkeletalMesh());
 }
 
@@ -275,10 +285,13 @@ void UIsdkHandMeshComponent::TickComponent(
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
   UpdateChildTransforms();
 
-  // Only update the native instance if it exists.
+  // Only update the native instance if it exists, and only if the hand moved or changed its pose.
   if (ExternalHandPositionFrameImpl->IsInstanceValid() &&
-      MappingState == EIsdkSkeletonMappingState::Valid)
+      MappingState == EIsdkSkeletonMappingState::Valid &&
+      (ApiFramePoseRevision != PoseRevision || ApiFrameWristLocation != GetComponentLocation()))
   {
+    ApiFramePoseRevision = PoseRevision;
+    ApiFrameWristLocation = GetComponentLocation();
     UpdateApiHandPositionFrame(ExternalHandPositionFrameImpl->GetInstanceChecked());
   }
 
@@ -340,6 +353,8 @@ void UIsdkHandMeshComponent::ResetAllBoneTransforms()
     return;
   }
   BoneSpaceTransforms = SkinnedMesh->GetRefSkeleton().GetRefBonePose();
+  AppliedSnapshotFrame = 0;
+  ++PoseRevision;
   MarkRefreshTransformDirty();
 }
 
@@ -402,46 +417,38 @@ void UIsdkHandMeshComponent::UpdateSkeleton()
 
   if (IsValid(HandDataSource))
   {
-    TArray<FTransform>& SourcePoses = HandDataSource->GetJointPoses();
+    const FIsdkHandJointsSnapshot Snapshot = HandDataSource->GetSnapshot();
+    // Data sources that never publish are read directly
+    TConstArrayView<FTransform> SourcePoses = Snapshot.FrameCounter != 0
+        ? Snapshot.JointPoses
+        : TConstArrayView<FTransform>(HandDataSource->GetJointPoses());
+    const TArray<FTransform>* OverridePoses = nullptr;
     const bool bHandPoseOverrideValid = bHandPoseOverridden && IsValid(HandDataOverride);
-    TArray<FTransform> OverridePoses = {};
 
     // Check if we're overriding the pose
     if (bHandPoseOverrideValid)
     {
-      OverridePoses = HandDataOverride->GetJointPoses();
+      OverridePoses = &HandDataOverride->GetJointPoses();
       // If we're not lerping, use the override pose array
       if (HandPoseLerpState == EIsdkLerpState::Inactive)
       {
-        SourcePoses = HandDataOverride->GetJointPoses();
+        SourcePoses = *OverridePoses;
       }
     }
-
-    constexpr auto WristSpace = EBoneSpaces::Type::ComponentSpace;
-    const int BoneCount = UIsdkHandData::GetNumJoints();
-    for (int BoneId = 0; BoneId < BoneCount; BoneId++)
+    else if (
+        Snapshot.FrameCounter != 0 && Snapshot.FrameCounter == AppliedSnapshotFrame &&
+        HandPoseLerpState == EIsdkLerpState::Inactive)
     {
-      const FName BoneName = MappedBoneNames[BoneId];
-
-      FTransform BoneTransform = GetBoneTransformByName(BoneName, WristSpace);
-      if ((uint8)HandPoseLerpState > 0)
-      {
-        BoneTransform.SetLocation(FMath::Lerp(
-            SourcePoses[BoneId].GetLocation(),
-            OverridePoses[BoneId].GetLocation(),
-            HandPoseLerpAlpha));
-        BoneTransform.SetRotation(FMath::Lerp(
-            SourcePoses[BoneId].GetRotation(),
-            OverridePoses[BoneId].GetRotation(),
-            HandPoseLerpAlpha));
-      }
-      else
-      {
-        BoneTransform.SetLocation(SourcePoses[BoneId].GetLocation());
-        BoneTransform.SetRotation(SourcePoses[BoneId].GetRotation());
-      }
+      // The bone transforms already show this snapshot
+      return;
+    }
 
-      SetBoneTransformByName(BoneName, BoneTransform, WristSpace);
+    const bool bLerping = (uint8)HandPoseLerpState > 0 && OverridePoses;
+    // Only a pose that made it into the bone transforms may be skipped next frame
+    if (ApplyJointPoses(SourcePoses, bLerping ? OverridePoses : nullptr, HandPoseLerpAlpha))
+    {
+      AppliedSnapshotFrame = bHandPoseOverrideValid ? 0 : Snapshot.FrameCounter;
+      ++PoseRevision;
     }
 
     // Check if we're done lerping in
@@ -462,6 +469,59 @@ void UIsdkHandMeshComponent::UpdateSkeleton()
   }
 }
 
+bool UIsdkHandMeshComponent::ApplyJointPoses(
+    TConstArrayView<FTransform> JointPoses,
+    const TArray<FTransform>* LerpTargetPoses,
+    float LerpAlpha)
+{
+  const UObject* SkinnedMesh = GetSkeletalMesh();
+  const int32 BoneCount = BoneSpaceTransforms.Num();
+  if (!IsValid(SkinnedMesh) || !RequiredBones.IsValid() || BoneJointIndices.Num() != BoneCount ||
+      JointPoses.Num() < UIsdkHandData::GetNumJoints() ||
+      (LerpTargetPoses && LerpTargetPoses->Num() < UIsdkHandData::GetNumJoints()))
+  {
+    return false;
+  }
+
+  // Bones are sorted so that parents always come before their children. That way the component
+  // space transform of the parent is final by the time a bone is converted back to bone space,
+  // which replaces the per joint name lookups and component space pose rebuilds of
+  // SetBoneTransformByName.
+  ComponentSpaceScratch.SetNumUninitialized(BoneCount, false);
+  for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+  {
+    const int32 ParentIndex = RequiredBones.GetParentBoneIndex(BoneIndex);
+    const FTransform& ParentTransform =
+        ParentIndex == INDEX_NONE ? FTransform::Identity : ComponentSpaceScratch[ParentIndex];
+    FTransform& BoneTransform = ComponentSpaceScratch[BoneIndex];
+    BoneTransform = BoneSpaceTransforms[BoneIndex] * ParentTransform;
+
+    const int32 JointIndex = BoneJointIndices[BoneIndex];
+    if (JointIndex == INDEX_NONE)
+    {
+      continue;
+    }
+
+    // Only location and rotation are driven by the joints, the scale of the bone is kept
+    const FTransform& JointPose = JointPoses[JointIndex];
+    if (LerpTargetPoses)
+    {
+      const FTransform& TargetPose = (*LerpTargetPoses)[JointIndex];
+      BoneTransform.SetLocation(
+          FMath::Lerp(JointPose.GetLocation(), TargetPose.GetLocation(), LerpAlpha));
+      BoneTransform.SetRotation(
+          FMath::Lerp(JointPose.GetRotation(), TargetPose.GetRotation(), LerpAlpha));
+    }
+    else
+    {
+      BoneTransform.SetLocation(JointPose.GetLocation());
+      BoneTransform.SetRotation(JointPose.GetRotation());
+    }
+    BoneSpaceTransforms[BoneIndex] = BoneTransform.GetRelativeTransform(ParentTransform);
+  }
+  return true;
+}
+
 void UIsdkHandMeshComponent::UpdateApiHandPositionFrame(
     ExternalHandPositionFrame& ApiHandPositionFrame) const
 {
@@ -472,12 +532,27 @@ void UIsdkHandMeshComponent::UpdateApiHandPositionFrame(
   // Set Joint Positions
   auto& ApiJointLocations = ExternalHandPositionFrameImpl->WristSpaceJointLocations;
 
-  FA2CSPose CSPose;
-  CSPose.AllocateLocalPoses(RequiredBones, GetBoneSpaceTransforms());
+  // Build the component space pose in a single pass into a persistent buffer, instead of
+  // allocating local poses every update
+  const TArray<FTransform>& LocalTransforms = GetBoneSpaceTransforms();
+  const int32 BoneCount = LocalTransforms.Num();
+  ApiComponentSpaceScratch.SetNumUninitialized(BoneCount, false);
+  for (int32 BoneIndex = 0; BoneIndex < BoneCount; ++BoneIndex)
+  {
+    const int32 ParentIndex = RequiredBones.GetParentBoneIndex(BoneIndex);
+    ApiComponentSpaceScratch[BoneIndex] = ParentIndex == INDEX_NONE
+        ? LocalTransforms[BoneIndex]
+        : LocalTransforms[BoneIndex] * ApiComponentSpaceScratch[ParentIndex];
+  }
+
   for (int BoneId = 0; BoneId < MappedBoneCount; ++BoneId)
   {
     const int BoneIndex = MappedBoneIndices[BoneId];
-    const auto WristSpaceTransform = CSPose.GetComponentSpaceTransform(BoneIndex);
+    if (!ApiComponentSpaceScratch.IsValidIndex(BoneIndex))
+    {
+      continue;
+    }
+    const auto& WristSpaceTransform = ApiComponentSpaceScratch[BoneIndex];
 
     ApiJointLocations[BoneId] = StructTypesUtils::Convert(WristSpaceTransform.GetLocation());
   }
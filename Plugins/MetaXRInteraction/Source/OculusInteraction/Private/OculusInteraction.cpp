@@ -21,6 +21,7 @@
 #include "OculusInteraction.h"
 
 #include "OculusInteractionLog.h"
+#include "OculusInteractionStats.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
@@ -35,6 +36,7 @@
 #define LOCTEXT_NAMESPACE "FOculusInteractionModule"
 
 DEFINE_LOG_CATEGORY(LogOculusInteraction);
+DEFINE_STAT(STAT_IsdkInteractableComponentTicks);
 
 namespace isdk
 {
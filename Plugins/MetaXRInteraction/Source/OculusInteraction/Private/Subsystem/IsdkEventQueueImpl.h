@@ -27,6 +27,8 @@
 #include "Interaction/IsdkInteractableComponent.h"
 #include "Interaction/IsdkInteractorComponent.h"
 #include "OculusInteractionLog.h"
+#include "Containers/RingBuffer.h"
+#include "Misc/TVariant.h"
 
 namespace isdk::api::helper
 {
@@ -44,12 +46,94 @@ inline auto CreatePointerEventConverter(
   };
 }
 
+// Any of the native events that can be read from the event queues below
+using FQueuedApiEvent =
+    TVariant<isdk_PointerEvent, isdk_InteractableStateChangeArgs, isdk_InteractorStateChangeArgs>;
+
+class FWorldEventBuffer;
+
 class IEventQueueWrapper
 {
  public:
   virtual ~IEventQueueWrapper() = default;
   virtual void TryHandleEvents() = 0;
   virtual void CreateInstanceIfNotExists() = 0;
+
+  /**
+   * Moves all pending native events of this queue into the given buffer. Queues without pending
+   * events are not added to the buffer at all.
+   * Returns the number of events that were moved.
+   */
+  virtual int32 CollectEvents(FWorldEventBuffer& Buffer) = 0;
+
+  /**
+   * Converts a native event that was previously collected from this queue and broadcasts it.
+   */
+  virtual void DispatchEvent(const FQueuedApiEvent& ApiEvent) = 0;
+};
+
+/**
+ * Single ring buffer that holds the pending native events of all event queues of a world.
+ * Queues append their events in bulk via IEventQueueWrapper::CollectEvents, each event tagged with
+ * a handle of the queue it came from. Dispatch then fans the events out to their queues in the
+ * order they were collected. The storage is kept between frames so that steady state ticks don't
+ * allocate.
+ */
+class FWorldEventBuffer
+{
+ public:
+  using FSubscriberHandle = int32;
+
+  FSubscriberHandle AddSubscriber(IEventQueueWrapper* Subscriber)
+  {
+    return Subscribers.Add(Subscriber);
+  }
+
+  template <typename TApiEvent>
+  void Push(const FSubscriberHandle Handle, const TApiEvent& ApiEvent)
+  {
+    FQueuedEvent& QueuedEvent = Events.Emplace_GetRef();
+    QueuedEvent.Handle = Handle;
+    QueuedEvent.ApiEvent.Set<TApiEvent>(ApiEvent);
+  }
+
+  /**
+   * Broadcasts all collected events and empties the buffer.
+   * Returns the number of events that were dispatched.
+   */
+  int32 Dispatch()
+  {
+    int32 NumDispatched = 0;
+    while (!Events.IsEmpty())
+    {
+      const FQueuedEvent QueuedEvent = Events.PopFrontValue();
+      Subscribers[QueuedEvent.Handle]->DispatchEvent(QueuedEvent.ApiEvent);
+      ++NumDispatched;
+    }
+    Subscribers.Reset();
+    return NumDispatched;
+  }
+
+  int32 Num() const
+  {
+    return Events.Num();
+  }
+
+  void Reset()
+  {
+    Events.Reset();
+    Subscribers.Reset();
+  }
+
+ private:
+  struct FQueuedEvent
+  {
+    FSubscriberHandle Handle{};
+    FQueuedApiEvent ApiEvent{};
+  };
+
+  TRingBuffer<FQueuedEvent> Events{};
+  TArray<IEventQueueWrapper*> Subscribers{};
 };
 
 template <
@@ -121,17 +205,7 @@ class FEventQueueApiImpl : public FApiImpl<TQueueApiType, TQueueApiTypePtr>,
     }
     else
     {
-      // If no listeners, just clear out the pointer events
-      auto EventCount = EventQueue->getCount();
-      if (EventCount > 0)
-      {
-        UE_LOG(
-            LogOculusInteraction,
-            VeryVerbose,
-            TEXT("Ignoring %d events, there are no subscribers"),
-            EventCount);
-        EventQueue->clear();
-      }
+      ClearIgnoredEvents(EventQueue, EventQueue->getCount());
     }
   }
 
@@ -140,7 +214,60 @@ class FEventQueueApiImpl : public FApiImpl<TQueueApiType, TQueueApiTypePtr>,
     static_cast<TBase*>(this)->GetOrCreateInstance();
   }
 
+  virtual int32 CollectEvents(FWorldEventBuffer& Buffer) override
+  {
+    const auto EventQueue = static_cast<TBase*>(this)->GetOrCreateInstance();
+    if (!EventQueue)
+    {
+      return 0;
+    }
+
+    // Most queues are idle on any given frame, a single native call is enough to skip them
+    const auto EventCount = EventQueue->getCount();
+    if (EventCount == 0)
+    {
+      return 0;
+    }
+
+    if (!ForwardingDelegate.IsBound())
+    {
+      ClearIgnoredEvents(EventQueue, EventCount);
+      return 0;
+    }
+
+    const FWorldEventBuffer::FSubscriberHandle Handle = Buffer.AddSubscriber(this);
+    for (auto EventIndex = EventCount; EventIndex > 0; --EventIndex)
+    {
+      Buffer.Push(Handle, EventQueue->pop());
+    }
+    return static_cast<int32>(EventCount);
+  }
+
+  virtual void DispatchEvent(const FQueuedApiEvent& ApiEvent) override
+  {
+    // The delegate may have been unbound by an earlier event of the same frame
+    if (ForwardingDelegate.IsBound())
+    {
+      TForwardingDelegateArg0 Event = CreateEvent(ApiEvent.Get<TQueueApiEventType>());
+      ForwardingDelegate.Broadcast(Event);
+    }
+  }
+
  private:
+  static void ClearIgnoredEvents(TQueueApiType* EventQueue, const unsigned long long EventCount)
+  {
+    // If no listeners, just clear out the events
+    if (EventCount > 0)
+    {
+      UE_LOG(
+          LogOculusInteraction,
+          VeryVerbose,
+          TEXT("Ignoring %llu events, there are no subscribers"),
+          EventCount);
+      EventQueue->clear();
+    }
+  }
+
   const TForwardingDelegate& ForwardingDelegate;
   CreateEventFn CreateEvent;
 };
@@ -19,11 +19,30 @@
  */
 
 #include "Subsystem/IsdkWorldSubsystem.h"
+#include "Interaction/IsdkGrabbableComponent.h"
 #include "Interaction/IsdkInteractorComponent.h"
 
 #include "IsdkEventQueueImpl.h"
+#include "OculusInteractionStats.h"
 #include "StructTypesPrivate.h"
 
+DECLARE_CYCLE_STAT(
+    TEXT("World Subsystem Tick"),
+    STAT_IsdkWorldSubsystemTick,
+    STATGROUP_OculusInteraction);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Event Queues Polled"),
+    STAT_IsdkEventQueuesPolled,
+    STATGROUP_OculusInteraction);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Events Dispatched"),
+    STAT_IsdkEventsDispatched,
+    STATGROUP_OculusInteraction);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Grabbable Spatial Hash Updates"),
+    STAT_IsdkGrabbableSpatialHashUpdates,
+    STATGROUP_OculusInteraction);
+
 namespace isdk::api
 {
 class FIsdkScaledTimeProviderImpl : public FApiImpl<ScaledTimeProvider, ScaledTimeProviderPtr>
@@ -40,6 +59,7 @@ UIsdkWorldSubsystem::UIsdkWorldSubsystem()
 {
   IsdkScaledTimeProviderImpl = MakePimpl<isdk::api::FIsdkScaledTimeProviderImpl>(
       [] { return isdk::api::ScaledTimeProvider::create(); });
+  WorldEventBuffer = MakePimpl<isdk::api::helper::FWorldEventBuffer>();
 }
 
 void UIsdkWorldSubsystem::BeginDestroy()
@@ -61,10 +81,19 @@ void UIsdkWorldSubsystem::Deinitialize()
   InteractableStateEventSubscriptions.Reset();
   InteractorStateEventSubscriptions.Reset();
   UpdateEventSubscriptions.Reset();
+  WorldEventBuffer->Reset();
+
+  TArray<int32> SpatialGrabbableIdsToRemove;
+  SpatialGrabbables.GetKeys(SpatialGrabbableIdsToRemove);
+  for (const int32 Id : SpatialGrabbableIdsToRemove)
+  {
+    RemoveSpatialGrabbable(Id);
+  }
 }
 
 void UIsdkWorldSubsystem::Tick(float DeltaTime)
 {
+  SCOPE_CYCLE_COUNTER(STAT_IsdkWorldSubsystemTick);
   Super::Tick(DeltaTime);
 
   // [BeginFrame]: Replicate ISDK world state
@@ -92,10 +121,20 @@ void UIsdkWorldSubsystem::Tick(float DeltaTime)
   // [BeginFrame]: Interactors will 'drive' inside the IUpdate event
   UpdateEventSubscriptions.TryHandleEvents();
 
-  // [PopEvent]: Read output events
-  PointerEventSubscriptions.TryHandleEvents();
-  InteractableStateEventSubscriptions.TryHandleEvents();
-  InteractorStateEventSubscriptions.TryHandleEvents();
+  // [PopEvent]: Read output events of all queues into the world event buffer, then fan them out.
+  // Events are dispatched in the order they were collected: pointer events first, then
+  // interactable and interactor state events. Events that are raised by native calls made from
+  // inside a callback are read on the next tick.
+  PointerEventSubscriptions.CollectEvents(*WorldEventBuffer);
+  InteractableStateEventSubscriptions.CollectEvents(*WorldEventBuffer);
+  InteractorStateEventSubscriptions.CollectEvents(*WorldEventBuffer);
+  const int32 NumDispatched = WorldEventBuffer->Dispatch();
+
+  INC_DWORD_STAT_BY(
+      STAT_IsdkEventQueuesPolled,
+      PointerEventSubscriptions.Num() + InteractableStateEventSubscriptions.Num() +
+          InteractorStateEventSubscriptions.Num() + UpdateEventSubscriptions.Num());
+  INC_DWORD_STAT_BY(STAT_IsdkEventsDispatched, NumDispatched);
 
   // [EndFrame]
   if (FrameFinishedEventDelegate.IsBound())
@@ -322,6 +361,102 @@ UIsdkInteractorComponent* UIsdkWorldSubsystem::LookupInteractorFromPayload(
   return nullptr;
 }
 
+void UIsdkWorldSubsystem::RegisterGrabbableCollider(
+    UIsdkGrabbableComponent* InGrabbable,
+    UPrimitiveComponent* InGrabCollider)
+{
+  if (!ensureMsgf(
+          IsValid(InGrabbable),
+          TEXT("UIsdkWorldSubsystem::RegisterGrabbableCollider - InGrabbable is null")))
+  {
+    return;
+  }
+
+  UnregisterGrabbableCollider(InGrabbable);
+  if (!IsValid(InGrabCollider))
+  {
+    return;
+  }
+
+  const int32 Id = GrabbableSpatialHash.Add(InGrabCollider->Bounds.GetBox());
+  FSpatialGrabbable& SpatialGrabbable = SpatialGrabbables.Add(Id);
+  SpatialGrabbable.Grabbable = InGrabbable;
+  SpatialGrabbable.GrabbableKey = InGrabbable;
+  SpatialGrabbable.GrabCollider = InGrabCollider;
+  SpatialGrabbable.TransformUpdatedHandle = InGrabCollider->TransformUpdated.AddWeakLambda(
+      this,
+      [this, Id](
+          USceneComponent* UpdatedComponent,
+          EUpdateTransformFlags UpdateTransformFlags,
+          ETeleportType Teleport) { MovedSpatialGrabbableIds.Add(Id); });
+  SpatialGrabbableIds.Add(InGrabbable, Id);
+}
+
+void UIsdkWorldSubsystem::UnregisterGrabbableCollider(UIsdkGrabbableComponent* InGrabbable)
+{
+  if (const int32* Id = SpatialGrabbableIds.Find(InGrabbable))
+  {
+    RemoveSpatialGrabbable(*Id);
+  }
+}
+
+void UIsdkWorldSubsystem::QueryGrabbableColliders(
+    const FBox& InBounds,
+    TArray<TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>>& OutCandidates)
+{
+  UpdateMovedSpatialGrabbables();
+
+  SpatialHashQueryIds.Reset();
+  GrabbableSpatialHash.Query(InBounds, SpatialHashQueryIds);
+  for (const int32 Id : SpatialHashQueryIds)
+  {
+    const FSpatialGrabbable& SpatialGrabbable = SpatialGrabbables.FindChecked(Id);
+    UPrimitiveComponent* GrabCollider = SpatialGrabbable.GrabCollider.Get();
+    UIsdkGrabbableComponent* Grabbable = SpatialGrabbable.Grabbable.Get();
+    if (IsValid(GrabCollider) && IsValid(Grabbable) &&
+        InBounds.Intersect(GrabCollider->Bounds.GetBox()))
+    {
+      OutCandidates.Emplace(GrabCollider, Grabbable);
+    }
+  }
+}
+
+void UIsdkWorldSubsystem::RemoveSpatialGrabbable(int32 Id)
+{
+  FSpatialGrabbable SpatialGrabbable;
+  if (!SpatialGrabbables.RemoveAndCopyValue(Id, SpatialGrabbable))
+  {
+    return;
+  }
+
+  if (UPrimitiveComponent* GrabCollider = SpatialGrabbable.GrabCollider.Get())
+  {
+    GrabCollider->TransformUpdated.Remove(SpatialGrabbable.TransformUpdatedHandle);
+  }
+  SpatialGrabbableIds.Remove(SpatialGrabbable.GrabbableKey);
+  MovedSpatialGrabbableIds.Remove(Id);
+  GrabbableSpatialHash.Remove(Id);
+}
+
+void UIsdkWorldSubsystem::UpdateMovedSpatialGrabbables()
+{
+  if (MovedSpatialGrabbableIds.Num() == 0)
+  {
+    return;
+  }
+
+  INC_DWORD_STAT_BY(STAT_IsdkGrabbableSpatialHashUpdates, MovedSpatialGrabbableIds.Num());
+  for (const int32 Id : MovedSpatialGrabbableIds)
+  {
+    const FSpatialGrabbable& SpatialGrabbable = SpatialGrabbables.FindChecked(Id);
+    if (const UPrimitiveComponent* GrabCollider = SpatialGrabbable.GrabCollider.Get())
+    {
+      GrabbableSpatialHash.Update(Id, GrabCollider->Bounds.GetBox());
+    }
+  }
+  MovedSpatialGrabbableIds.Reset();
+}
+
 isdk::api::ScaledTimeProvider* UIsdkWorldSubsystem::GetApiScaledTimeProvider() const
 {
   return IsdkScaledTimeProviderImpl->GetOrCreateInstance();
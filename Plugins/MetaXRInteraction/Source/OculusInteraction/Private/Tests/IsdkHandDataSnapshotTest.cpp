@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IsdkHandData.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkHandDataSnapshotTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkHandDataSnapshotTest.FrameCounter",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkHandDataSnapshotTest::RunTest(const FString& Parameters)
+{
+  UIsdkHandData* HandData = NewObject<UIsdkHandData>();
+
+  TestTrue(TEXT("Nothing published yet"), HandData->GetSnapshot().FrameCounter == 0);
+
+  HandData->PublishSnapshot();
+  const FIsdkHandJointsSnapshot First = HandData->GetSnapshot();
+  TestTrue(TEXT("First publish advances the frame counter"), First.FrameCounter == 1);
+  TestEqual(
+      TEXT("Snapshot covers all joints"), First.JointPoses.Num(), UIsdkHandData::GetNumJoints());
+  TestTrue(
+      TEXT("Snapshot is a copy of the joints of the hand data"),
+      First.JointPoses.GetData() != HandData->GetJointPoses().GetData());
+
+  HandData->PublishSnapshot();
+  TestTrue(
+      TEXT("Publishing unchanged joints keeps the frame counter"),
+      HandData->GetSnapshot().FrameCounter == First.FrameCounter);
+
+  HandData->GetJointPoses()[static_cast<int32>(EIsdkHandBones::HandIndexTip)].SetLocation(
+      FVector(1.0, 2.0, 3.0));
+  TestTrue(
+      TEXT("Snapshot doesn't change before the joints are published"),
+      HandData->GetSnapshot()
+          .JointPoses[static_cast<int32>(EIsdkHandBones::HandIndexTip)]
+          .GetLocation()
+          .IsZero());
+  HandData->PublishSnapshot();
+  TestTrue(
+      TEXT("Snapshot shows the published joints"),
+      HandData->GetSnapshot()
+          .JointPoses[static_cast<int32>(EIsdkHandBones::HandIndexTip)]
+          .GetLocation()
+          .Equals(FVector(1.0, 2.0, 3.0)));
+  TestTrue(
+      TEXT("Publishing changed joints advances the frame counter"),
+      HandData->GetSnapshot().FrameCounter == First.FrameCounter + 1);
+
+  HandData->GetJointRadii()[0] = 0.5f;
+  HandData->PublishSnapshot();
+  TestTrue(
+      TEXT("Publishing changed radii advances the frame counter"),
+      HandData->GetSnapshot().FrameCounter == First.FrameCounter + 2);
+
+  return true;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Utilities/IsdkRingBuffer.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkRingBufferTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkRingBufferTest.All",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkRingBufferTest::RunTest(const FString& Parameters)
+{
+  TIsdkRingBuffer<int32> RingBuffer;
+  TConstArrayView<int32> Older;
+  TConstArrayView<int32> Newer;
+
+  // Pushing without capacity is ignored
+  RingBuffer.Push(1);
+  TestTrue(TEXT("Empty without capacity"), RingBuffer.IsEmpty());
+
+  RingBuffer.Reset(3);
+  TestEqual(TEXT("Capacity"), RingBuffer.GetCapacity(), 3);
+  RingBuffer.Push(1);
+  RingBuffer.Push(2);
+  TestEqual(TEXT("Num before wrapping"), RingBuffer.Num(), 2);
+  RingBuffer.GetSpans(Older, Newer);
+  TestEqual(TEXT("Older span before wrapping"), Older.Num(), 2);
+  TestEqual(TEXT("Newer span before wrapping"), Newer.Num(), 0);
+
+  // Overwrites the oldest elements once full
+  RingBuffer.Push(3);
+  RingBuffer.Push(4);
+  RingBuffer.Push(5);
+  TestEqual(TEXT("Num after wrapping"), RingBuffer.Num(), 3);
+  TestEqual(TEXT("Oldest after wrapping"), RingBuffer[0], 3);
+  TestEqual(TEXT("Middle after wrapping"), RingBuffer[1], 4);
+  TestEqual(TEXT("Newest after wrapping"), RingBuffer.Last(), 5);
+
+  // The spans hold all elements in chronological order
+  RingBuffer.GetSpans(Older, Newer);
+  TArray<int32> Chronological(Older.GetData(), Older.Num());
+  Chronological.Append(Newer.GetData(), Newer.Num());
+  TestTrue(TEXT("Spans after wrapping"), Chronological == TArray<int32>({3, 4, 5}));
+
+  // Clearing keeps the allocation
+  RingBuffer.Clear();
+  TestTrue(TEXT("Empty after clear"), RingBuffer.IsEmpty());
+  TestEqual(TEXT("Capacity after clear"), RingBuffer.GetCapacity(), 3);
+  RingBuffer.Push(6);
+  TestEqual(TEXT("Newest after clear"), RingBuffer.Last(), 6);
+
+  return true;
+}
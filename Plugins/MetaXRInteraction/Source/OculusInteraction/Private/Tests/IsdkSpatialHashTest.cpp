@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Utilities/IsdkSpatialHash.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkSpatialHashTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkSpatialHashTest.All",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkSpatialHashTest::RunTest(const FString& Parameters)
+{
+  FIsdkSpatialHash SpatialHash(10.0);
+  TArray<int32> Ids;
+
+  const int32 Small = SpatialHash.Add(FBox(FVector(1, 1, 1), FVector(3, 3, 3)));
+  // Spans eight cells, but must only be reported once
+  const int32 Straddling = SpatialHash.Add(FBox(FVector(-2, -2, -2), FVector(2, 2, 2)));
+  // Covers more cells than are bucketed
+  const int32 Oversized = SpatialHash.Add(FBox(FVector(-500, -500, -500), FVector(500, 500, 500)));
+  TestEqual(TEXT("Num"), SpatialHash.Num(), 3);
+
+  SpatialHash.Query(FBox(FVector(0, 0, 0), FVector(5, 5, 5)), Ids);
+  TestEqual(TEXT("Query near origin"), Ids.Num(), 3);
+  TestTrue(TEXT("Query near origin finds small box"), Ids.Contains(Small));
+  TestTrue(TEXT("Query near origin finds straddling box"), Ids.Contains(Straddling));
+  TestTrue(TEXT("Query near origin finds oversized box"), Ids.Contains(Oversized));
+
+  Ids.Reset();
+  SpatialHash.Query(FBox(FVector(100, 100, 100), FVector(105, 105, 105)), Ids);
+  TestEqual(TEXT("Far query only finds oversized box"), Ids.Num(), 1);
+
+  // Moving a box takes it out of its old cells
+  SpatialHash.Update(Small, FBox(FVector(101, 101, 101), FVector(103, 103, 103)));
+  Ids.Reset();
+  SpatialHash.Query(FBox(FVector(100, 100, 100), FVector(105, 105, 105)), Ids);
+  TestTrue(TEXT("Moved box is found at its new position"), Ids.Contains(Small));
+  Ids.Reset();
+  SpatialHash.Query(FBox(FVector(1, 1, 1), FVector(3, 3, 3)), Ids);
+  TestFalse(TEXT("Moved box is gone from its old position"), Ids.Contains(Small));
+
+  SpatialHash.Remove(Straddling);
+  SpatialHash.Remove(Oversized);
+  Ids.Reset();
+  SpatialHash.Query(FBox(FVector(-5, -5, -5), FVector(5, 5, 5)), Ids);
+  TestEqual(TEXT("Removed boxes are not found"), Ids.Num(), 0);
+  TestEqual(TEXT("Num after removal"), SpatialHash.Num(), 1);
+
+  return true;
+}
@@ -117,6 +117,68 @@ bool FIsdkSubsystemEventQueueImplTest::RunTest(const FString& Parameters)
   return bPassed;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkSubsystemWorldEventBufferTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.Subsystem.WorldEventBuffer",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FIsdkSubsystemWorldEventBufferTest::RunTest(const FString& Parameters)
+{
+  UIsdkTestRayFixture* RayTest = NewObject<UIsdkTestRayFixture>();
+
+  isdk::api::helper::FInteractorStateEventQueueImpl InteractorStateEventQueue(
+      [&RayTest]() -> isdk::api::IInteractor* { return &RayTest->RayInteractor.Get(); },
+      &isdk::api::IInteractor::getIInteractorHandle,
+      isdk::api::helper::CreateInteractorStateEventConverter(RayTest),
+      TEXT("test"),
+      RayTest->InteractorStateChanged);
+  isdk::api::helper::FInteractableStateEventQueueImpl InteractableStateEventQueue(
+      [&RayTest]() -> isdk::api::IInteractable* { return &RayTest->RayInteractable.Get(); },
+      &isdk::api::IInteractable::getIInteractableHandle,
+      isdk::api::helper::CreateInteractableStateEventConverter(RayTest),
+      RayTest->InteractableStateChanged);
+  auto PayloadLookup = [](const isdk_IPayload*) -> UIsdkInteractorComponent* { return nullptr; };
+  isdk::api::helper::FPointerEventQueueImpl PointerEventQueue(
+      [&RayTest]() -> isdk::api::IPointable* { return &RayTest->RayInteractable.Get(); },
+      &isdk::api::IPointable::getIPointableHandle,
+      isdk::api::helper::CreatePointerEventConverter(RayTest->MockInteractable, PayloadLookup),
+      RayTest->InteractablePointed);
+
+  RayTest->SetUp();
+
+  InteractorStateEventQueue.GetOrCreateInstance();
+  InteractableStateEventQueue.GetOrCreateInstance();
+  PointerEventQueue.GetOrCreateInstance();
+
+  isdk::api::helper::FWorldEventBuffer WorldEventBuffer;
+
+  // Nothing happened yet, idle queues must not add anything to the buffer
+  int32 NumCollected = PointerEventQueue.CollectEvents(WorldEventBuffer) +
+      InteractableStateEventQueue.CollectEvents(WorldEventBuffer) +
+      InteractorStateEventQueue.CollectEvents(WorldEventBuffer);
+  bool bPassed = TestEqual(TEXT("Idle Collected Event Count"), NumCollected, 0) &&
+      TestEqual(TEXT("Idle Dispatched Event Count"), WorldEventBuffer.Dispatch(), 0);
+
+  // Invoke the interactor, then collect and fan out the events of all queues at once
+  RayTest->RayInteractor->drive();
+  NumCollected = PointerEventQueue.CollectEvents(WorldEventBuffer) +
+      InteractableStateEventQueue.CollectEvents(WorldEventBuffer) +
+      InteractorStateEventQueue.CollectEvents(WorldEventBuffer);
+  bPassed = bPassed && TestEqual(TEXT("Collected Event Count"), NumCollected, 4) &&
+      TestEqual(TEXT("Buffered Event Count"), WorldEventBuffer.Num(), 4) &&
+      TestEqual(TEXT("Dispatched Event Count"), WorldEventBuffer.Dispatch(), 4) &&
+      TestEqual(TEXT("Buffered Event Count After Dispatch"), WorldEventBuffer.Num(), 0);
+
+  // Verify Assertions
+  bPassed = bPassed && VerifyEventsReceived(RayTest, this);
+
+  // Cleanup
+  RayTest->TearDown();
+  RayTest->MarkAsGarbage();
+
+  return bPassed;
+}
+
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FIsdkSubsystemTickTest,
     "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.Subsystem.Tick",
@@ -19,7 +19,63 @@
  */
 
 #include "Interaction/IsdkThrowable.h"
+#include "Math/RandomStream.h"
 #include "Misc/AutomationTest.h"
+#include "Utilities/IsdkRingBuffer.h"
+
+namespace
+{
+// Velocity estimation as done by UIsdkThrowable before the samples were kept in a ring buffer:
+// copy the positions, compute mean and standard deviation, filter outliers into another array and
+// fit the remaining positions
+FVector ReferenceFilteredLeastSquares(
+    const TArray<TPair<FVector, float>>& Positions,
+    float ZScoreThreshold)
+{
+  TArray<FVector> PositionValues;
+  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  {
+    PositionValues.Add(PositionTimestampPair.Key);
+  }
+
+  const FVector Mean = FIsdkMathUtils::GetMean(PositionValues);
+  const FVector StandardDeviation = FIsdkMathUtils::GetStandardDeviation(PositionValues, Mean);
+
+  TArray<TPair<FVector, float>> FilteredPositions;
+  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  {
+    const FVector ZScore = (PositionTimestampPair.Key - Mean) / StandardDeviation;
+    if (ZScore.GetMax() <= ZScoreThreshold)
+    {
+      FilteredPositions.Add(PositionTimestampPair);
+    }
+  }
+  return FIsdkMathUtils::LeastSquares(FilteredPositions);
+}
+
+// Noisy samples of a constant velocity throw, with one large outlier
+TArray<TPair<FVector, float>> MakeThrowSamples(
+    int32 NumSamples,
+    float StartTime,
+    const FVector& Velocity,
+    int32 Seed)
+{
+  FRandomStream Random(Seed);
+  const FVector Start(100.0, -50.0, 120.0);
+  TArray<TPair<FVector, float>> Positions;
+  for (int32 i = 0; i < NumSamples; i++)
+  {
+    const float Time = StartTime + i / 72.0f;
+    FVector Position = Start + Velocity * (Time - StartTime) + Random.VRand() * 0.2;
+    if (i == NumSamples / 2)
+    {
+      Position += FVector(50.0, 50.0, 50.0);
+    }
+    Positions.Add(TPair<FVector, float>(Position, Time));
+  }
+  return Positions;
+}
+} // namespace
 
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(
     FIsdkThrowableTest,
@@ -56,3 +112,122 @@ bool FIsdkThrowableTest::RunTest(const FString& Parameters)
 
   return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkThrowableAccuracyTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkThrowableTest.Accuracy",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkThrowableAccuracyTest::RunTest(const FString& Parameters)
+{
+  const FVector Velocity(150.0, -80.0, 40.0);
+  const float ZScoreThreshold = 2.0f;
+
+  // Same result as the reference implementation, both directly and through the component
+  for (int32 Seed = 0; Seed < 8; Seed++)
+  {
+    const TArray<TPair<FVector, float>> Positions = MakeThrowSamples(8, 0.5f, Velocity, Seed);
+    const FVector Expected = ReferenceFilteredLeastSquares(Positions, ZScoreThreshold);
+
+    TArray<FVector4> Samples;
+    for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+    {
+      Samples.Add(FVector4(PositionTimestampPair.Key, PositionTimestampPair.Value));
+    }
+    // Split the samples the way a wrapped ring buffer would
+    const TConstArrayView<FVector4> AllSamples(Samples);
+    const FVector Actual = FIsdkMathUtils::FilteredLeastSquares(
+        AllSamples.Slice(0, 3), AllSamples.Slice(3, AllSamples.Num() - 3), ZScoreThreshold);
+    TestTrue(
+        FString::Printf(TEXT("FilteredLeastSquares matches reference, seed %d"), Seed),
+        Actual.Equals(Expected, 0.01));
+
+    UIsdkThrowable* Throwable = NewObject<UIsdkThrowable>();
+    Throwable->Settings.SampleSize = 8;
+    Throwable->SetSamplePositions(Positions);
+    TestTrue(
+        FString::Printf(TEXT("GetVelocity matches reference, seed %d"), Seed),
+        Throwable->GetVelocity().Equals(Expected, 0.01));
+  }
+
+  // Filtering happens on the same samples as the fit, the outlier is left out
+  {
+    const TArray<TPair<FVector, float>> Positions = MakeThrowSamples(8, 0.5f, Velocity, 0);
+    TArray<FVector4> Samples;
+    for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+    {
+      Samples.Add(FVector4(PositionTimestampPair.Key, PositionTimestampPair.Value));
+    }
+    TArray<TPair<FVector, float>> Inliers;
+    FIsdkMathUtils::FilteredLeastSquares(Samples, {}, ZScoreThreshold, &Inliers);
+    TestEqual(TEXT("Outlier is filtered"), Inliers.Num(), 7);
+  }
+
+  // Late timestamps don't lose precision, since the fit is relative to the oldest sample
+  {
+    TArray<FVector4> Samples;
+    for (int32 i = 0; i < 8; i++)
+    {
+      const double Time = 20000.0 + i / 72.0;
+      Samples.Add(FVector4(FVector(5000.0, 0.0, 0.0) + Velocity * (i / 72.0), Time));
+    }
+    const FVector Actual = FIsdkMathUtils::FilteredLeastSquares(Samples, {}, ZScoreThreshold);
+    TestTrue(TEXT("Velocity with late timestamps"), Actual.Equals(Velocity, 0.5));
+  }
+
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkThrowablePerfTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkThrowableTest.Perf",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkThrowablePerfTest::RunTest(const FString& Parameters)
+{
+  const int32 NumIterations = 20000;
+  const int32 SampleSize = 16;
+  const float ZScoreThreshold = 2.0f;
+  const TArray<TPair<FVector, float>> Positions =
+      MakeThrowSamples(SampleSize, 0.5f, FVector(150.0, -80.0, 40.0), 0);
+
+  TIsdkRingBuffer<FVector4> RingBuffer;
+  RingBuffer.Reset(SampleSize);
+  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  {
+    RingBuffer.Push(FVector4(PositionTimestampPair.Key, PositionTimestampPair.Value));
+  }
+  TConstArrayView<FVector4> OlderSamples;
+  TConstArrayView<FVector4> NewerSamples;
+  RingBuffer.GetSpans(OlderSamples, NewerSamples);
+
+  FVector ReferenceSum = FVector::ZeroVector;
+  const double ReferenceStart = FPlatformTime::Seconds();
+  for (int32 i = 0; i < NumIterations; i++)
+  {
+    // The reference started from a copy of the history
+    TArray<TPair<FVector, float>> History(Positions);
+    ReferenceSum += ReferenceFilteredLeastSquares(History, ZScoreThreshold);
+  }
+  const double ReferenceSeconds = FPlatformTime::Seconds() - ReferenceStart;
+
+  FVector Sum = FVector::ZeroVector;
+  const double Start = FPlatformTime::Seconds();
+  for (int32 i = 0; i < NumIterations; i++)
+  {
+    Sum += FIsdkMathUtils::FilteredLeastSquares(OlderSamples, NewerSamples, ZScoreThreshold);
+  }
+  const double Seconds = FPlatformTime::Seconds() - Start;
+
+  TestTrue(
+      TEXT("Both paths estimate the same velocity"),
+      Sum.Equals(ReferenceSum, 0.01 * NumIterations));
+  AddInfo(FString::Printf(
+      TEXT("%d samples, %d estimates: reference %.3f us, filtered fit %.3f us per estimate"),
+      SampleSize,
+      NumIterations,
+      ReferenceSeconds * 1e6 / NumIterations,
+      Seconds * 1e6 / NumIterations));
+
+  return true;
+}
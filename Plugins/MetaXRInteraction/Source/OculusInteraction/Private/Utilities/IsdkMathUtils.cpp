@@ -19,6 +19,7 @@
  */
 
 #include "Utilities/IsdkMathUtils.h"
+#include "Math/VectorRegister.h"
 
 float FIsdkMathUtils::ChangeValueAtRate(float From, float To, float DeltaPerSecond, float Dt)
 {
@@ -109,6 +110,101 @@ FVector FIsdkMathUtils::LeastSquares(const TArray<TPair<FVector, float>>& Positi
   return Velocity;
 }
 
+FVector FIsdkMathUtils::FilteredLeastSquares(
+    TConstArrayView<FVector4> OlderSamples,
+    TConstArrayView<FVector4> NewerSamples,
+    float ZScoreThreshold,
+    TArray<TPair<FVector, float>>* OutInliers)
+{
+  const int32 NumSamples = OlderSamples.Num() + NewerSamples.Num();
+  if (NumSamples <= 1)
+  {
+    return FVector::ZeroVector;
+  }
+
+  // All sums are taken relative to the oldest sample. This keeps them small for positions far from
+  // the origin and for late timestamps, without changing the spread or the slope of the samples.
+  const FVector4& OldestSample = OlderSamples.Num() > 0 ? OlderSamples[0] : NewerSamples[0];
+  const VectorRegister Origin = VectorLoad(&OldestSample.X);
+  const TConstArrayView<FVector4> Spans[] = {OlderSamples, NewerSamples};
+
+  VectorRegister Sum = VectorZero();
+  VectorRegister SumSquared = VectorZero();
+  for (const TConstArrayView<FVector4>& Span : Spans)
+  {
+    for (const FVector4& Sample : Span)
+    {
+      const VectorRegister Delta = VectorSubtract(VectorLoad(&Sample.X), Origin);
+      Sum = VectorAdd(Sum, Delta);
+      SumSquared = VectorMultiplyAdd(Delta, Delta, SumSquared);
+    }
+  }
+
+  FVector4 SumValues;
+  FVector4 SumSquaredValues;
+  VectorStore(Sum, &SumValues.X);
+  VectorStore(SumSquared, &SumSquaredValues.X);
+
+  // The time lane keeps a zero mean and scale so that it never counts as an outlier
+  FVector4 Mean(0.0f, 0.0f, 0.0f, 0.0f);
+  FVector4 InvStandardDeviation(0.0f, 0.0f, 0.0f, 0.0f);
+  for (int32 Axis = 0; Axis < 3; ++Axis)
+  {
+    Mean[Axis] = SumValues[Axis] / NumSamples;
+    const double SumSquaredDeviations = SumSquaredValues[Axis] - SumValues[Axis] * Mean[Axis];
+    const double Variance = FMath::Max(SumSquaredDeviations, 0.0) / (NumSamples - 1);
+    // Samples can't be outliers on an axis along which they don't move at all
+    InvStandardDeviation[Axis] = Variance > 0.0 ? 1.0 / FMath::Sqrt(Variance) : 0.0;
+  }
+  const FVector4 Threshold(ZScoreThreshold, ZScoreThreshold, ZScoreThreshold, FLT_MAX);
+
+  const VectorRegister MeanRegister = VectorLoad(&Mean.X);
+  const VectorRegister InvStandardDeviationRegister = VectorLoad(&InvStandardDeviation.X);
+  const VectorRegister ThresholdRegister = VectorLoad(&Threshold.X);
+
+  // Sums of the inliers and of their products with time, (T * X, T * Y, T * Z, T * T)
+  VectorRegister InlierSum = VectorZero();
+  VectorRegister InlierSumTimeProduct = VectorZero();
+  int32 NumInliers = 0;
+  for (const TConstArrayView<FVector4>& Span : Spans)
+  {
+    for (const FVector4& Sample : Span)
+    {
+      const VectorRegister Delta = VectorSubtract(VectorLoad(&Sample.X), Origin);
+      const VectorRegister ZScore =
+          VectorMultiply(VectorSubtract(Delta, MeanRegister), InvStandardDeviationRegister);
+      if (VectorMaskBits(VectorCompareGT(ZScore, ThresholdRegister)) != 0)
+      {
+        continue;
+      }
+
+      ++NumInliers;
+      InlierSum = VectorAdd(InlierSum, Delta);
+      InlierSumTimeProduct =
+          VectorMultiplyAdd(Delta, VectorReplicate(Delta, 3), InlierSumTimeProduct);
+      if (OutInliers)
+      {
+        OutInliers->Emplace(FVector(Sample), static_cast<float>(Sample.W));
+      }
+    }
+  }
+
+  FVector4 InlierSumValues;
+  FVector4 InlierSumTimeProductValues;
+  VectorStore(InlierSum, &InlierSumValues.X);
+  VectorStore(InlierSumTimeProduct, &InlierSumTimeProductValues.X);
+
+  const double SumTime = InlierSumValues.W;
+  const double Denominator = NumInliers * InlierSumTimeProductValues.W - SumTime * SumTime;
+  if (NumInliers == 0 || FMath::IsNearlyZero(Denominator))
+  {
+    return FVector::ZeroVector;
+  }
+
+  return (NumInliers * FVector(InlierSumTimeProductValues) - SumTime * FVector(InlierSumValues)) /
+      Denominator;
+}
+
 FVector FIsdkMathUtils::GetMean(const TArray<FVector>& Positions)
 {
   if (Positions.Num() == 0)
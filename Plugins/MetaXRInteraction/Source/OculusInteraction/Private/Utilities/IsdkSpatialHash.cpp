@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Utilities/IsdkSpatialHash.h"
+
+FIsdkSpatialHash::FIsdkSpatialHash(double InCellSize) : CellSize(FMath::Max(InCellSize, 1.0)) {}
+
+int32 FIsdkSpatialHash::Add(const FBox& Bounds)
+{
+  const int32 Id = Entries.Add(FEntry());
+  GetCellRange(Bounds, Entries[Id].MinCell, Entries[Id].MaxCell);
+  Insert(Id);
+  return Id;
+}
+
+void FIsdkSpatialHash::Update(int32 Id, const FBox& Bounds)
+{
+  if (!Entries.IsValidIndex(Id))
+  {
+    return;
+  }
+
+  FIntVector MinCell;
+  FIntVector MaxCell;
+  GetCellRange(Bounds, MinCell, MaxCell);
+  FEntry& Entry = Entries[Id];
+  if (MinCell == Entry.MinCell && MaxCell == Entry.MaxCell)
+  {
+    return;
+  }
+
+  Erase(Id);
+  Entry.MinCell = MinCell;
+  Entry.MaxCell = MaxCell;
+  Insert(Id);
+}
+
+void FIsdkSpatialHash::Remove(int32 Id)
+{
+  if (Entries.IsValidIndex(Id))
+  {
+    Erase(Id);
+    Entries.RemoveAt(Id);
+  }
+}
+
+void FIsdkSpatialHash::Reset()
+{
+  Entries.Empty();
+  Cells.Empty();
+  OversizedIds.Empty();
+}
+
+void FIsdkSpatialHash::Query(const FBox& Bounds, TArray<int32>& OutIds) const
+{
+  if (Entries.Num() == 0)
+  {
+    return;
+  }
+
+  // Zero is the initial stamp of new entries, skip it on wrap around
+  if (++QueryStamp == 0)
+  {
+    ++QueryStamp;
+  }
+
+  FIntVector MinCell;
+  FIntVector MaxCell;
+  GetCellRange(Bounds, MinCell, MaxCell);
+  const auto VisitEntry = [this, &OutIds](int32 Id)
+  {
+    const FEntry& Entry = Entries[Id];
+    if (Entry.QueryStamp != QueryStamp)
+    {
+      Entry.QueryStamp = QueryStamp;
+      OutIds.Add(Id);
+    }
+  };
+
+  for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+  {
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+      for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+      {
+        if (const TArray<int32>* CellIds = Cells.Find(FIntVector(X, Y, Z)))
+        {
+          for (const int32 Id : *CellIds)
+          {
+            VisitEntry(Id);
+          }
+        }
+      }
+    }
+  }
+
+  for (const int32 Id : OversizedIds)
+  {
+    VisitEntry(Id);
+  }
+}
+
+void FIsdkSpatialHash::GetCellRange(
+    const FBox& Bounds,
+    FIntVector& OutMinCell,
+    FIntVector& OutMaxCell) const
+{
+  const auto ToCell = [this](const FVector& Position)
+  {
+    return FIntVector(
+        static_cast<int32>(FMath::FloorToDouble(Position.X / CellSize)),
+        static_cast<int32>(FMath::FloorToDouble(Position.Y / CellSize)),
+        static_cast<int32>(FMath::FloorToDouble(Position.Z / CellSize)));
+  };
+  OutMinCell = ToCell(Bounds.Min);
+  OutMaxCell = ToCell(Bounds.Max);
+}
+
+void FIsdkSpatialHash::Insert(int32 Id)
+{
+  FEntry& Entry = Entries[Id];
+  const FIntVector CellCount = Entry.MaxCell - Entry.MinCell + FIntVector(1, 1, 1);
+  Entry.bOversized = static_cast<int64>(CellCount.X) * CellCount.Y * CellCount.Z > MaxCellsPerEntry;
+  if (Entry.bOversized)
+  {
+    OversizedIds.Add(Id);
+    return;
+  }
+
+  for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+  {
+    for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+    {
+      for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+      {
+        Cells.FindOrAdd(FIntVector(X, Y, Z)).Add(Id);
+      }
+    }
+  }
+}
+
+void FIsdkSpatialHash::Erase(int32 Id)
+{
+  const FEntry& Entry = Entries[Id];
+  if (Entry.bOversized)
+  {
+    OversizedIds.RemoveSingleSwap(Id);
+    return;
+  }
+
+  for (int32 Z = Entry.MinCell.Z; Z <= Entry.MaxCell.Z; ++Z)
+  {
+    for (int32 Y = Entry.MinCell.Y; Y <= Entry.MaxCell.Y; ++Y)
+    {
+      for (int32 X = Entry.MinCell.X; X <= Entry.MaxCell.X; ++X)
+      {
+        const FIntVector Cell(X, Y, Z);
+        if (TArray<int32>* CellIds = Cells.Find(Cell))
+        {
+          CellIds->RemoveSingleSwap(Id);
+          if (CellIds->Num() == 0)
+          {
+            Cells.Remove(Cell);
+          }
+        }
+      }
+    }
+  }
+}
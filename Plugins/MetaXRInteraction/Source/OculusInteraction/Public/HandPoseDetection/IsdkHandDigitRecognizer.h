@@ -84,4 +84,10 @@ class OCULUSINTERACTION_API UIsdkHandDigitRecognizer : public UObject
       PURE_VIRTUAL(UIsdkDigitRecognizer::CreateDigitRecognizer, return nullptr;);
 
   isdk::api::DigitRecognizer* ApiDigitRecognizer{};
+
+ private:
+  // Pose revision of the hand mesh the recognizer was last updated with, and the time the
+  // recognizer was updated with since that pose was first seen
+  uint64 LastHandPoseRevision = 0;
+  float TimeSincePoseChange = 0.f;
 };
@@ -193,6 +193,8 @@ class OCULUSINTERACTION_API UIsdkGrabbableComponent : public UIsdkSceneInteracta
   FComponentReference PhysicsColliderReference;
 
   UPrimitiveComponent* FindCollider();
+  // Makes the grab collider known to grabbers that query the world for hover candidates
+  void RegisterGrabCollider();
 
   TArray<TObjectPtr<UIsdkGrabberComponent>> SelectedGrabbers;
   TArray<TObjectPtr<UIsdkGrabberComponent>> HoveredGrabbers;
@@ -182,6 +182,11 @@ class OCULUSINTERACTION_API UIsdkGrabberComponent : public UIsdkSceneInteractorC
   UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = InteractionSDK)
   bool bAllowPinchGrab = true;
 
+  /* Whether this Grabber finds hover candidates by querying the grab colliders known to the
+   * IsdkWorldSubsystem once per frame, instead of relying on overlap events of its colliders */
+  UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = InteractionSDK)
+  bool bQueryHoverCandidates = false;
+
   /* UPrimitiveComponent to use as a collider for interactable selection */
   UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = InteractionSDK)
   TObjectPtr<UPrimitiveComponent> SelectingCollider;
@@ -218,7 +223,19 @@ class OCULUSINTERACTION_API UIsdkGrabberComponent : public UIsdkSceneInteractorC
       UPrimitiveComponent* OtherComp,
       int32 OtherBodyIndex);
 
-  void UpdateOverlappedSet();
+  void AddHoverObject(
+      UPrimitiveComponent* Collider,
+      EIsdkGrabColliderType Type,
+      UPrimitiveComponent* OtherComp,
+      UIsdkGrabbableComponent* Grabbable);
+  void RemoveHoverObject(
+      UPrimitiveComponent* Collider,
+      EIsdkGrabColliderType Type,
+      UPrimitiveComponent* OtherComp);
+  void UpdateQueriedHoverCandidates();
+
+  void UpdateOverlappedSet(UIsdkGrabbableComponent* Grabbable);
+  bool IsTrackedByAnyCollider(const UIsdkGrabbableComponent* Grabbable) const;
 
   void PostEvent(EIsdkPointerEventType Type, UIsdkGrabbableComponent* Dest);
   virtual void TickComponent(
@@ -247,6 +264,11 @@ class OCULUSINTERACTION_API UIsdkGrabberComponent : public UIsdkSceneInteractorC
   UPROPERTY()
   TSet<UIsdkGrabbableComponent*> OverlappedGrabbables;
 
+  // Scratch arrays of UpdateQueriedHoverCandidates, kept to avoid allocating every frame
+  TArray<UPrimitiveComponent*> QueryColliders;
+  TArray<TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>> QueryCandidates;
+  TArray<UPrimitiveComponent*> QueryEndedHovers;
+
   int NextRankIndex = 0;
   EIsdkGrabColliderType SelectingColliderType = EIsdkGrabColliderType::Unknown;
 
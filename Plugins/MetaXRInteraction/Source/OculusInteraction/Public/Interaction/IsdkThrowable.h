@@ -24,6 +24,7 @@
 #include "Components/ActorComponent.h"
 #include "Components/SceneComponent.h"
 #include "Utilities/IsdkMathUtils.h"
+#include "Utilities/IsdkRingBuffer.h"
 #include "IsdkThrowable.generated.h"
 
 /* Different methods for estimating the velocity of the object after being thrown */
@@ -122,8 +123,8 @@ class OCULUSINTERACTION_API UIsdkThrowable : public USceneComponent
   virtual void BeginPlay() override;
 
  public:
-  void SetSamplePositions(TArray<TPair<FVector, float>>& Positions);
-  void SetSampleRotations(TArray<TPair<FQuat, float>>& Rotations);
+  void SetSamplePositions(const TArray<TPair<FVector, float>>& Positions);
+  void SetSampleRotations(const TArray<TPair<FQuat, float>>& Rotations);
   void ProcessKalmanFilter();
   bool CheckPositionConstraints();
 
@@ -149,14 +150,12 @@ class OCULUSINTERACTION_API UIsdkThrowable : public USceneComponent
   const int32 Ransac_Iterations = 50;
   const float Ransac_Score_Threshold = 0.01f;
 
-  // Arrays to store the last tracked object positions and rotations
-  TArray<TPair<FVector, float>> LastNPositions;
-  TArray<TPair<FQuat, float>> LastNRotations;
-  void GetLastNPositions(int32 N, TArray<TPair<FVector, float>>& OutPositions);
-
-  int32 CurrentPositionIndex = 0;
-  int32 PreviousPositionIndex = 0;
-  int32 CurrentRotationIndex = 0;
+  // The last tracked object positions as (X, Y, Z, Time) and rotations, oldest first
+  TIsdkRingBuffer<FVector4> PositionSamples;
+  TIsdkRingBuffer<TPair<FQuat, double>> RotationSamples;
+  // Reused storage for the positions handed to RANSAC after outlier filtering
+  TArray<TPair<FVector, float>> RansacPositions;
 
+  int32 GetSampleCapacity() const;
   void ResetKalmanFilter();
 };
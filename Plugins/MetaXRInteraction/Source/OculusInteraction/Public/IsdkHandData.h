@@ -75,6 +75,19 @@ enum class EIsdkHandBones : uint8
 struct isdk_HandData_;
 typedef isdk_HandData_ isdk_HandData;
 
+/* Read only view of the joints a data source last published. The views point into a copy the hand
+ * data only writes when the published joints change, so later edits of the joints don't show
+ * through until the data source publishes again. Empty if nothing was published yet. */
+struct FIsdkHandJointsSnapshot
+{
+  TConstArrayView<FTransform> JointPoses;
+  TConstArrayView<float> JointRadii;
+
+  /* Advances every time the published joints differ from the previously published ones. Zero if
+   * nothing was published yet. */
+  uint64 FrameCounter = 0;
+};
+
 UCLASS(BlueprintType, DefaultToInstanced)
 class OCULUSINTERACTION_API UIsdkHandData : public UObject
 {
@@ -131,6 +144,17 @@ class OCULUSINTERACTION_API UIsdkHandData : public UObject
   UFUNCTION(BlueprintCallable, Category = InteractionSDK)
   void SetJointsToIdentity();
 
+  /* Publishes the current joints as the snapshot of this frame. Called by the data source once it
+   * finished updating the joints. The joints are only copied, and the frame counter only advances,
+   * if they changed. */
+  void PublishSnapshot();
+
+  /* Returns the joints published by the data source */
+  FIsdkHandJointsSnapshot GetSnapshot() const
+  {
+    return {PublishedJointPoses, PublishedJointRadii, SnapshotFrameCounter};
+  }
+
   /* Set Inbound Bone Mappings */
   UFUNCTION(BlueprintCallable, Category = InteractionSDK)
   void SetInboundBoneMap(TMap<int32, int32>& InboundMap)
@@ -160,4 +184,9 @@ class OCULUSINTERACTION_API UIsdkHandData : public UObject
   // Bone mapping to translate for receiving from external skeleton
   UPROPERTY()
   TMap<int32, int32> InboundBoneMapping = {};
+
+  // Joints of the last publish, kept apart so the snapshot doesn't change along with the joints
+  TArray<FTransform> PublishedJointPoses{};
+  TArray<float> PublishedJointRadii{};
+  uint64 SnapshotFrameCounter = 0;
 };
@@ -173,6 +173,13 @@ class OCULUSINTERACTION_API UIsdkHandMeshComponent : public UPoseableMeshCompone
   // Returns true if this hand mesh is ignoring root pose hand data
   bool IsRootPoseIgnored() const;
 
+  // Advances every time the bone transforms of the hand changed. Consumers of the hand position
+  // frame can use it to skip work while the hand pose stays the same.
+  uint64 GetPoseRevision() const
+  {
+    return PoseRevision;
+  }
+
  protected:
   /* Hand Pose is currently being overridden */
   UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = InteractionSDK)
@@ -188,6 +195,22 @@ class OCULUSINTERACTION_API UIsdkHandMeshComponent : public UPoseableMeshCompone
  private:
   int MappedBoneIndices[MappedBoneCount];
 
+  // For every bone of the skeleton, the index of the joint that drives it or INDEX_NONE. Built
+  // together with MappedBoneIndices.
+  TArray<int32> BoneJointIndices;
+
+  // Component space transforms of the bones, reused between frames to avoid allocations
+  TArray<FTransform> ComponentSpaceScratch;
+  mutable TArray<FTransform> ApiComponentSpaceScratch;
+
+  uint64 PoseRevision = 1;
+  // Frame counter of the joints snapshot the bone transforms were last built from, zero if they
+  // were built from anything else
+  uint64 AppliedSnapshotFrame = 0;
+  // Pose revision and wrist location last pushed to the native hand position frame
+  uint64 ApiFramePoseRevision = 0;
+  FVector ApiFrameWristLocation = FVector::ZeroVector;
+
   UPROPERTY(
       VisibleAnywhere,
       Transient,
@@ -228,6 +251,14 @@ class OCULUSINTERACTION_API UIsdkHandMeshComponent : public UPoseableMeshCompone
   void InitializeSkeleton();
   void UpdateMappingState();
   void UpdateSkeleton();
+
+  // Writes the wrist space joint poses into BoneSpaceTransforms in a single pass over the skeleton.
+  // If LerpTargetPoses is set, the poses are blended towards it by LerpAlpha. Returns false and
+  // leaves the bones untouched if the mesh or the poses aren't ready.
+  bool ApplyJointPoses(
+      TConstArrayView<FTransform> JointPoses,
+      const TArray<FTransform>* LerpTargetPoses,
+      float LerpAlpha);
   void UpdateApiHandPositionFrame(isdk::api::ExternalHandPositionFrame& ApiHandPositionFrame) const;
 
   void DrawTransformAxis(const FTransform& Pose) const;
@@ -0,0 +1,35 @@
+﻿/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("OculusInteraction"), STATGROUP_OculusInteraction, STATCAT_Advanced);
+
+// Ticks of the prebuilt components that sync their interactables with their visibility, in all
+// worlds. Stays at zero while nothing changes visibility and no component polls.
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+    TEXT("Prebuilt Interactable Component Ticks"),
+    STAT_IsdkInteractableComponentTicks,
+    STATGROUP_OculusInteraction,
+    OCULUSINTERACTION_API);
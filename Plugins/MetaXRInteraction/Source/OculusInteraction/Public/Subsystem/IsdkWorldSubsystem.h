@@ -30,6 +30,7 @@
 #include "Interaction/IsdkIInteractableState.h"
 #include "Interaction/IsdkInteractionEvents.h"
 #include "Interaction/Pointable/IsdkInteractionPointerEvent.h"
+#include "Utilities/IsdkSpatialHash.h"
 #include "IsdkWorldSubsystem.generated.h"
 
 // Forward declarations of internal types
@@ -46,6 +47,7 @@ class FIsdkScaledTimeProviderImpl;
 namespace helper
 {
 class IEventQueueWrapper;
+class FWorldEventBuffer;
 class FUpdateEventQueueImpl;
 class FInteractableStateEventQueueImpl;
 class FInteractorStateEventQueueImpl;
@@ -57,6 +59,7 @@ typedef struct isdk_IPayload_ isdk_IPayload;
 typedef struct isdk_IInteractable_ isdk_IInteractable;
 
 class UIsdkInteractorComponent;
+class UIsdkGrabbableComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FIsdkWorldFrameEventDelegate);
 
@@ -196,6 +199,24 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UIsdkWorldSubsystemBase
     return nullptr;
   }
 
+  /**
+   * Adds the grab collider of a grabbable to the spatial hash that grabbers query for hover
+   * candidates when they don't rely on overlap events. Registering a grabbable again replaces its
+   * collider. The hash follows the collider as it moves until the grabbable is unregistered.
+   */
+  void RegisterGrabbableCollider(
+      UIsdkGrabbableComponent* InGrabbable,
+      UPrimitiveComponent* InGrabCollider);
+  void UnregisterGrabbableCollider(UIsdkGrabbableComponent* InGrabbable);
+
+  /**
+   * Appends the registered grab colliders, with their grabbables, whose bounds are near InBounds.
+   * Callers are expected to narrow the result down with an exact overlap test.
+   */
+  void QueryGrabbableColliders(
+      const FBox& InBounds,
+      TArray<TPair<UPrimitiveComponent*, UIsdkGrabbableComponent*>>& OutCandidates);
+
  private:
   TPimplPtr<isdk::api::FIsdkScaledTimeProviderImpl> IsdkScaledTimeProviderImpl;
 
@@ -271,6 +292,21 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UIsdkWorldSubsystemBase
       }
     }
 
+    int32 CollectEvents(isdk::api::helper::FWorldEventBuffer& Buffer)
+    {
+      int32 NumCollected = 0;
+      for (const auto& Element : EventSubscriptions)
+      {
+        NumCollected += Element.Value->CollectEvents(Buffer);
+      }
+      return NumCollected;
+    }
+
+    int32 Num() const
+    {
+      return EventSubscriptions.Num();
+    }
+
     void Reset()
     {
       PendingCreate.Empty();
@@ -294,6 +330,9 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UIsdkWorldSubsystemBase
     const WIDECHAR* Name{};
   };
 
+  // Events of all pointer and state event subscriptions, collected and dispatched once per tick
+  TPimplPtr<isdk::api::helper::FWorldEventBuffer> WorldEventBuffer;
+
   EventQueueWrapper<isdk::api::helper::FPointerEventQueueImpl> PointerEventSubscriptions{
       TEXT("PointerEventSubscriptions")};
   EventQueueWrapper<isdk::api::helper::FInteractableStateEventQueueImpl>
@@ -316,6 +355,26 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UIsdkWorldSubsystemBase
   UPROPERTY()
   TArray<UIsdkInteractableComponent*> RegisteredInteractables{};
 
+  struct FSpatialGrabbable
+  {
+    TWeakObjectPtr<UIsdkGrabbableComponent> Grabbable;
+    // Key in SpatialGrabbableIds, still usable after the grabbable was destroyed
+    const UIsdkGrabbableComponent* GrabbableKey = nullptr;
+    TWeakObjectPtr<UPrimitiveComponent> GrabCollider;
+    FDelegateHandle TransformUpdatedHandle;
+  };
+
+  // Grab colliders of all registered grabbables, keyed by their id in the spatial hash
+  FIsdkSpatialHash GrabbableSpatialHash;
+  TMap<int32, FSpatialGrabbable> SpatialGrabbables{};
+  TMap<const UIsdkGrabbableComponent*, int32> SpatialGrabbableIds{};
+  // Ids of the grab colliders that moved since the last query
+  TSet<int32> MovedSpatialGrabbableIds{};
+  TArray<int32> SpatialHashQueryIds{};
+
+  void RemoveSpatialGrabbable(int32 Id);
+  void UpdateMovedSpatialGrabbables();
+
   static UIsdkInteractorComponent* LookupInteractorFromPayload(
       TWeakObjectPtr<UIsdkWorldSubsystem> InThis,
       const isdk_IPayload* InPayload);
@@ -52,6 +52,15 @@ class OCULUSINTERACTION_API FIsdkMathUtils
       int32 RansacIterations,
       float RansacScoreThreshold);
   static FVector LeastSquares(const TArray<TPair<FVector, float>>& Positions);
+  /* Least squares velocity of the samples (X, Y, Z, Time) in OlderSamples followed by
+   * NewerSamples. Samples with a Z-score above ZScoreThreshold on any axis are left out of the fit
+   * and the remaining ones are appended to OutInliers, if given. Equivalent to filtering with
+   * GetMean and GetStandardDeviation before calling LeastSquares, without copying the samples. */
+  static FVector FilteredLeastSquares(
+      TConstArrayView<FVector4> OlderSamples,
+      TConstArrayView<FVector4> NewerSamples,
+      float ZScoreThreshold,
+      TArray<TPair<FVector, float>>* OutInliers = nullptr);
   static FVector GetMean(const TArray<FVector>& Positions);
   static FVector GetStandardDeviation(const TArray<FVector>& Positions, const FVector& Mean);
   static FVector
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Ring buffer whose capacity is fixed once it is allocated. Pushing into a full buffer overwrites
+ * the oldest element. The elements can be read in order from oldest to newest as two contiguous
+ * spans, without copying them. */
+template <typename ElementType>
+class TIsdkRingBuffer
+{
+ public:
+  /* Discards all elements and allocates room for InCapacity elements */
+  void Reset(int32 InCapacity)
+  {
+    Elements.Reset();
+    Elements.SetNum(FMath::Max(InCapacity, 0));
+    Clear();
+  }
+
+  /* Discards all elements, keeping the allocation */
+  void Clear()
+  {
+    Head = 0;
+    Count = 0;
+  }
+
+  /* Adds an element as the newest one, overwriting the oldest one if the buffer is full */
+  void Push(const ElementType& Element)
+  {
+    const int32 Capacity = GetCapacity();
+    if (Capacity == 0)
+    {
+      return;
+    }
+
+    if (Count < Capacity)
+    {
+      Elements[(Head + Count) % Capacity] = Element;
+      ++Count;
+    }
+    else
+    {
+      Elements[Head] = Element;
+      Head = (Head + 1) % Capacity;
+    }
+  }
+
+  int32 Num() const
+  {
+    return Count;
+  }
+
+  int32 GetCapacity() const
+  {
+    return Elements.Num();
+  }
+
+  bool IsEmpty() const
+  {
+    return Count == 0;
+  }
+
+  /* Returns the element at Index, where zero is the oldest element */
+  const ElementType& operator[](int32 Index) const
+  {
+    check(Index >= 0 && Index < Count);
+    return Elements[(Head + Index) % GetCapacity()];
+  }
+
+  /* Returns the newest element */
+  const ElementType& Last() const
+  {
+    return (*this)[Count - 1];
+  }
+
+  /* Returns all elements as two spans that, read one after the other, go from the oldest to the
+   * newest element. The second span is empty unless the elements wrap around the end of the
+   * storage. */
+  void GetSpans(TConstArrayView<ElementType>& OutOlder, TConstArrayView<ElementType>& OutNewer)
+      const
+  {
+    const int32 OlderNum = FMath::Min(Count, GetCapacity() - Head);
+    OutOlder = MakeArrayView(Elements.GetData() + Head, OlderNum);
+    OutNewer = MakeArrayView(Elements.GetData(), Count - OlderNum);
+  }
+
+ private:
+  TArray<ElementType> Elements;
+  int32 Head = 0;
+  int32 Count = 0;
+};
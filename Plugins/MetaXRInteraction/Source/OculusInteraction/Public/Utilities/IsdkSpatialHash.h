@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Uniform grid that buckets axis aligned boxes by the cells they cover, to find the boxes that
+ * intersect a query box without testing every box. Boxes that would cover too many cells are kept
+ * in a separate list that every query visits. */
+class OCULUSINTERACTION_API FIsdkSpatialHash
+{
+ public:
+  explicit FIsdkSpatialHash(double InCellSize = 25.0);
+
+  /* Adds a box and returns its id, which stays valid until the box is removed */
+  int32 Add(const FBox& Bounds);
+  /* Moves the box with the given id, only touching the cells it enters or leaves */
+  void Update(int32 Id, const FBox& Bounds);
+  void Remove(int32 Id);
+  void Reset();
+
+  /* Appends the ids of all boxes whose cells intersect Bounds, each id once. The result may
+   * contain boxes that are in the same cells as Bounds but don't intersect it. */
+  void Query(const FBox& Bounds, TArray<int32>& OutIds) const;
+
+  int32 Num() const
+  {
+    return Entries.Num();
+  }
+  double GetCellSize() const
+  {
+    return CellSize;
+  }
+
+ private:
+  struct FEntry
+  {
+    FIntVector MinCell;
+    FIntVector MaxCell;
+    bool bOversized = false;
+    // Query that visited this entry last, to report entries that span several cells once
+    mutable uint32 QueryStamp = 0;
+  };
+
+  // Boxes that would cover more cells than this are not bucketed
+  static constexpr int32 MaxCellsPerEntry = 64;
+
+  void GetCellRange(const FBox& Bounds, FIntVector& OutMinCell, FIntVector& OutMaxCell) const;
+  void Insert(int32 Id);
+  void Erase(int32 Id);
+
+  double CellSize;
+  TSparseArray<FEntry> Entries;
+  TMap<FIntVector, TArray<int32>> Cells;
+  TArray<int32> OversizedIds;
+  mutable uint32 QueryStamp = 0;
+};
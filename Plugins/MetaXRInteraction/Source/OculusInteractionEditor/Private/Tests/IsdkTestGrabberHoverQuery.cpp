@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IsdkTestGrabberHoverQuery.h"
+#include "IsdkCommonTestCommands.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+namespace
+{
+// Far enough from the grabbable that no collider of the grabber touches it
+const FVector IsdkTestGrabberOutside(100.0, 0.0, 0.0);
+// Only the palm collider touches the grabbable, the smaller pinch collider doesn't
+const FVector IsdkTestGrabberPalmOnly(AIsdkTestGrabbableActor::ColliderRadius + 2.6, 0.0, 0.0);
+} // namespace
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FIsdkTestSpawnGrabberActors);
+bool FIsdkTestSpawnGrabberActors::Update()
+{
+  AIsdkTestGrabbableActor::Setup();
+  // One grabber relying on overlap events, one querying its hover candidates every frame
+  AIsdkTestGrabberActor::Setup(false, IsdkTestGrabberOutside);
+  AIsdkTestGrabberActor::Setup(true, IsdkTestGrabberOutside);
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkTestSetGrabbersPosition,
+    FAutomationTestBase*,
+    Test,
+    FVector,
+    ActorPosition);
+bool FIsdkTestSetGrabbersPosition::Update()
+{
+  for (const bool bQueryHoverCandidates : {false, true})
+  {
+    AIsdkTestGrabberActor* GrabberActor = &AIsdkTestGrabberActor::Get(bQueryHoverCandidates);
+    Test->TestTrue("Grabber Actor was not created", IsValid(GrabberActor));
+    GrabberActor->SetActorLocation(ActorPosition);
+  }
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(
+    FIsdkTestCheckGrabberHoverEvents,
+    FAutomationTestBase*,
+    Test,
+    int,
+    ExpectedHovers,
+    int,
+    ExpectedUnhovers,
+    FString,
+    TestStepName);
+bool FIsdkTestCheckGrabberHoverEvents::Update()
+{
+  const AIsdkTestGrabbableActor& GrabbableActor = AIsdkTestGrabbableActor::Get();
+  const UIsdkGrabberComponent* OverlapGrabber = AIsdkTestGrabberActor::Get(false).TestGrabber;
+  const UIsdkGrabberComponent* QueryGrabber = AIsdkTestGrabberActor::Get(true).TestGrabber;
+
+  // The events are counted since the start of the test, each collider of a grabber posts its own
+  const int OverlapHovers =
+      GrabbableActor.CountEvents(OverlapGrabber, EIsdkPointerEventType::Hover);
+  const int OverlapUnhovers =
+      GrabbableActor.CountEvents(OverlapGrabber, EIsdkPointerEventType::Unhover);
+  Test->TestEqual(
+      *FString::Printf(TEXT("%s: Overlap grabber hover events"), *TestStepName),
+      OverlapHovers,
+      ExpectedHovers);
+  Test->TestEqual(
+      *FString::Printf(TEXT("%s: Overlap grabber unhover events"), *TestStepName),
+      OverlapUnhovers,
+      ExpectedUnhovers);
+
+  Test->TestEqual(
+      *FString::Printf(
+          TEXT("%s: Query grabber hover events match overlap events"), *TestStepName),
+      GrabbableActor.CountEvents(QueryGrabber, EIsdkPointerEventType::Hover),
+      OverlapHovers);
+  Test->TestEqual(
+      *FString::Printf(
+          TEXT("%s: Query grabber unhover events match overlap events"), *TestStepName),
+      GrabbableActor.CountEvents(QueryGrabber, EIsdkPointerEventType::Unhover),
+      OverlapUnhovers);
+  Test->TestTrue(
+      *FString::Printf(TEXT("%s: Query grabber hovers like overlap grabber"), *TestStepName),
+      GrabbableActor.TestGrabbable->IsHoveredBy(QueryGrabber) ==
+          GrabbableActor.TestGrabbable->IsHoveredBy(OverlapGrabber));
+  Test->TestEqual(
+      *FString::Printf(TEXT("%s: Query grabber state matches overlap grabber"), *TestStepName),
+      QueryGrabber->GetCurrentState(),
+      OverlapGrabber->GetCurrentState());
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    IsdkGrabberHoverQueryTests,
+    "InteractionSDK.OculusInteraction.Source.OculusInteractionEditor.Private.Tests.IsdkGrabberHoverQueryTests",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool IsdkGrabberHoverQueryTests::RunTest(const FString& Parameters)
+{
+  isdk::test::AddInitPieTestSteps(this);
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSpawnGrabberActors());
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(
+      FIsdkTestCheckGrabberHoverEvents(this, 0, 0, TEXT("Initial grabber hover check")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetGrabbersPosition(this, IsdkTestGrabberPalmOnly));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckGrabberHoverEvents(
+      this, 1, 0, TEXT("Grabber hover check after the palm collider entered the grabbable.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetGrabbersPosition(this, FVector(3.0, 0.0, 0.0)));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckGrabberHoverEvents(
+      this, 2, 0, TEXT("Grabber hover check after the pinch collider entered the grabbable.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetGrabbersPosition(this, FVector(2.0, 1.0, 0.0)));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckGrabberHoverEvents(
+      this,
+      2,
+      0,
+      TEXT("Grabber hover check after moving within the grabbable for several frames.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetGrabbersPosition(this, IsdkTestGrabberPalmOnly));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckGrabberHoverEvents(
+      this, 2, 1, TEXT("Grabber hover check after the pinch collider left the grabbable.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetGrabbersPosition(this, IsdkTestGrabberOutside));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckGrabberHoverEvents(
+      this, 2, 2, TEXT("Grabber hover check after the palm collider left the grabbable.")));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+
+  return true;
+}
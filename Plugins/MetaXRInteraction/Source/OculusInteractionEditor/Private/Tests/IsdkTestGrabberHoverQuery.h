@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+#include "Components/SphereComponent.h"
+#include "Interaction/IsdkGrabberComponent.h"
+#include "Interaction/IsdkGrabbableComponent.h"
+#include "Interaction/Pointable/IsdkInteractionPointerEvent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Editor.h"
+
+#include "IsdkTestGrabberHoverQuery.generated.h"
+
+UCLASS()
+class OCULUSINTERACTIONEDITOR_API AIsdkTestGrabberActor : public AActor
+{
+  GENERATED_BODY()
+ public:
+  AIsdkTestGrabberActor()
+  {
+    const auto Root = CreateDefaultSubobject<USceneComponent>(FName("Root"));
+    SetRootComponent(Root);
+
+    TestGrabber = CreateDefaultSubobject<UIsdkGrabberComponent>(TEXT("TestGrabber"));
+    TestGrabber->SetupAttachment(RootComponent);
+  }
+
+  static bool Setup(bool bQueryHoverCandidates, const FVector& Location)
+  {
+    UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+
+    // The grabber reads bQueryHoverCandidates when it creates its colliders in BeginPlay
+    const auto TestActor = TestWorld->SpawnActorDeferred<AIsdkTestGrabberActor>(
+        AIsdkTestGrabberActor::StaticClass(),
+        FTransform(Location),
+        nullptr,
+        nullptr,
+        ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+    if (!ensure(TestActor))
+    {
+      return false;
+    }
+    TestActor->TestGrabber->bQueryHoverCandidates = bQueryHoverCandidates;
+    TestActor->FinishSpawning(FTransform(Location));
+    return true;
+  }
+
+  static AIsdkTestGrabberActor& Get(bool bQueryHoverCandidates)
+  {
+    UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+    check(TestWorld);
+    AIsdkTestGrabberActor* Instance = nullptr;
+    for (TActorIterator<AIsdkTestGrabberActor> It(TestWorld); It; ++It)
+    {
+      if (It->TestGrabber->bQueryHoverCandidates == bQueryHoverCandidates)
+      {
+        Instance = *It;
+        break;
+      }
+    }
+    check(Instance);
+    return *Instance;
+  }
+
+  UPROPERTY()
+  UIsdkGrabberComponent* TestGrabber{};
+};
+
+UCLASS()
+class OCULUSINTERACTIONEDITOR_API AIsdkTestGrabbableActor : public AActor
+{
+  GENERATED_BODY()
+ public:
+  AIsdkTestGrabbableActor()
+  {
+    // The grabbable picks up the first shape component of its actor as its grab collider
+    TestCollider = CreateDefaultSubobject<USphereComponent>(TEXT("TestCollider"));
+    TestCollider->InitSphereRadius(ColliderRadius);
+    TestCollider->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    TestCollider->SetCollisionObjectType(ECollisionChannel::ECC_WorldDynamic);
+    TestCollider->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
+    SetRootComponent(TestCollider);
+
+    TestGrabbable = CreateDefaultSubobject<UIsdkGrabbableComponent>(TEXT("TestGrabbable"));
+    TestGrabbable->SetupAttachment(RootComponent);
+  }
+
+  virtual void BeginPlay() override
+  {
+    Super::BeginPlay();
+    TestGrabbable->GetInteractionPointerEventDelegate().AddDynamic(
+        this, &AIsdkTestGrabbableActor::HandlePointerEvent);
+  }
+
+  static bool Setup()
+  {
+    // No getting the level dirty
+    FActorSpawnParameters ActorParameters{};
+    ActorParameters.bNoFail = true;
+    UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+
+    const auto TestActor = TestWorld->SpawnActor<AIsdkTestGrabbableActor>(
+        AIsdkTestGrabbableActor::StaticClass(), ActorParameters);
+    return ensure(TestActor);
+  }
+
+  static AIsdkTestGrabbableActor& Get()
+  {
+    const UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+    check(TestWorld);
+    AIsdkTestGrabbableActor* Instance = Cast<AIsdkTestGrabbableActor, AActor>(
+        UGameplayStatics::GetActorOfClass(TestWorld, AIsdkTestGrabbableActor::StaticClass()));
+    check(Instance);
+    return *Instance;
+  }
+
+  int CountEvents(const UIsdkGrabberComponent* Grabber, EIsdkPointerEventType Type) const
+  {
+    int Count = 0;
+    for (const FIsdkInteractionPointerEvent& Event : ReceivedEvents)
+    {
+      if (Event.Interactor == Grabber && Event.Type == Type)
+      {
+        ++Count;
+      }
+    }
+    return Count;
+  }
+
+  static constexpr float ColliderRadius = 10.f;
+
+  UPROPERTY()
+  USphereComponent* TestCollider{};
+  UPROPERTY()
+  UIsdkGrabbableComponent* TestGrabbable{};
+
+  TArray<FIsdkInteractionPointerEvent> ReceivedEvents;
+
+ private:
+  UFUNCTION()
+  void HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent)
+  {
+    ReceivedEvents.Add(PointerEvent);
+  }
+};
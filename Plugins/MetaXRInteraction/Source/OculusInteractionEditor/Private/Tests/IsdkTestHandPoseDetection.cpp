@@ -177,3 +177,110 @@ bool IsdkRigPinchRecognizerTests::RunTest(const FString& Parameters)
 
   return true;
 }
+
+namespace
+{
+// Reference implementation of the per bone update that UIsdkHandMeshComponent used before the
+// joint poses were written into the bone space buffer in a single pass.
+void ApplyJointPosesByName(UIsdkHandMeshComponent& HandMesh, const TArray<FTransform>& JointPoses)
+{
+  constexpr auto WristSpace = EBoneSpaces::Type::ComponentSpace;
+  for (int BoneId = 0; BoneId < UIsdkHandData::GetNumJoints(); BoneId++)
+  {
+    const FName BoneName = HandMesh.MappedBoneNames[BoneId];
+    FTransform BoneTransform = HandMesh.GetBoneTransformByName(BoneName, WristSpace);
+    BoneTransform.SetLocation(JointPoses[BoneId].GetLocation());
+    BoneTransform.SetRotation(JointPoses[BoneId].GetRotation());
+    HandMesh.SetBoneTransformByName(BoneName, BoneTransform, WristSpace);
+  }
+}
+} // namespace
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    IsdkHandMeshUpdateSkeletonBenchmark,
+    "InteractionSDK.OculusInteraction.Source.OculusInteractionEditor.Private.Tests.HandPose.IsdkHandMeshUpdateSkeletonBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool IsdkHandMeshUpdateSkeletonBenchmark::RunTest(const FString& Parameters)
+{
+  isdk::test::AddInitPieTestSteps(this);
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSpawnHandPoseDetectionActor(this));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestHandPoseDetectionLambda(
+      this,
+      [](FAutomationTestBase* Test, AIsdkTestHandPoseDetectionActor& TestActor)
+      {
+        UIsdkHandMeshComponent& HandMesh = *TestActor.TestTrackedHandVisual;
+        UIsdkHandData* HandData =
+            IIsdkIHandJoints::Execute_GetHandData(TestActor.TestDataSourceExternal);
+        TestActor.TestDataSourceExternal->SetHandJointsToPalmGrabPose();
+        const TArray<FTransform> PalmGrabPoses = HandData->GetJointPoses();
+        TestActor.TestDataSourceExternal->SetHandJointsToPinchPose();
+        const TArray<FTransform> PinchPoses = HandData->GetJointPoses();
+        const TArray<FTransform>& JointPoses = HandData->GetJointPoses();
+
+        constexpr int32 Iterations = 1000;
+        FActorComponentTickFunction* TickFunction = &HandMesh.PrimaryComponentTick;
+
+        // Alternate between two poses so every tick has a new snapshot to apply, ending on the
+        // pinch pose
+        const double TickStartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+          HandData->GetJointPoses() = (Iteration % 2) ? PinchPoses : PalmGrabPoses;
+          HandData->PublishSnapshot();
+          HandMesh.TickComponent(0.f, LEVELTICK_All, TickFunction);
+        }
+        const double TickDuration = FPlatformTime::Seconds() - TickStartTime;
+        const TArray<FTransform> BatchedTransforms = HandMesh.GetBoneSpaceTransforms();
+
+        // A hand that holds its pose publishes the same snapshot every frame
+        const double UnchangedTickStartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+          HandData->PublishSnapshot();
+          HandMesh.TickComponent(0.f, LEVELTICK_All, TickFunction);
+        }
+        const double UnchangedTickDuration = FPlatformTime::Seconds() - UnchangedTickStartTime;
+
+        const double ByNameStartTime = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+          ApplyJointPosesByName(HandMesh, JointPoses);
+        }
+        const double ByNameDuration = FPlatformTime::Seconds() - ByNameStartTime;
+
+        // The joints are already in place, so the per bone update must not move any bone
+        const TArray<FTransform>& ByNameTransforms = HandMesh.GetBoneSpaceTransforms();
+        Test->TestEqual(
+            TEXT("Both updates should write the same number of bones."),
+            BatchedTransforms.Num(),
+            ByNameTransforms.Num());
+        for (int32 BoneIndex = 0;
+             BoneIndex < FMath::Min(BatchedTransforms.Num(), ByNameTransforms.Num());
+             ++BoneIndex)
+        {
+          if (!BatchedTransforms[BoneIndex].Equals(ByNameTransforms[BoneIndex], 1e-3))
+          {
+            Test->AddError(FString::Printf(
+                TEXT("Bone %d differs between the batched and the per bone update."), BoneIndex));
+            break;
+          }
+        }
+
+        Test->AddInfo(FString::Printf(
+            TEXT("TickComponent with batched bone writes: %.3f us per hand"),
+            TickDuration * 1e6 / Iterations));
+        Test->AddInfo(FString::Printf(
+            TEXT("TickComponent with an unchanged snapshot: %.3f us per hand"),
+            UnchangedTickDuration * 1e6 / Iterations));
+        Test->AddInfo(FString::Printf(
+            TEXT("Per bone GetBoneTransformByName/SetBoneTransformByName: %.3f us per hand"),
+            ByNameDuration * 1e6 / Iterations));
+      }));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+
+  return true;
+}
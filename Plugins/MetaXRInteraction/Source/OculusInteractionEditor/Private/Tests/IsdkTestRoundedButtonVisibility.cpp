@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IsdkTestRoundedButtonVisibility.h"
+#include "IsdkCommonTestCommands.h"
+#include "Interaction/IsdkPokeInteractable.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FIsdkTestSpawnRoundedButtonActor);
+bool FIsdkTestSpawnRoundedButtonActor::Update()
+{
+  AIsdkTestRoundedButtonActor::Setup();
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkTestSetRoundedButtonVisibility,
+    FAutomationTestBase*,
+    Test,
+    bool,
+    bVisible);
+bool FIsdkTestSetRoundedButtonVisibility::Update()
+{
+  AIsdkTestRoundedButtonActor* ButtonActor = &AIsdkTestRoundedButtonActor::Get();
+  Test->TestTrue("Rounded Button Actor was not created", IsValid(ButtonActor));
+  // Like hiding a button in a menu, the meshes only follow once the change propagated
+  ButtonActor->TestRoundedButton->SetVisibility(bVisible, true);
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkTestSetRoundedButtonPolling,
+    FAutomationTestBase*,
+    Test,
+    bool,
+    bPoll);
+bool FIsdkTestSetRoundedButtonPolling::Update()
+{
+  AIsdkTestRoundedButtonActor* ButtonActor = &AIsdkTestRoundedButtonActor::Get();
+  Test->TestTrue("Rounded Button Actor was not created", IsValid(ButtonActor));
+  ButtonActor->TestRoundedButton->SetPollMeshVisibility(bPoll);
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(
+    FIsdkTestCheckRoundedButtonState,
+    FAutomationTestBase*,
+    Test,
+    bool,
+    bExpectedInteractableVisible,
+    bool,
+    bExpectedTicking,
+    FString,
+    TestStepName);
+bool FIsdkTestCheckRoundedButtonState::Update()
+{
+  const UIsdkRoundedButtonComponent* Button =
+      AIsdkTestRoundedButtonActor::Get().TestRoundedButton;
+  Test->TestTrue(
+      *FString::Printf(TEXT("%s: Poke interactable visibility"), *TestStepName),
+      Button->GetPokeInteractable()->IsVisible() == bExpectedInteractableVisible);
+  Test->TestTrue(
+      *FString::Printf(TEXT("%s: Rounded button ticking"), *TestStepName),
+      Button->IsComponentTickEnabled() == bExpectedTicking);
+  return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FIsdkTestStartRoundedButtonIdle);
+bool FIsdkTestStartRoundedButtonIdle::Update()
+{
+  AIsdkTestRoundedButtonActor& ButtonActor = AIsdkTestRoundedButtonActor::Get();
+  ButtonActor.IdleStartTickTime =
+      ButtonActor.TestRoundedButton->PrimaryComponentTick.GetLastTickGameTimeSeconds();
+  return true;
+}
+
+// Every tick of the button adds to STAT_IsdkInteractableComponentTicks, so the stat stays at zero
+// as long as the button doesn't tick
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkTestCheckRoundedButtonIdle,
+    FAutomationTestBase*,
+    Test,
+    FString,
+    TestStepName);
+bool FIsdkTestCheckRoundedButtonIdle::Update()
+{
+  const AIsdkTestRoundedButtonActor& ButtonActor = AIsdkTestRoundedButtonActor::Get();
+  Test->TestEqual(
+      *FString::Printf(TEXT("%s: Rounded button did not tick while idle"), *TestStepName),
+      ButtonActor.TestRoundedButton->PrimaryComponentTick.GetLastTickGameTimeSeconds(),
+      ButtonActor.IdleStartTickTime);
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    IsdkRoundedButtonVisibilityTests,
+    "InteractionSDK.OculusInteraction.Source.OculusInteractionEditor.Private.Tests.IsdkRoundedButtonVisibilityTests",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool IsdkRoundedButtonVisibilityTests::RunTest(const FString& Parameters)
+{
+  isdk::test::AddInitPieTestSteps(this);
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSpawnRoundedButtonActor());
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckRoundedButtonState(
+      this, true, false, TEXT("Initial rounded button check")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestStartRoundedButtonIdle());
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(
+      FIsdkTestCheckRoundedButtonIdle(this, TEXT("Rounded button check after spawning")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetRoundedButtonVisibility(this, false));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckRoundedButtonState(
+      this, false, false, TEXT("Rounded button check after hiding the button.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestStartRoundedButtonIdle());
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(
+      FIsdkTestCheckRoundedButtonIdle(this, TEXT("Rounded button check while hidden")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetRoundedButtonVisibility(this, true));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckRoundedButtonState(
+      this, true, false, TEXT("Rounded button check after showing the button again.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetRoundedButtonPolling(this, true));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckRoundedButtonState(
+      this, true, true, TEXT("Rounded button check after turning polling on at runtime.")));
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestSetRoundedButtonPolling(this, false));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(isdk::test::OneFrameDelay));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkTestCheckRoundedButtonState(
+      this, true, false, TEXT("Rounded button check after turning polling off at runtime.")));
+
+  ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+
+  return true;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+
+#include "IsdkRoundedButtonComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Editor.h"
+
+#include "IsdkTestRoundedButtonVisibility.generated.h"
+
+UCLASS()
+class OCULUSINTERACTIONEDITOR_API AIsdkTestRoundedButtonActor : public AActor
+{
+  GENERATED_BODY()
+ public:
+  AIsdkTestRoundedButtonActor()
+  {
+    const auto Root = CreateDefaultSubobject<USceneComponent>(FName("Root"));
+    SetRootComponent(Root);
+
+    TestRoundedButton =
+        CreateDefaultSubobject<UIsdkRoundedButtonComponent>(TEXT("TestRoundedButton"));
+    TestRoundedButton->SetupAttachment(RootComponent);
+  }
+
+  static bool Setup()
+  {
+    // No getting the level dirty
+    FActorSpawnParameters ActorParameters{};
+    ActorParameters.bNoFail = true;
+    UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+
+    const auto TestActor = TestWorld->SpawnActor<AIsdkTestRoundedButtonActor>(
+        AIsdkTestRoundedButtonActor::StaticClass(), ActorParameters);
+    return ensure(TestActor);
+  }
+
+  static AIsdkTestRoundedButtonActor& Get()
+  {
+    const UWorld* TestWorld = GEditor->GetPIEWorldContext()->World();
+    check(TestWorld);
+    AIsdkTestRoundedButtonActor* Instance = Cast<AIsdkTestRoundedButtonActor, AActor>(
+        UGameplayStatics::GetActorOfClass(TestWorld, AIsdkTestRoundedButtonActor::StaticClass()));
+    check(Instance);
+    return *Instance;
+  }
+
+  UPROPERTY()
+  UIsdkRoundedButtonComponent* TestRoundedButton{};
+
+  // Game time of the last tick of the button when the idle check started
+  float IdleStartTickTime = 0.f;
+};
@@ -24,10 +24,13 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "IsdkFunctionLibrary.h"
+#include "OculusInteractionStats.h"
 
 UIsdkInteractableWidgetComponent::UIsdkInteractableWidgetComponent()
 {
+  // Only ticks to sync the interactables after a visibility change, or when polling
   PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
 
   SelectedHoveredAudio = CreateDefaultSubobject<UAudioComponent>(FName("Selected Hovered Audio"));
   SelectedHoveredAudio->SetupAttachment(this);
@@ -200,6 +203,9 @@ void UIsdkInteractableWidgetComponent::BeginPlay()
 
   PointableWidget->WidgetEventDelegate.AddUniqueDynamic(
       WidgetEventAudioPlayer, &UIsdkWidgetEventAudioPlayer::HandleWidgetStateChanged);
+
+  SyncInteractableVisibility();
+  SetComponentTickEnabled(bPollWidgetVisibility);
 }
 
 void UIsdkInteractableWidgetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -216,6 +222,17 @@ void UIsdkInteractableWidgetComponent::TickComponent(
     FActorComponentTickFunction* ThisTickFunction)
 {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  INC_DWORD_STAT(STAT_IsdkInteractableComponentTicks);
+
+  SyncInteractableVisibility();
+  if (!bPollWidgetVisibility)
+  {
+    SetComponentTickEnabled(false);
+  }
+}
+
+void UIsdkInteractableWidgetComponent::SyncInteractableVisibility()
+{
   auto IsWidgetVisible = Widget->IsVisible();
   if (IsValid(PokeInteractable))
   {
@@ -227,6 +244,33 @@ void UIsdkInteractableWidgetComponent::TickComponent(
   }
 }
 
+void UIsdkInteractableWidgetComponent::OnVisibilityChanged()
+{
+  Super::OnVisibilityChanged();
+  RequestVisibilitySync();
+}
+
+void UIsdkInteractableWidgetComponent::OnHiddenInGameChanged()
+{
+  Super::OnHiddenInGameChanged();
+  RequestVisibilitySync();
+}
+
+void UIsdkInteractableWidgetComponent::SetPollWidgetVisibility(bool bPoll)
+{
+  bPollWidgetVisibility = bPoll;
+  // The next tick syncs once more and keeps ticking only if polling is on
+  RequestVisibilitySync();
+}
+
+void UIsdkInteractableWidgetComponent::RequestVisibilitySync()
+{
+  if (HasBegunPlay())
+  {
+    SetComponentTickEnabled(true);
+  }
+}
+
 #if WITH_EDITOR
 
 bool UIsdkInteractableWidgetComponent::CanEditChange(const FProperty* InProperty) const
@@ -26,11 +26,14 @@
 #include "UObject/ConstructorHelpers.h"
 #include "Materials/Material.h"
 #include "IsdkFunctionLibrary.h"
+#include "OculusInteractionStats.h"
 
 // Sets default values for this component's properties
 UIsdkRoundedButtonComponent::UIsdkRoundedButtonComponent()
 {
+  // Only ticks to sync the interactable after a visibility change, or when polling
   PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
   bAutoActivate = true;
   bTwoSidedMaterial = true;
 
@@ -258,6 +261,9 @@ void UIsdkRoundedButtonComponent::BeginPlay()
   PointerEventAudioPlayer->SetPointable(PokeInteractable);
   PointerEventAudioPlayer->SetSelectAudio(InteractionButtonPress);
   PointerEventAudioPlayer->SetUnselectAudio(InteractionButtonRelease);
+
+  SyncInteractableVisibility();
+  SetComponentTickEnabled(bPollMeshVisibility);
 }
 
 void UIsdkRoundedButtonComponent::TickComponent(
@@ -266,6 +272,17 @@ void UIsdkRoundedButtonComponent::TickComponent(
     FActorComponentTickFunction* ThisTickFunction)
 {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+  INC_DWORD_STAT(STAT_IsdkInteractableComponentTicks);
+
+  SyncInteractableVisibility();
+  if (!bPollMeshVisibility)
+  {
+    SetComponentTickEnabled(false);
+  }
+}
+
+void UIsdkRoundedButtonComponent::SyncInteractableVisibility()
+{
   // If the button mesh and the backplane are invisible then the interactable should not be
   // interactive.
   auto InteractableVisibility = ButtonMesh->IsVisible() || BackplaneMesh->IsVisible();
@@ -275,6 +292,33 @@ void UIsdkRoundedButtonComponent::TickComponent(
   }
 }
 
+void UIsdkRoundedButtonComponent::OnVisibilityChanged()
+{
+  Super::OnVisibilityChanged();
+  RequestVisibilitySync();
+}
+
+void UIsdkRoundedButtonComponent::OnHiddenInGameChanged()
+{
+  Super::OnHiddenInGameChanged();
+  RequestVisibilitySync();
+}
+
+void UIsdkRoundedButtonComponent::SetPollMeshVisibility(bool bPoll)
+{
+  bPollMeshVisibility = bPoll;
+  // The next tick syncs once more and keeps ticking only if polling is on
+  RequestVisibilitySync();
+}
+
+void UIsdkRoundedButtonComponent::RequestVisibilitySync()
+{
+  if (HasBegunPlay())
+  {
+    SetComponentTickEnabled(true);
+  }
+}
+
 void UIsdkRoundedButtonComponent::Initialize()
 {
   if (!bInitialized)
@@ -335,6 +379,7 @@ void UIsdkRoundedButtonComponent::UpdateProperties()
   ButtonVisualProps.OutlineColor.A = 0.0;
 
   BackplaneMesh->SetVisibility(CreateBackplane);
+  RequestVisibilitySync();
   if (CreateBackplane)
   {
     UIsdkRoundedBoxFunctionLibrary::SetRoundedBoxMaterialParameters(
@@ -84,6 +84,20 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkInteractableWidgetComponent : public U
   }
   virtual void DestroyComponent(bool bPromoteChildren = false) override;
 
+  /* Mirrors the visibility of the widget onto the poke and ray interactables. Happens
+   * automatically when the visibility of this component changes, call it after changing the
+   * visibility of the widget component directly. */
+  UFUNCTION(BlueprintCallable, Category = InteractionSDK)
+  void SyncInteractableVisibility();
+
+  UFUNCTION(BlueprintSetter, Category = InteractionSDK)
+  void SetPollWidgetVisibility(bool bPoll);
+  UFUNCTION(BlueprintGetter, Category = InteractionSDK)
+  bool GetPollWidgetVisibility() const
+  {
+    return bPollWidgetVisibility;
+  }
+
  private:
   // Instanced (created in constructor)
   UPROPERTY(BlueprintGetter = GetWidget, VisibleDefaultsOnly, Category = InteractionSDK)
@@ -138,6 +152,11 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkInteractableWidgetComponent : public U
       float DeltaTime,
       ELevelTick TickType,
       FActorComponentTickFunction* ThisTickFunction) override;
+  virtual void OnVisibilityChanged() override;
+  virtual void OnHiddenInGameChanged() override;
+  // The widget only receives a propagated visibility change after this component, so the sync
+  // happens on the next tick
+  void RequestVisibilitySync();
 
 #if WITH_EDITOR
   virtual bool CanEditChange(const FProperty* InProperty) const override;
@@ -225,4 +244,14 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkInteractableWidgetComponent : public U
       BlueprintReadOnly,
       Meta = (ExposeOnSpawn = true))
   TSubclassOf<UUserWidget> WidgetClass;
+  /* Checks the visibility of the widget every frame instead of only when the visibility of this
+   * component changes. Only needed if the widget component is hidden directly and
+   * SyncInteractableVisibility is not called afterwards. */
+  UPROPERTY(
+      Category = "InteractionSDK|Widget Component",
+      EditAnywhere,
+      BlueprintGetter = GetPollWidgetVisibility,
+      BlueprintSetter = SetPollWidgetVisibility,
+      Meta = (ExposeOnSpawn = true))
+  bool bPollWidgetVisibility = false;
 };
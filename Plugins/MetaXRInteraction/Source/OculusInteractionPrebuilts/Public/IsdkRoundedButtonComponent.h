@@ -65,6 +65,20 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkRoundedButtonComponent : public UScene
 
   virtual void DestroyComponent(bool bPromoteChildren = false) override;
 
+  /* Makes the poke interactable interactive only while the button mesh or the backplane is
+   * visible. Happens automatically when the visibility of this component changes, call it after
+   * changing the visibility of the meshes directly. */
+  UFUNCTION(BlueprintCallable, Category = InteractionSDK)
+  void SyncInteractableVisibility();
+
+  UFUNCTION(BlueprintSetter, Category = InteractionSDK)
+  void SetPollMeshVisibility(bool bPoll);
+  UFUNCTION(BlueprintGetter, Category = InteractionSDK)
+  bool GetPollMeshVisibility() const
+  {
+    return bPollMeshVisibility;
+  }
+
 #if WITH_EDITOR
   void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent);
 #endif
@@ -95,6 +109,16 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkRoundedButtonComponent : public UScene
   UPROPERTY()
   UStaticMeshComponent* BackplaneMesh;
 
+  /* Checks the visibility of the meshes every frame instead of only when the visibility of this
+   * component changes. Only needed if the meshes are hidden directly and
+   * SyncInteractableVisibility is not called afterwards. */
+  UPROPERTY(
+      Category = InteractionSDK,
+      EditAnywhere,
+      BlueprintGetter = GetPollMeshVisibility,
+      BlueprintSetter = SetPollMeshVisibility)
+  bool bPollMeshVisibility = false;
+
   void SetDefaultValues();
   void SetupTextComponent();
   void UpdateProperties();
@@ -105,6 +129,11 @@ class OCULUSINTERACTIONPREBUILTS_API UIsdkRoundedButtonComponent : public UScene
       float DeltaTime,
       enum ELevelTick TickType,
       FActorComponentTickFunction* ThisTickFunction) override;
+  virtual void OnVisibilityChanged() override;
+  virtual void OnHiddenInGameChanged() override;
+  // The meshes only receive a propagated visibility change after this component, so the sync
+  // happens on the next tick
+  void RequestVisibilitySync();
 
  public:
   UPROPERTY(
@@ -8,6 +8,7 @@ LICENSE file in the root directory of this source tree.
 
 #include "AnimNode_OculusXRBodyTracking.h"
 #include "OculusXRAnimNodeBodyRetargeter.h"
+#include "OculusXRBodyRetargetingJobs.h"
 #include "OculusXRMovement.h"
 #include "OculusXRMRFunctionLibrary.h"
 #include "OculusXRRetargeting.h"
@@ -57,8 +58,8 @@ void FAnimNode_OculusXRBodyTracking::Evaluate_AnyThread(FPoseContext& Output)
 		return;
 	}
 
-	FOculusXRBodyState BodyState;
-	OculusXRMovement::GetBodyState(BodyState, Scale);
+	// Wait for the frame prepared by the batch before touching the retargeter
+	const bool bHasPreparedFrame = RetargeterInstance && FOculusXRBodyRetargetingJobs::Get().WaitForPreparedFrame(static_cast<FOculusXRAnimNodeBodyRetargeter*>(RetargeterInstance.Get()));
 
 	if (!RetargeterInstance)
 	{
@@ -69,13 +70,27 @@ void FAnimNode_OculusXRBodyTracking::Evaluate_AnyThread(FPoseContext& Output)
 	{
 		RetargeterInstance->Initialize(RetargetingMode, RootMotionBehavior, ForwardMesh, &BoneRemapping);
 	}
-	if (!RetargeterInstance->RetargetFromBodyState(BodyState, SkeletalMeshComponent, Scale, Output))
+
+	const TSharedPtr<FOculusXRAnimNodeBodyRetargeter> AnimNodeRetargeter = StaticCastSharedPtr<FOculusXRAnimNodeBodyRetargeter>(RetargeterInstance);
+	bool bRetargeted = bHasPreparedFrame && AnimNodeRetargeter->RetargetPreparedFrame(SkeletalMeshComponent, Scale, Output.Pose);
+	if (!bRetargeted)
+	{
+		FOculusXRBodyState BodyState;
+		OculusXRMovement::GetBodyState(BodyState, Scale);
+		bRetargeted = RetargeterInstance->RetargetFromBodyState(BodyState, SkeletalMeshComponent, Scale, Output);
+	}
+	if (!bRetargeted)
 	{
 		if (SkeletalMeshComponent && SkeletalMeshComponent->GetWorld()->IsGameWorld())
 		{
 			UE_LOG(LogOculusXRRetargeting, Warning, TEXT("No valid delta rotations or skeletons"));
 		}
 	}
+	else
+	{
+		// Let the next frame be computed together with all other avatars
+		FOculusXRBodyRetargetingJobs::Get().RequestNextFrame(AnimNodeRetargeter, Scale);
+	}
 	RetargeterInstance->SetDebugPoseMode(DebugPoseMode);
 	RetargeterInstance->SetDebugDrawMode(DebugDrawMode);
 }
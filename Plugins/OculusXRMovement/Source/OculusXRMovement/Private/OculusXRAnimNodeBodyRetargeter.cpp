@@ -125,6 +125,7 @@ void FOculusXRAnimNodeBodyRetargeter::Initialize(
 
 	// Ensure we force an update to our Skeleton
 	SourceReferenceInfo.Invalidate();
+	PreparedFrame.bIsValid = false;
 }
 
 bool FOculusXRAnimNodeBodyRetargeter::IsInitialized() const
@@ -138,7 +139,7 @@ bool FOculusXRAnimNodeBodyRetargeter::UpdateSkeleton(
 	const USkeletalMeshComponent* SkeletalMeshComponent,
 	const float WorldScale)
 {
-	if (BodyState.IsActive && IsInitialized() && SourceReferenceInfo.RequiresUpdate(BodyState.SkeletonChangedCount, BoneContainer.GetSerialNumber()) && OculusXRMovement::GetBodySkeleton(SourceReferenceInfo.SourceReferenceSkeleton, WorldScale))
+	if (BodyState.IsActive && IsInitialized() && SourceReferenceInfo.RequiresUpdate(BodyState.SkeletonChangedCount, BoneContainer.GetSerialNumber()) && GetBodySkeleton(SourceReferenceInfo.SourceReferenceSkeleton, WorldScale))
 
 	{
 #if OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
@@ -212,6 +213,8 @@ bool FOculusXRAnimNodeBodyRetargeter::UpdateSkeleton(
 
 		InitializeScaleAndOffsetData();
 
+		BuildFrameRetargetPlan();
+
 #if OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
 		if (SkeletalMeshComponent && (DebugDrawMode == EOculusXRBodyDebugDrawMode::RestPose || DebugDrawMode == EOculusXRBodyDebugDrawMode::RestPoseWithMapping))
 
@@ -239,10 +242,15 @@ bool FOculusXRAnimNodeBodyRetargeter::UpdateSkeleton(
 	return SourceReferenceInfo.IsValid();
 }
 
+bool FOculusXRAnimNodeBodyRetargeter::GetBodySkeleton(FOculusXRBodySkeleton& OutSkeleton, const float WorldScale) const
+{
+	return OculusXRMovement::GetBodySkeleton(OutSkeleton, WorldScale);
+}
+
 bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 	const FOculusXRBodyState& BodyState,
 	const USkeletalMeshComponent* SkeletalMeshComponent,
-	FPoseContext& Output)
+	FCompactPose& OutPose)
 {
 	// Sanity Check - these should all be valid for this function to execute
 	if (!(SkeletalMeshComponent && SourceReferenceInfo.IsValid()))
@@ -250,25 +258,32 @@ bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 		return false;
 	}
 
-	FCSPose<FCompactPose> MeshPoses;
-	MeshPoses.InitPose(Output.Pose);
-	TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>> FramePoses;
+	ComputeFrameTransforms(BodyState);
+	ApplyFrameTransforms(BodyState, SkeletalMeshComponent, OutPose);
+	return true;
+}
 
-	FramePoses.Reserve(TargetAdjustedRestPoseData.GetNumBones());
+void FOculusXRAnimNodeBodyRetargeter::ComputeFrameTransforms(const FOculusXRBodyState& BodyState)
+{
+	// Frame buffers are sized in BuildFrameRetargetPlan, every joint is written below before it's read
+	const int NumJoints = TargetAdjustedRestPoseData.GetNumBones();
+	TArray<FTransform>& FrameTransforms = RetargetPlan.FrameTransforms;
+	TArray<float>& FrameScales = RetargetPlan.FrameScales;
+	check(FrameTransforms.Num() == NumJoints && FrameScales.Num() == NumJoints);
 
 #if OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
 	// Feature to Retarget to Rest Pose ONLY available in non-shipping builds
 	if (DebugPoseMode == EOculusXRBodyDebugPoseMode::RestPose)
 	{
 		// Slam the Rest Pose into the Target
-		for (int iBoneIdx = 0; iBoneIdx < TargetAdjustedRestPoseData.GetNumBones(); ++iBoneIdx)
+		for (int iBoneIdx = 0; iBoneIdx < NumJoints; ++iBoneIdx)
 		{
 			const auto& jointEntry = TargetAdjustedRestPoseData.PoseData[iBoneIdx];
-			FTransform jointFrameTransform = jointEntry.ComponentTransform;
-			FramePoses.Add({ jointEntry.BoneId, jointFrameTransform, jointEntry.componentSpaceScale });
+			FrameTransforms[iBoneIdx] = jointEntry.ComponentTransform;
+			FrameScales[iBoneIdx] = jointEntry.componentSpaceScale;
 		}
 
-		SourceReferenceInfo.LastFrameBodyState = SourceReferenceInfo.SourceSkeleton;
+		SourceReferenceInfo.LastFrameBodyState = SourceReferenceInfo.SourceSkeleton.GetJointDataArray();
 	}
 	else
 #endif // OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
@@ -280,31 +295,33 @@ bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 		// until the operations in the OS complete and we get valid data again.
 		if (BodyState.IsActive)
 		{
-			SourceReferenceInfo.LastFrameBodyState = Factory::FromOculusXRBodyState(BodyState,
-				SourceReferenceInfo.SourceReferenceSkeleton, InitData.TrackingSpaceToComponentSpace, InitData.RootMotionBehavior);
+			Factory::FillFromOculusXRBodyState(BodyState, SourceReferenceInfo.SourceReferenceSkeleton,
+				InitData.TrackingSpaceToComponentSpace, InitData.RootMotionBehavior, SourceReferenceInfo.LastFrameBodyState);
 		}
+		const TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>>& SourceFrameJoints = SourceReferenceInfo.LastFrameBodyState;
 
-		for (int iBoneIdx = 0; iBoneIdx < TargetAdjustedRestPoseData.GetNumBones(); ++iBoneIdx)
+		for (int iBoneIdx = 0; iBoneIdx < NumJoints; ++iBoneIdx)
 		{
 			const auto& jointEntry = TargetAdjustedRestPoseData.PoseData[iBoneIdx];
 			FTransform jointFrameTransform = jointEntry.ComponentTransform;
 			if (jointEntry.ParentIdx != INDEX_NONE)
 			{
 				// Append the Local Transform (We will interpolate Twist Joint Chains later)
-				check(jointEntry.ParentIdx < FramePoses.Num());
-				const FTransform& parentTransform = FramePoses[jointEntry.ParentIdx].Get<FTransform>();
+				check(jointEntry.ParentIdx < iBoneIdx);
+				const FTransform& parentTransform = FrameTransforms[jointEntry.ParentIdx];
 				jointFrameTransform = jointEntry.LocalTransform * parentTransform;
 			}
 
-			const int sourceJointIndex = SourceReferenceInfo.LastFrameBodyState.GetBoneIndex(jointEntry.sourceJointID);
-			if (SourceReferenceInfo.LastFrameBodyState.IsValidIndex(sourceJointIndex))
+			// Joints that aren't tracked this frame have no Bone ID in the source frame
+			const int sourceJointIndex = RetargetPlan.SourceJointIndices[iBoneIdx];
+			if (SourceFrameJoints.IsValidIndex(sourceJointIndex) && SourceFrameJoints[sourceJointIndex].BoneId != EOculusXRBoneID::None)
 			{
 				// If we have a valid Mapping, then Apply the Mapping to Retarget the Joint
-				FTransform retargetedJoint = jointEntry.sourceJointLocalOffset * SourceReferenceInfo.LastFrameBodyState.GetComponentTransform(sourceJointIndex);
+				FTransform retargetedJoint = jointEntry.sourceJointLocalOffset * SourceFrameJoints[sourceJointIndex].ComponentTransform;
 
 				if (IsRotationOnlyRetargetingMode(InitData.RetargetingMode))
 				{
-					if (IsHipOrRootSourceJoint(jointEntry.sourceJointID))
+					if (RetargetPlan.HasFlag(iBoneIdx, FrameRetargetPlan::HipOrRoot))
 					{
 						jointFrameTransform = retargetedJoint;
 					}
@@ -319,55 +336,48 @@ bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 					// If this is a hand joint and our alignment mode is something that doesn't scale the hands
 					// then apply rotation only retargeting to the hand joints to avoid scaling them from the
 					// hand tracking system.
-					const int RightWristBoneIndex = SourceReferenceInfo.SourceToTargetIdxMap.Contains(EOculusXRBoneID::BodyRightHandWrist) ? SourceReferenceInfo.SourceToTargetIdxMap[EOculusXRBoneID::BodyRightHandWrist] : INDEX_NONE;
-					const int LeftWristBoneIndex = SourceReferenceInfo.SourceToTargetIdxMap.Contains(EOculusXRBoneID::BodyLeftHandWrist) ? SourceReferenceInfo.SourceToTargetIdxMap[EOculusXRBoneID::BodyLeftHandWrist] : INDEX_NONE;
-
-					if (InitData.RetargetingMode == EOculusXRBodyRetargetingMode::RotationAndPositionsHandsRotationOnly && (iBoneIdx == RightWristBoneIndex || TargetAdjustedRestPoseData.IsAncestorToBoneIndex(RightWristBoneIndex, iBoneIdx) || iBoneIdx == LeftWristBoneIndex || TargetAdjustedRestPoseData.IsAncestorToBoneIndex(LeftWristBoneIndex, iBoneIdx)))
+					if (InitData.RetargetingMode == EOculusXRBodyRetargetingMode::RotationAndPositionsHandsRotationOnly && RetargetPlan.HasFlag(iBoneIdx, FrameRetargetPlan::WristOrDescendant))
 					{
 						jointFrameTransform.SetRotation(retargetedJoint.GetRotation());
 					}
 					else
 					{
 						// Check to see whether we need to modify the parent orientation due to deformation.
-						if (!IsHipOrRootSourceJoint(jointEntry.sourceJointID) && jointEntry.ParentIdx != INDEX_NONE && jointEntry.sourceJointLocalOffset.GetLocation().Length() > 0.0f)
+						// This is the case if the parent only has one non-twist child joint, we can rotate it
+						// if we're the only child joint that matters.
+						if (RetargetPlan.HasFlag(iBoneIdx, FrameRetargetPlan::AlignsParent))
 						{
-							// Check to see if the parent only has one non-twist child joint.
-							// We can rotate it if we're the only child joint that matters.
 							const auto& parentJointEntry = TargetAdjustedRestPoseData.PoseData[jointEntry.ParentIdx];
-							const int nonTwistChildJointCount = parentJointEntry.GetNonTwistChildJointCount();
-							check(nonTwistChildJointCount > 0);
-							if (parentJointEntry.GetNonTwistChildJointCount() == 1)
+
+							// We're only doing parent rotation here, then propagating to it's child twist joints.
+							// We'll handle the twist joint spacing during the twist joint update below
+
+							// NOTE: The twist joint pass also captures unmapped joints in a chain so that we can apply
+							// twist interpolation.  We don't cache those joints or need to handle those in this pass
+							// since a qualification of those joints is that they only have a single parent and have a
+							// single child that terminates the chain.  There won't be a situation where a sibling joint
+							// should/could affect their rotation.
+
+							// Fix the Parent Rotation to re-align with our translated child joint
+							FTransform& parentComponentTransform = FrameTransforms[jointEntry.ParentIdx];
+							FVector frameRayToCurrentJoint = retargetedJoint.GetLocation() - parentComponentTransform.GetLocation();
+							FVector restPoseRayToCurrentJoint = jointFrameTransform.GetLocation() - parentComponentTransform.GetLocation();
+							frameRayToCurrentJoint.Normalize();
+							restPoseRayToCurrentJoint.Normalize();
+
+							const FQuat alignmentRotationToApply = FQuat::FindBetween(restPoseRayToCurrentJoint, frameRayToCurrentJoint);
+							parentComponentTransform.SetRotation(alignmentRotationToApply * parentComponentTransform.GetRotation());
+
+							// Propagate the rotational change to all siblings on this parent joint that have already been
+							// processed.  The pose is processed in hierarchical order, but there is a chance that a
+							// sibling (and it's chain) may have been processed prior to this joint.  We can determine
+							// if a joint has been processed by comparing it's index against the current joint index.
+							for (int iTwistChild : parentJointEntry.childTwistJoints)
 							{
-								// We're only doing parent rotation here, then propagating to it's child twist joints.
-								// We'll handle the twist joint spacing during the twist joint update below
-
-								// NOTE: The twist joint pass also captures unmapped joints in a chain so that we can apply
-								// twist interpolation.  We don't cache those joints or need to handle those in this pass
-								// since a qualification of those joints is that they only have a single parent and have a
-								// single child that terminates the chain.  There won't be a situation where a sibling joint
-								// should/could affect their rotation.
-
-								// Fix the Parent Rotation to re-align with our translated child joint
-								FTransform& parentComponentTransform = FramePoses[jointEntry.ParentIdx].Get<FTransform>();
-								FVector frameRayToCurrentJoint = retargetedJoint.GetLocation() - parentComponentTransform.GetLocation();
-								FVector restPoseRayToCurrentJoint = jointFrameTransform.GetLocation() - parentComponentTransform.GetLocation();
-								frameRayToCurrentJoint.Normalize();
-								restPoseRayToCurrentJoint.Normalize();
-
-								const FQuat alignmentRotationToApply = FQuat::FindBetween(restPoseRayToCurrentJoint, frameRayToCurrentJoint);
-								parentComponentTransform.SetRotation(alignmentRotationToApply * parentComponentTransform.GetRotation());
-
-								// Propagate the rotational change to all siblings on this parent joint that have already been
-								// processed.  The pose is processed in hierarchical order, but there is a chance that a
-								// sibling (and it's chain) may have been processed prior to this joint.  We can determine
-								// if a joint has been processed by comparing it's index against the number of joints in FramePoses.
-								for (int iTwistChild : parentJointEntry.childTwistJoints)
+								// If we've already processed the child, update it's Frame Transform
+								if (iTwistChild < iBoneIdx)
 								{
-									// If we've already processed the child, update it's Frame Transform
-									if (iTwistChild < FramePoses.Num())
-									{
-										FramePoses[iTwistChild].Get<FTransform>() = TargetAdjustedRestPoseData.GetLocalTransform(iTwistChild) * parentComponentTransform;
-									}
+									FrameTransforms[iTwistChild] = TargetAdjustedRestPoseData.GetLocalTransform(iTwistChild) * parentComponentTransform;
 								}
 							}
 						}
@@ -376,30 +386,45 @@ bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 				}
 			}
 			// DO NOT Scale the joints during update, it will affect the child joint calculation from local space in the loop
-			FramePoses.Add({ jointEntry.BoneId, jointFrameTransform, jointEntry.componentSpaceScale });
+			FrameTransforms[iBoneIdx] = jointFrameTransform;
+			FrameScales[iBoneIdx] = jointEntry.componentSpaceScale;
 		}
 	}
 
 	// Twist Joints
-	ProcessFrameInterpolateTwistJoints(FramePoses);
+	ProcessFrameInterpolateTwistJoints(FrameTransforms);
 
 	// Update the hand scale joint scale
 	if (InitData.RetargetingMode == EOculusXRBodyRetargetingMode::RotationAndPositions)
 	{
 		// Rotation and Positions retargeting is the only mode where the hand sizes are changed based on the frame data
-		if (SourceReferenceInfo.SourceToTargetIdxMap.Contains(EOculusXRBoneID::BodyLeftHandWrist) && SourceReferenceInfo.SourceToTargetIdxMap.Contains(EOculusXRBoneID::BodyRightHandWrist))
+		if (RetargetPlan.LeftWristIdx != INDEX_NONE && RetargetPlan.RightWristIdx != INDEX_NONE)
 		{
-			UpdateScaleForFrame(SourceReferenceInfo.SourceToTargetIdxMap[EOculusXRBoneID::BodyLeftHandWrist], FramePoses);
-			UpdateScaleForFrame(SourceReferenceInfo.SourceToTargetIdxMap[EOculusXRBoneID::BodyRightHandWrist], FramePoses);
+			UpdateScaleForFrame(RetargetPlan.LeftWristIdx, FrameTransforms, FrameScales);
+			UpdateScaleForFrame(RetargetPlan.RightWristIdx, FrameTransforms, FrameScales);
 		}
 	}
+}
+
+void FOculusXRAnimNodeBodyRetargeter::ApplyFrameTransforms(
+	const FOculusXRBodyState& BodyState,
+	const USkeletalMeshComponent* SkeletalMeshComponent,
+	FCompactPose& OutPose)
+{
+	const int NumJoints = TargetAdjustedRestPoseData.GetNumBones();
+	TArray<FTransform>& FrameTransforms = RetargetPlan.FrameTransforms;
+	const TArray<float>& FrameScales = RetargetPlan.FrameScales;
 
-	// Now Apply the FramePoses to the MeshPoses struct
-	for (auto& framePoseEntry : FramePoses)
+	FCSPose<FCompactPose> MeshPoses;
+	MeshPoses.InitPose(OutPose);
+
+	// Now Apply the Frame Transforms to the MeshPoses struct
+	for (int iBoneIdx = 0; iBoneIdx < NumJoints; ++iBoneIdx)
 	{
 		// Apply Scale here so it won't affect child transforms
-		framePoseEntry.Get<FTransform>().SetScale3D(FVector::OneVector * framePoseEntry.Get<float>());
-		MeshPoses.SetComponentSpaceTransform(framePoseEntry.Get<FCompactPoseBoneIndex>(), framePoseEntry.Get<FTransform>());
+		FTransform& frameTransform = FrameTransforms[iBoneIdx];
+		frameTransform.SetScale3D(FVector::OneVector * FrameScales[iBoneIdx]);
+		MeshPoses.SetComponentSpaceTransform(RetargetPlan.TargetBoneIds[iBoneIdx], frameTransform);
 	}
 
 #if OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
@@ -417,35 +442,38 @@ bool FOculusXRAnimNodeBodyRetargeter::ProcessFrameRetargeting(
 		}
 #endif // OCULUS_XR_DEBUG_DRAW_MODIFIED_ROOT_MOTION_BEHAVIOR
 
-		DebugDrawUtility.AddSkeleton(SourceReferenceInfo.LastFrameBodyState, MeshTransform, FColor::Yellow);
+		// The Bone ID lookup of the source frame is only needed for drawing
+		const FOculusXRRetargetSkeletonEOculusXRBoneID LastFrameSkeleton = SourceReferenceInfo.LastFrameBodyState.IsEmpty()
+			? FOculusXRRetargetSkeletonEOculusXRBoneID()
+			: FOculusXRRetargetSkeletonEOculusXRBoneID(SourceReferenceInfo.LastFrameBodyState);
+		DebugDrawUtility.AddSkeleton(LastFrameSkeleton, MeshTransform, FColor::Yellow);
 
 		// Calculate the target skeleton for the Frame
-		FOculusXRRetargetSkeletonFCompactPoseBoneIndex RetargetedSkeleton = Factory::FromComponentSpaceTransformArray(TargetAdjustedRestPoseData, FramePoses);
+		FOculusXRRetargetSkeletonFCompactPoseBoneIndex RetargetedSkeleton = Factory::FromComponentSpaceTransformArray(TargetAdjustedRestPoseData, RetargetPlan.TargetBoneIds, FrameTransforms);
 		DebugDrawUtility.AddSkeleton(RetargetedSkeleton, MeshTransform, FColor::Green);
 
 		if (DebugDrawMode == EOculusXRBodyDebugDrawMode::FramePoseWithMapping)
 		{
-			DebugDrawUtility.AddSkeletonMapping(SourceReferenceInfo.LastFrameBodyState,
+			DebugDrawUtility.AddSkeletonMapping(LastFrameSkeleton,
 				RetargetedSkeleton, SourceReferenceInfo.SourceToTargetIdxMap, MeshTransform, FColor::White);
 		}
 	}
 #endif // OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
 
-	FCSPose<FCompactPose>::ConvertComponentPosesToLocalPosesSafe(MeshPoses, Output.Pose);
-	return true;
+	FCSPose<FCompactPose>::ConvertComponentPosesToLocalPosesSafe(MeshPoses, OutPose);
 }
 
-void FOculusXRAnimNodeBodyRetargeter::ProcessFrameInterpolateTwistJoints(TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const
+void FOculusXRAnimNodeBodyRetargeter::ProcessFrameInterpolateTwistJoints(TArray<FTransform>& FrameTransforms) const
 {
 	// Interpolate Twist Joints
 	for (const auto& twistJointPair : TargetAdjustedRestPoseData.TwistJoints)
 	{
 		const TwistJointEntry& twistJoint = twistJointPair.Value;
 
-		const FTransform& twistComponentTransform = FramePoses[twistJoint.TargetTwistJointIdx].Get<FTransform>();
-		const FTransform& twistParentComponentTranform = FramePoses[twistJoint.TargetTwistParentJointIdx].Get<FTransform>();
-		const FTransform& twistSourceComponentTransform = FramePoses[twistJoint.TargetSourceJointIdx].Get<FTransform>();
-		const FTransform& twistSourceParentTransform = FramePoses[twistJoint.TargetSourceParentJointIdx].Get<FTransform>();
+		const FTransform& twistComponentTransform = FrameTransforms[twistJoint.TargetTwistJointIdx];
+		const FTransform& twistParentComponentTranform = FrameTransforms[twistJoint.TargetTwistParentJointIdx];
+		const FTransform& twistSourceComponentTransform = FrameTransforms[twistJoint.TargetSourceJointIdx];
+		const FTransform& twistSourceParentTransform = FrameTransforms[twistJoint.TargetSourceParentJointIdx];
 
 		// Put the source joint full joint vector in the same local space to our twist joint
 		const FVector FrameParentToSourceRayInTargetLocalSpace = twistParentComponentTranform.GetRotation().Inverse() * (twistSourceComponentTransform.GetLocation() - twistSourceParentTransform.GetLocation());
@@ -472,34 +500,34 @@ void FOculusXRAnimNodeBodyRetargeter::ProcessFrameInterpolateTwistJoints(TArray<
 				twistJoint.weight);
 
 		// Update our frame pose to reflect the twisted rotation
-		FramePoses[twistJoint.TargetTwistJointIdx].Get<FTransform>() = FTransform(adjustedTargetLocalRotation, twistLocalTransform.GetLocation() - localTranslationToSubtract) * twistParentComponentTranform;
+		FrameTransforms[twistJoint.TargetTwistJointIdx] = FTransform(adjustedTargetLocalRotation, twistLocalTransform.GetLocation() - localTranslationToSubtract) * twistParentComponentTranform;
 	}
 }
 
-void FOculusXRAnimNodeBodyRetargeter::UpdateScaleForFrame(const int TargetIndex, TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const
+void FOculusXRAnimNodeBodyRetargeter::UpdateScaleForFrame(const int TargetIndex, const TArray<FTransform>& FrameTransforms, TArray<float>& FrameScales) const
 {
 	if (TargetIndex != INDEX_NONE)
 	{
-		TTuple<float, float> targetIndexTotalJointLengths = GetFrameMaxCurrentAndUnModifiedJointLengths(TargetIndex, FramePoses);
+		TTuple<float, float> targetIndexTotalJointLengths = GetFrameMaxCurrentAndUnModifiedJointLengths(TargetIndex, FrameTransforms);
 		const float Scale = targetIndexTotalJointLengths.Value > 0.0f ? targetIndexTotalJointLengths.Key / targetIndexTotalJointLengths.Value : TargetAdjustedRestPoseData.GlobalComponentSpaceScale;
-		UpdateScaleForFrameRecursive(TargetIndex, Scale, FramePoses);
+		UpdateScaleForFrameRecursive(TargetIndex, Scale, FrameScales);
 	}
 }
 
-void FOculusXRAnimNodeBodyRetargeter::UpdateScaleForFrameRecursive(const int TargetIndex, const float scale, TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const
+void FOculusXRAnimNodeBodyRetargeter::UpdateScaleForFrameRecursive(const int TargetIndex, const float scale, TArray<float>& FrameScales) const
 {
 	if (TargetIndex != INDEX_NONE)
 	{
-		FramePoses[TargetIndex].Get<float>() = scale;
+		FrameScales[TargetIndex] = scale;
 		const TargetSkeletonJointEntry& jointEntry = TargetAdjustedRestPoseData.PoseData[TargetIndex];
 		for (int childIdx : jointEntry.childJoints)
 		{
-			UpdateScaleForFrameRecursive(childIdx, scale, FramePoses);
+			UpdateScaleForFrameRecursive(childIdx, scale, FrameScales);
 		}
 	}
 }
 
-TTuple<float, float> FOculusXRAnimNodeBodyRetargeter::GetFrameMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, const TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses, float currentLength, float unmodifiedLength) const
+TTuple<float, float> FOculusXRAnimNodeBodyRetargeter::GetFrameMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, const TArray<FTransform>& FrameTransforms, float currentLength, float unmodifiedLength) const
 {
 	TTuple<float, float> retVal({ currentLength, unmodifiedLength });
 	if (targetJointIndex != INDEX_NONE)
@@ -507,14 +535,14 @@ TTuple<float, float> FOculusXRAnimNodeBodyRetargeter::GetFrameMaxCurrentAndUnMod
 		const TargetSkeletonJointEntry& jointEntry = TargetAdjustedRestPoseData.PoseData[targetJointIndex];
 		if (!jointEntry.childJoints.IsEmpty())
 		{
-			const FVector parentJointPosition = FramePoses[targetJointIndex].Get<FTransform>().GetLocation();
+			const FVector parentJointPosition = FrameTransforms[targetJointIndex].GetLocation();
 			for (int childIdx : jointEntry.childJoints)
 			{
 				const TargetSkeletonJointEntry& childJointEntry = TargetAdjustedRestPoseData.PoseData[childIdx];
 				const float childUnmodifiedLength = childJointEntry.unmodifiedJointLength;
-				const float childCurrentLength = (FramePoses[childIdx].Get<FTransform>().GetLocation() - parentJointPosition).Length();
+				const float childCurrentLength = (FrameTransforms[childIdx].GetLocation() - parentJointPosition).Length();
 
-				TTuple<float, float> childLengths = GetFrameMaxCurrentAndUnModifiedJointLengths(childIdx, FramePoses, currentLength + childCurrentLength, unmodifiedLength + childUnmodifiedLength);
+				TTuple<float, float> childLengths = GetFrameMaxCurrentAndUnModifiedJointLengths(childIdx, FrameTransforms, currentLength + childCurrentLength, unmodifiedLength + childUnmodifiedLength);
 				if (childLengths.Key > retVal.Key)
 				{
 					retVal = childLengths;
@@ -532,13 +560,66 @@ bool FOculusXRAnimNodeBodyRetargeter::RetargetFromBodyState(
 	const float WorldScale,
 	FPoseContext& Output)
 {
-	if (SkeletalMeshComponent && UpdateSkeleton(BodyState, Output.Pose.GetBoneContainer(), SkeletalMeshComponent, WorldScale))
+	return RetargetFromBodyState(BodyState, SkeletalMeshComponent, WorldScale, Output.Pose);
+}
+
+bool FOculusXRAnimNodeBodyRetargeter::RetargetFromBodyState(
+	const FOculusXRBodyState& BodyState,
+	const USkeletalMeshComponent* SkeletalMeshComponent,
+	const float WorldScale,
+	FCompactPose& OutPose)
+{
+	if (SkeletalMeshComponent && UpdateSkeleton(BodyState, OutPose.GetBoneContainer(), SkeletalMeshComponent, WorldScale))
 	{
-		return ProcessFrameRetargeting(BodyState, SkeletalMeshComponent, Output);
+		return ProcessFrameRetargeting(BodyState, SkeletalMeshComponent, OutPose);
 	}
 	return false;
 }
 
+bool FOculusXRAnimNodeBodyRetargeter::PrepareFrame(const FOculusXRBodyState& BodyState)
+{
+	PreparedFrame.bIsValid = false;
+
+	// The plan has to match the source skeleton of this frame. If the skeleton changed, the whole
+	// frame is retargeted during evaluation after UpdateSkeleton rebuilt the plan.
+	if (!IsInitialized() || !SourceReferenceInfo.IsValid() || (BodyState.IsActive && BodyState.SkeletonChangedCount != SourceReferenceInfo.SourceChangeCount))
+	{
+		return false;
+	}
+
+	PreparedFrame.BodyState = BodyState;
+	PreparedFrame.BoneContainerSerialNumber = SourceReferenceInfo.BoneContainerSerialNumber;
+	ComputeFrameTransforms(PreparedFrame.BodyState);
+	PreparedFrame.bIsValid = true;
+	return true;
+}
+
+bool FOculusXRAnimNodeBodyRetargeter::RetargetPreparedFrame(
+	const USkeletalMeshComponent* SkeletalMeshComponent,
+	const float WorldScale,
+	FCompactPose& OutPose)
+{
+	if (!PreparedFrame.bIsValid || !SkeletalMeshComponent)
+	{
+		return false;
+	}
+	PreparedFrame.bIsValid = false;
+
+	if (!UpdateSkeleton(PreparedFrame.BodyState, OutPose.GetBoneContainer(), SkeletalMeshComponent, WorldScale))
+	{
+		return false;
+	}
+
+	// The bone container changed (LOD switch or re-initialization), so the plan the frame was prepared with is gone
+	if (PreparedFrame.BoneContainerSerialNumber != SourceReferenceInfo.BoneContainerSerialNumber)
+	{
+		ComputeFrameTransforms(PreparedFrame.BodyState);
+	}
+
+	ApplyFrameTransforms(PreparedFrame.BodyState, SkeletalMeshComponent, OutPose);
+	return true;
+}
+
 void FOculusXRAnimNodeBodyRetargeter::SetTargetToTPose()
 {
 	TMap<int, TArray<int>> AncestorToChildTPoseAlignmentMap;
@@ -1045,6 +1126,53 @@ void FOculusXRAnimNodeBodyRetargeter::InitializeScaleAndOffsetData()
 	}
 }
 
+void FOculusXRAnimNodeBodyRetargeter::BuildFrameRetargetPlan()
+{
+	const int NumJoints = TargetAdjustedRestPoseData.GetNumBones();
+	RetargetPlan.Reset(NumJoints);
+
+	// The cached frame belongs to the previous source skeleton, the next active frame will refill it
+	SourceReferenceInfo.LastFrameBodyState.Reset();
+
+	const int* RightWristBoneIndex = SourceReferenceInfo.SourceToTargetIdxMap.Find(EOculusXRBoneID::BodyRightHandWrist);
+	const int* LeftWristBoneIndex = SourceReferenceInfo.SourceToTargetIdxMap.Find(EOculusXRBoneID::BodyLeftHandWrist);
+	RetargetPlan.RightWristIdx = RightWristBoneIndex ? *RightWristBoneIndex : INDEX_NONE;
+	RetargetPlan.LeftWristIdx = LeftWristBoneIndex ? *LeftWristBoneIndex : INDEX_NONE;
+
+	for (int i = 0; i < NumJoints; ++i)
+	{
+		const TargetSkeletonJointEntry& jointEntry = TargetAdjustedRestPoseData.PoseData[i];
+		RetargetPlan.TargetBoneIds[i] = jointEntry.BoneId;
+
+		// Frame joints are stored at the same index as in the source rest skeleton
+		RetargetPlan.SourceJointIndices[i] = SourceReferenceInfo.SourceSkeleton.GetBoneIndex(jointEntry.sourceJointID);
+
+		uint8 Flags = 0;
+		if (IsHipOrRootSourceJoint(jointEntry.sourceJointID))
+		{
+			Flags |= FrameRetargetPlan::HipOrRoot;
+		}
+
+		if (i == RetargetPlan.RightWristIdx || TargetAdjustedRestPoseData.IsAncestorToBoneIndex(RetargetPlan.RightWristIdx, i)
+			|| i == RetargetPlan.LeftWristIdx || TargetAdjustedRestPoseData.IsAncestorToBoneIndex(RetargetPlan.LeftWristIdx, i))
+		{
+			Flags |= FrameRetargetPlan::WristOrDescendant;
+		}
+
+		if (!IsHipOrRootSourceJoint(jointEntry.sourceJointID) && jointEntry.ParentIdx != INDEX_NONE && jointEntry.sourceJointLocalOffset.GetLocation().Length() > 0.0f)
+		{
+			const int nonTwistChildJointCount = TargetAdjustedRestPoseData.PoseData[jointEntry.ParentIdx].GetNonTwistChildJointCount();
+			check(nonTwistChildJointCount > 0);
+			if (nonTwistChildJointCount == 1)
+			{
+				Flags |= FrameRetargetPlan::AlignsParent;
+			}
+		}
+
+		RetargetPlan.Flags[i] = Flags;
+	}
+}
+
 TTuple<float, float> FOculusXRAnimNodeBodyRetargeter::GetMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, float currentLength, float unmodifiedLength) const
 {
 	TTuple<float, float> retVal({ currentLength, unmodifiedLength });
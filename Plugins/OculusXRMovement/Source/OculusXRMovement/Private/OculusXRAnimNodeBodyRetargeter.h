@@ -18,7 +18,7 @@ LICENSE file in the root directory of this source tree.
 #define OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW 0
 #endif // !UE_BUILD_SHIPPING
 
-class FOculusXRAnimNodeBodyRetargeter : public FOculusXRBodyRetargeter
+class OCULUSXRRETARGETING_API FOculusXRAnimNodeBodyRetargeter : public FOculusXRBodyRetargeter
 {
 public:
 	FOculusXRAnimNodeBodyRetargeter() {}
@@ -40,6 +40,25 @@ public:
 	virtual EOculusXRBodyRetargetingMode GetRetargetingMode() override { return InitData.RetargetingMode; }
 	virtual EOculusXRBodyRetargetingRootMotionBehavior GetRootMotionBehavior() { return InitData.RootMotionBehavior; }
 
+	// Same as above, for callers that only have the pose
+	bool RetargetFromBodyState(const FOculusXRBodyState& BodyState,
+		const USkeletalMeshComponent* SkeletalMeshComponent,
+		const float WorldScale,
+		FCompactPose& OutPose);
+
+	// RetargetFromBodyState split in two for FOculusXRBodyRetargetingJobs. PrepareFrame computes the
+	// frame transforms from the body state without a pose and can run on any worker thread.
+	// RetargetPreparedFrame then writes them into the pose during evaluation. It returns false if no
+	// frame was prepared, in which case the caller should use RetargetFromBodyState.
+	bool PrepareFrame(const FOculusXRBodyState& BodyState);
+	bool RetargetPreparedFrame(const USkeletalMeshComponent* SkeletalMeshComponent,
+		const float WorldScale,
+		FCompactPose& OutPose);
+
+protected:
+	// Reads the reference skeleton of the tracked body when the source skeleton needs an update
+	virtual bool GetBodySkeleton(FOculusXRBodySkeleton& OutSkeleton, const float WorldScale) const;
+
 private:
 	struct InitializationData
 	{
@@ -69,7 +88,47 @@ private:
 		int SourceChangeCount = 0;
 		TMap<EOculusXRBoneID, int> SourceToTargetIdxMap;
 		FOculusXRRetargetSkeletonEOculusXRBoneID SourceSkeleton;
-		FOculusXRRetargetSkeletonEOculusXRBoneID LastFrameBodyState;
+		// Joints of the last valid frame, stored at the same index as in SourceReferenceSkeleton
+		TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>> LastFrameBodyState;
+	};
+
+	// Precompiled in UpdateSkeleton from the target skeleton and the mapping, so that the per frame
+	// pass doesn't need any map lookups, ancestor searches or allocations.
+	struct FrameRetargetPlan
+	{
+		enum JointFlags : uint8
+		{
+			HipOrRoot = 1 << 0,			// Mapped to the source hip or root joint
+			WristOrDescendant = 1 << 1, // Left or right wrist or one of their descendants
+			AlignsParent = 1 << 2,		// Rotates its parent towards itself when positions are retargeted
+		};
+
+		void Reset(const int NumJoints)
+		{
+			TargetBoneIds.Init(FCompactPoseBoneIndex(INDEX_NONE), NumJoints);
+			SourceJointIndices.Init(INDEX_NONE, NumJoints);
+			Flags.Init(0, NumJoints);
+			FrameTransforms.SetNumUninitialized(NumJoints);
+			FrameScales.SetNumUninitialized(NumJoints);
+			LeftWristIdx = INDEX_NONE;
+			RightWristIdx = INDEX_NONE;
+		}
+
+		inline bool HasFlag(const int TargetIdx, const JointFlags Flag) const { return (Flags[TargetIdx] & Flag) != 0; }
+
+		// Per target joint: Bone ID in the pose, index of the mapped joint in the source frame (or NONE)
+		// and combination of JointFlags
+		TArray<FCompactPoseBoneIndex> TargetBoneIds;
+		TArray<int> SourceJointIndices;
+		TArray<uint8> Flags;
+
+		// Target indices of the wrists (or NONE)
+		int LeftWristIdx = INDEX_NONE;
+		int RightWristIdx = INDEX_NONE;
+
+		// Per target joint component space transforms and scales of the current frame, reused across frames
+		TArray<FTransform> FrameTransforms;
+		TArray<float> FrameScales;
 	};
 
 	struct TargetSkeletonJointEntry
@@ -207,13 +266,19 @@ private:
 
 	bool ProcessFrameRetargeting(const FOculusXRBodyState& BodyState,
 		const USkeletalMeshComponent* SkeletalMeshComponent,
-		FPoseContext& Output);
+		FCompactPose& OutPose);
+
+	// Called from within ProcessFrameRetargeting and the prepared frame path
+	void ComputeFrameTransforms(const FOculusXRBodyState& BodyState);
+	void ApplyFrameTransforms(const FOculusXRBodyState& BodyState,
+		const USkeletalMeshComponent* SkeletalMeshComponent,
+		FCompactPose& OutPose);
 
 	// Called from within ProcessFrameRetargeting
-	void ProcessFrameInterpolateTwistJoints(TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const;
-	void UpdateScaleForFrame(const int TargetIndex, TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const;
-	void UpdateScaleForFrameRecursive(const int TargetIndex, const float scale, TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses) const;
-	TTuple<float, float> GetFrameMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, const TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& FramePoses, float currentLength = 0.0f, float unmodifiedLength = 0.0f) const;
+	void ProcessFrameInterpolateTwistJoints(TArray<FTransform>& FrameTransforms) const;
+	void UpdateScaleForFrame(const int TargetIndex, const TArray<FTransform>& FrameTransforms, TArray<float>& FrameScales) const;
+	void UpdateScaleForFrameRecursive(const int TargetIndex, const float scale, TArray<float>& FrameScales) const;
+	TTuple<float, float> GetFrameMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, const TArray<FTransform>& FrameTransforms, float currentLength = 0.0f, float unmodifiedLength = 0.0f) const;
 
 	// End of Update Section
 
@@ -223,6 +288,7 @@ private:
 	void CacheTwistJoints();
 	void ApplyScaleAndProportion();
 	void InitializeScaleAndOffsetData();
+	void BuildFrameRetargetPlan();
 	TTuple<float, float> GetMaxCurrentAndUnModifiedJointLengths(int targetJointIndex, float currentLength = 0.0f, float unmodifiedLength = 0.0f) const;
 
 	// End of Setup/Calculation section
@@ -244,6 +310,14 @@ private:
 	SourceInfo SourceReferenceInfo;
 	TMap<FCompactPoseBoneIndex, EOculusXRBoneID> TargetToSourceMap;
 	TargetSkeletonPoseData TargetAdjustedRestPoseData;
+	FrameRetargetPlan RetargetPlan;
+
+	struct
+	{
+		FOculusXRBodyState BodyState;
+		uint16 BoneContainerSerialNumber = 0;
+		bool bIsValid = false;
+	} PreparedFrame;
 
 #if OCULUS_XR_TRACKING_ENABLE_DEBUG_DRAW
 	static const FString kRestPoseDebugDrawCategory;
@@ -0,0 +1,148 @@
+/*
+Copyright (c) Meta Platforms, Inc. and affiliates.
+All rights reserved.
+
+This source code is licensed under the license found in the
+LICENSE file in the root directory of this source tree.
+*/
+
+#include "OculusXRBodyRetargetingJobs.h"
+#include "OculusXRAnimNodeBodyRetargeter.h"
+#include "OculusXRMovement.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+FOculusXRBodyRetargetingJobs& FOculusXRBodyRetargetingJobs::Get()
+{
+	static FOculusXRBodyRetargetingJobs Instance;
+	return Instance;
+}
+
+void FOculusXRBodyRetargetingJobs::Startup()
+{
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddRaw(this, &FOculusXRBodyRetargetingJobs::OnWorldPreActorTick);
+}
+
+void FOculusXRBodyRetargetingJobs::Shutdown()
+{
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+	PreActorTickHandle.Reset();
+
+	TArray<TSharedPtr<FBatch>> Batches;
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingRequests.Empty();
+		for (const auto& Launched : LaunchedRetargeters)
+		{
+			Batches.AddUnique(Launched.Value.Get<0>());
+		}
+		LaunchedRetargeters.Empty();
+	}
+
+	for (const TSharedPtr<FBatch>& Batch : Batches)
+	{
+		Batch->Task.Wait();
+	}
+}
+
+void FOculusXRBodyRetargetingJobs::RequestNextFrame(const TSharedPtr<FOculusXRAnimNodeBodyRetargeter>& Retargeter, const float WorldScale)
+{
+	if (!Retargeter)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	for (FRequest& Request : PendingRequests)
+	{
+		if (Request.Retargeter == Retargeter)
+		{
+			Request.WorldScale = WorldScale;
+			return;
+		}
+	}
+	PendingRequests.Add({ Retargeter, WorldScale });
+}
+
+bool FOculusXRBodyRetargetingJobs::WaitForPreparedFrame(const FOculusXRAnimNodeBodyRetargeter* Retargeter)
+{
+	TTuple<TSharedPtr<FBatch>, int> Launched;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!LaunchedRetargeters.RemoveAndCopyValue(Retargeter, Launched))
+		{
+			return false;
+		}
+	}
+
+	const TSharedPtr<FBatch>& Batch = Launched.Get<0>();
+	Batch->Task.Wait();
+	return Batch->FrameCounter == GFrameCounter && Batch->Requests[Launched.Get<1>()].bPrepared;
+}
+
+void FOculusXRBodyRetargetingJobs::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	TSharedPtr<FBatch> Batch = MakeShared<FBatch>();
+	{
+		FScopeLock ScopeLock(&Lock);
+		// Drop batch entries of earlier frames that were never consumed, their node skipped evaluation or got destroyed.
+		// The batch may still touch the retargeter, so wait for it (it's long finished in practice).
+		for (auto It = LaunchedRetargeters.CreateIterator(); It; ++It)
+		{
+			const TSharedPtr<FBatch>& LaunchedBatch = It.Value().Get<0>();
+			if (LaunchedBatch->FrameCounter != GFrameCounter)
+			{
+				LaunchedBatch->Task.Wait();
+				It.RemoveCurrent();
+			}
+		}
+
+		if (PendingRequests.IsEmpty())
+		{
+			return;
+		}
+		Batch->FrameCounter = GFrameCounter;
+		Batch->Requests = MoveTemp(PendingRequests);
+		PendingRequests.Reset();
+
+		for (int i = 0; i < Batch->Requests.Num(); ++i)
+		{
+			const FOculusXRAnimNodeBodyRetargeter* Retargeter = Batch->Requests[i].Retargeter.Get();
+			// Leave out retargeters that are only kept alive by the request, or that are already part of a batch of this frame (other world)
+			if (Batch->Requests[i].Retargeter.GetSharedReferenceCount() == 1 || LaunchedRetargeters.Contains(Retargeter))
+			{
+				Batch->Requests[i].Retargeter.Reset();
+				continue;
+			}
+			LaunchedRetargeters.Add(Retargeter, MakeTuple(Batch, i));
+		}
+	}
+
+	// All avatars share the tracked body, only read it once per world scale
+	TArray<TTuple<float, FOculusXRBodyState>, TInlineAllocator<1>> BodyStates;
+	TArray<int> BodyStateIndices;
+	BodyStateIndices.Init(INDEX_NONE, Batch->Requests.Num());
+	for (int i = 0; i < Batch->Requests.Num(); ++i)
+	{
+		const float WorldScale = Batch->Requests[i].WorldScale;
+		BodyStateIndices[i] = BodyStates.IndexOfByPredicate([WorldScale](const TTuple<float, FOculusXRBodyState>& Entry) { return Entry.Get<0>() == WorldScale; });
+		if (BodyStateIndices[i] == INDEX_NONE)
+		{
+			BodyStateIndices[i] = BodyStates.AddDefaulted();
+			BodyStates[BodyStateIndices[i]].Get<0>() = WorldScale;
+			OculusXRMovement::GetBodyState(BodyStates[BodyStateIndices[i]].Get<1>(), WorldScale);
+		}
+	}
+
+	FBatch* BatchPtr = Batch.Get();
+	Batch->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [BatchPtr, BodyStates = MoveTemp(BodyStates), BodyStateIndices = MoveTemp(BodyStateIndices)]() {
+		TRACE_CPUPROFILER_EVENT_SCOPE(OculusXRBodyRetargetingBatch);
+		ParallelFor(BatchPtr->Requests.Num(), [BatchPtr, &BodyStates, &BodyStateIndices](int32 Index) {
+			FRequest& Request = BatchPtr->Requests[Index];
+			if (Request.Retargeter)
+			{
+				Request.bPrepared = Request.Retargeter->PrepareFrame(BodyStates[BodyStateIndices[Index]].Get<1>());
+			}
+		});
+	});
+}
@@ -0,0 +1,78 @@
+/*
+Copyright (c) Meta Platforms, Inc. and affiliates.
+All rights reserved.
+
+This source code is licensed under the license found in the
+LICENSE file in the root directory of this source tree.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Tasks/Task.h"
+
+class FOculusXRAnimNodeBodyRetargeter;
+
+/**
+ * Shared retargeting job system for all body tracking anim nodes.
+ *
+ * Every node that retargeted a frame requests to be part of the next batch. At the start of the next world
+ * tick, before any skeletal mesh evaluates, the body state is read once and the frame transforms of all
+ * requested retargeters are computed as a single parallel batch on the task workers. During
+ * Evaluate_AnyThread each node waits for the batch (usually long finished) and only writes the prepared
+ * transforms into its pose. Nodes that aren't part of a batch (first frame, skeleton changes) retarget inline.
+ * A batch is only consumed in the frame it was launched in. Nodes that skipped evaluation that frame (off
+ * screen, update rate optimizations) retarget inline the next time they evaluate instead of applying an old body state.
+ */
+class FOculusXRBodyRetargetingJobs
+{
+public:
+	static FOculusXRBodyRetargetingJobs& Get();
+
+	void Startup();
+	void Shutdown();
+
+	/**
+	 * Adds the retargeter to the next batch. Can be called from any thread.
+	 *
+	 * @param Retargeter The retargeter to prepare the next frame for.
+	 * @param WorldScale The world scale the body state is read with.
+	 */
+	void RequestNextFrame(const TSharedPtr<FOculusXRAnimNodeBodyRetargeter>& Retargeter, const float WorldScale);
+
+	/**
+	 * Waits until the batch the retargeter is part of finished. Has to be called before accessing a
+	 * retargeter that requested a frame. Can be called from any thread.
+	 *
+	 * @param Retargeter The retargeter to wait for.
+	 * @return bool True if a frame was prepared for the retargeter in the current frame.
+	 */
+	bool WaitForPreparedFrame(const FOculusXRAnimNodeBodyRetargeter* Retargeter);
+
+private:
+	struct FRequest
+	{
+		TSharedPtr<FOculusXRAnimNodeBodyRetargeter> Retargeter;
+		float WorldScale = 100.f;
+		bool bPrepared = false;
+	};
+
+	struct FBatch
+	{
+		TArray<FRequest> Requests;
+		UE::Tasks::FTask Task;
+		// GFrameCounter of the frame the batch was launched in
+		uint64 FrameCounter = 0;
+	};
+
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	FDelegateHandle PreActorTickHandle;
+
+	FCriticalSection Lock;
+	// Requests for the next batch
+	TArray<FRequest> PendingRequests;
+	// Batch each launched retargeter belongs to, removed once the retargeter waited for it or at the start of the next frame
+	TMap<const FOculusXRAnimNodeBodyRetargeter*, TTuple<TSharedPtr<FBatch>, int>> LaunchedRetargeters;
+};
@@ -40,16 +40,17 @@ FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodySkeleton(
 	return FOculusXRRetargetSkeletonEOculusXRBoneID(jointData);
 }
 
-FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodyState(
+void Factory::FillFromOculusXRBodyState(
 	const FOculusXRBodyState& SourceFrameSkeleton,
 	const FOculusXRBodySkeleton& SourceReferenceSkeleton,
 	const FTransform& TrackingSpaceToComponentSpace,
-	const EOculusXRBodyRetargetingRootMotionBehavior rootMotionBehavior)
+	const EOculusXRBodyRetargetingRootMotionBehavior rootMotionBehavior,
+	TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>>& jointData)
 {
-	TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>> jointData;
-	TMap<EOculusXRBoneID, int> BoneIdToIndexMap;
-	jointData.Reserve(SourceReferenceSkeleton.NumBones);
-	BoneIdToIndexMap.Reserve(SourceReferenceSkeleton.NumBones);
+	// Keep the allocation of the previous frame
+	jointData.Reset(SourceReferenceSkeleton.NumBones);
+	int HipJointIdx = INDEX_NONE;
+	int rootJointIdx = INDEX_NONE;
 
 	// Use this if we're Combining the Hip Translation/Rotation to
 	// Root - if the Tracking expands, the capsule will float if we use
@@ -76,10 +77,13 @@ FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodyState(
 			minRestZPosition = FMath::Min(minRestZPosition, BoneData.Position.Z);
 		}
 
-		if (TrackingBoneId != EOculusXRBoneID::None)
+		if (TrackingBoneId == EOculusXRBoneID::BodyHips)
 		{
-			check(!BoneIdToIndexMap.Contains(TrackingBoneId));
-			BoneIdToIndexMap.Add(TrackingBoneId, i);
+			HipJointIdx = i;
+		}
+		else if (TrackingBoneId == EOculusXRBoneID::BodyRoot)
+		{
+			rootJointIdx = i;
 		}
 	}
 
@@ -90,11 +94,8 @@ FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodyState(
 	// (So when the character jumps, the root translates up)
 	// We'll also extract the Yaw from the hip and shift it to the root.
 	// This allows for better compatibility with Locomotion systems
-	if (FOculusXRBodyRetargeter::IsModifiedRootBehavior(rootMotionBehavior) && BoneIdToIndexMap.Contains(EOculusXRBoneID::BodyHips) && BoneIdToIndexMap.Contains(EOculusXRBoneID::BodyRoot))
+	if (FOculusXRBodyRetargeter::IsModifiedRootBehavior(rootMotionBehavior) && HipJointIdx != INDEX_NONE && rootJointIdx != INDEX_NONE)
 	{
-		const int HipJointIdx = BoneIdToIndexMap[EOculusXRBoneID::BodyHips];
-		const int rootJointIdx = BoneIdToIndexMap[EOculusXRBoneID::BodyRoot];
-
 		const auto& HipRest = SourceReferenceSkeleton.Bones[HipJointIdx];
 		const auto& HipFrame = SourceFrameSkeleton.Joints[HipJointIdx];
 		const auto& RootRest = SourceReferenceSkeleton.Bones[rootJointIdx];
@@ -144,6 +145,16 @@ FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodyState(
 		// Recalculate our skeleton from local space since we changed the root and hips
 		TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>::CalculateLocalToComponentSpace(jointData);
 	}
+}
+
+FOculusXRRetargetSkeletonEOculusXRBoneID Factory::FromOculusXRBodyState(
+	const FOculusXRBodyState& SourceFrameSkeleton,
+	const FOculusXRBodySkeleton& SourceReferenceSkeleton,
+	const FTransform& TrackingSpaceToComponentSpace,
+	const EOculusXRBodyRetargetingRootMotionBehavior rootMotionBehavior)
+{
+	TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>> jointData;
+	FillFromOculusXRBodyState(SourceFrameSkeleton, SourceReferenceSkeleton, TrackingSpaceToComponentSpace, rootMotionBehavior, jointData);
 
 	return FOculusXRRetargetSkeletonEOculusXRBoneID(jointData);
 }
@@ -191,18 +202,20 @@ FOculusXRRetargetSkeletonFCompactPoseBoneIndex Factory::FromBoneContainer(
 
 FOculusXRRetargetSkeletonFCompactPoseBoneIndex Factory::FromComponentSpaceTransformArray(
 	const FAbstractRetargetSkeleton& BaseSkeleton,
-	const TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& ComponentSpaceTransformPairs)
+	const TArray<FCompactPoseBoneIndex>& BoneIds,
+	const TArray<FTransform>& ComponentSpaceTransforms)
 {
-	check(BaseSkeleton.GetNumBones() == ComponentSpaceTransformPairs.Num());
+	check(BaseSkeleton.GetNumBones() == ComponentSpaceTransforms.Num());
+	check(BoneIds.Num() == ComponentSpaceTransforms.Num());
 	TArray<TOculusXRRetargetSkeletonJoint<FCompactPoseBoneIndex>> jointData;
-	jointData.Reserve(ComponentSpaceTransformPairs.Num());
+	jointData.Reserve(ComponentSpaceTransforms.Num());
 
-	for (int i = 0; i < ComponentSpaceTransformPairs.Num(); ++i)
+	for (int i = 0; i < ComponentSpaceTransforms.Num(); ++i)
 	{
-		jointData.Add({ ComponentSpaceTransformPairs[i].Get<FCompactPoseBoneIndex>(),
+		jointData.Add({ BoneIds[i],
 			BaseSkeleton.GetParentBoneIndex(i),
 			FTransform::Identity,
-			ComponentSpaceTransformPairs[i].Get<FTransform>() });
+			ComponentSpaceTransforms[i] });
 	}
 
 	// Calculate the local transforms from the component transforms
@@ -7,6 +7,7 @@ LICENSE file in the root directory of this source tree.
 */
 
 #include "OculusXRRetargeting.h"
+#include "OculusXRBodyRetargetingJobs.h"
 
 #define LOCTEXT_NAMESPACE "FOculusXRRetargetingModule"
 
@@ -14,10 +15,12 @@ DEFINE_LOG_CATEGORY(LogOculusXRRetargeting);
 
 void FOculusXRRetargetingModule::StartupModule()
 {
+	FOculusXRBodyRetargetingJobs::Get().Startup();
 }
 
 void FOculusXRRetargetingModule::ShutdownModule()
 {
+	FOculusXRBodyRetargetingJobs::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
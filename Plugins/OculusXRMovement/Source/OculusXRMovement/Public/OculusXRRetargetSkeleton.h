@@ -346,12 +346,32 @@ namespace Factory
 	 * @param rootMotionBehavior The root motion behavior to be applied when caching the pose.
 	 * @return FOculusXRRetargetSkeletonEOculusXRBoneID A TOculusXRRetargetSkeleton object.
 	 */
-	FOculusXRRetargetSkeletonEOculusXRBoneID FromOculusXRBodyState(
+	OCULUSXRRETARGETING_API FOculusXRRetargetSkeletonEOculusXRBoneID FromOculusXRBodyState(
 		const FOculusXRBodyState& SourceFrameSkeleton,
 		const FOculusXRBodySkeleton& SourceReferenceSkeleton,
 		const FTransform& TrackingSpaceToComponentSpace,
 		const EOculusXRBodyRetargetingRootMotionBehavior rootMotionBehavior);
 
+	/**
+	 * @brief Fill an array of joints from Oculus XR body state. Produces the same joint data as FromOculusXRBodyState,
+	 * but reuses the memory of the given array and doesn't build a bone ID lookup, so it can be called every frame.
+	 *
+	 * The joints are stored at the same index as in the reference skeleton. Joints that aren't tracked in this
+	 * frame have the bone ID EOculusXRBoneID::None.
+	 *
+	 * @param SourceFrameSkeleton The current frame of the source skeleton.
+	 * @param SourceReferenceSkeleton The reference skeleton of the source skeleton.
+	 * @param TrackingSpaceToComponentSpace The transform from tracking space to component space.
+	 * @param rootMotionBehavior The root motion behavior to be applied when caching the pose.
+	 * @param jointData The array that receives the joint data. Previous content is discarded.
+	 */
+	OCULUSXRRETARGETING_API void FillFromOculusXRBodyState(
+		const FOculusXRBodyState& SourceFrameSkeleton,
+		const FOculusXRBodySkeleton& SourceReferenceSkeleton,
+		const FTransform& TrackingSpaceToComponentSpace,
+		const EOculusXRBodyRetargetingRootMotionBehavior rootMotionBehavior,
+		TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>>& jointData);
+
 	/**
 	 * @brief Create a TOculusXRRetargetSkeleton object from a reference skeleton.
 	 *
@@ -362,14 +382,16 @@ namespace Factory
 		const FBoneContainer& TargetBoneContainer);
 
 	/**
-	 * @brief Create a TOculusXRRetargetSkeleton object from an Array of BoneId/ComponentSpace Transform pairs and origin Skeleton.
+	 * @brief Create a TOculusXRRetargetSkeleton object from parallel Arrays of BoneIds/ComponentSpace Transforms and origin Skeleton.
 	 *
 	 * @param BaseSkeleton The skeleton the component transform Array is relative to
+	 * @param BoneIds An Array of Bone IDs matching the BaseSkeleton
 	 * @param ComponentSpaceTransforms An Array of Compoenent Space Transform Data matching the BaseSkeleton
 	 * @return FOculusXRRetargetSkeletonFCompactPoseBoneIndex A FOculusXRRetargetSkeletonFCompactPoseBoneIndex object.
 	 */
 	FOculusXRRetargetSkeletonFCompactPoseBoneIndex FromComponentSpaceTransformArray(
 		const FAbstractRetargetSkeleton& BaseSkeleton,
-		const TArray<TTuple<FCompactPoseBoneIndex, FTransform, float>>& ComponentSpaceTransformPairs);
+		const TArray<FCompactPoseBoneIndex>& BoneIds,
+		const TArray<FTransform>& ComponentSpaceTransforms);
 
 } // namespace Factory
@@ -1,4 +1,5 @@
-﻿using UnrealBuildTool;
+﻿using System.IO;
+using UnrealBuildTool;
 
 public class OculusXRRetargetingTests : ModuleRules
 {
@@ -10,9 +11,14 @@ public class OculusXRRetargetingTests : ModuleRules
             new[]
             {
                 "Core",
+                "CoreUObject",
+                "Engine",
                 "OculusXRRetargeting",
                 "OculusXRMovement"
             }
         );
+
+        // Retargeter internals driven by the retargeting tests
+        PrivateIncludePaths.Add(Path.Combine(ModuleDirectory, "../OculusXRMovement/Private"));
     }
 }
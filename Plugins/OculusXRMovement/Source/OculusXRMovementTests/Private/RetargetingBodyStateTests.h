@@ -0,0 +1,114 @@
+/*
+Copyright (c) Meta Platforms, Inc. and affiliates.
+All rights reserved.
+
+This source code is licensed under the license found in the
+LICENSE file in the root directory of this source tree.
+*/
+
+#pragma once
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "OculusXRMovementTypes.h"
+#include "OculusXRRetargetSkeleton.h"
+
+// These tests check that the per frame conversion of the body state into a reusable joint array matches the
+// skeleton created by the factory, and measure both for several avatars.
+
+// Creates a skeleton where every bone is the child of the previous one, with the root at index 0 and the hips at index 1
+inline void CreateBodySkeletonAndState(const int NumBones, FOculusXRBodySkeleton& OutSkeleton, FOculusXRBodyState& OutState)
+{
+	OutSkeleton.NumBones = NumBones;
+	OutSkeleton.Bones.SetNum(NumBones);
+	OutState.IsActive = true;
+	OutState.Joints.SetNum(NumBones);
+
+	for (int i = 0; i < NumBones; ++i)
+	{
+		FOculusXRBodySkeletonBone& Bone = OutSkeleton.Bones[i];
+		Bone.BoneId = static_cast<EOculusXRBoneID>(i);
+		Bone.ParentBoneIndex = i == 0 ? EOculusXRBoneID::None : static_cast<EOculusXRBoneID>(i - 1);
+		Bone.Orientation = FRotator::ZeroRotator;
+		Bone.Position = FVector(0.0f, 0.0f, 10.0f * i);
+
+		FOculusXRBodyJoint& Joint = OutState.Joints[i];
+		Joint.bIsValid = true;
+		Joint.Orientation = FRotator(5.0f * i, 3.0f * i, 0.0f);
+		Joint.Position = FVector(1.0f * i, 0.0f, 20.0f + 11.0f * i);
+	}
+
+	// One untracked joint to cover joints without Bone ID in the frame
+	OutState.Joints[NumBones - 1].bIsValid = false;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFillFromBodyStateMatchesFactory, "OculusXRRetargetingTests.FFillFromBodyStateMatchesFactory", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+inline bool FFillFromBodyStateMatchesFactory::RunTest(const FString& Parameters)
+{
+	FOculusXRBodySkeleton Skeleton;
+	FOculusXRBodyState State;
+	CreateBodySkeletonAndState(static_cast<int>(EOculusXRBoneID::COUNT), Skeleton, State);
+	const FTransform TrackingSpaceToComponentSpace(FRotator(0.0f, 90.0f, 0.0f));
+
+	TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>> JointData;
+	for (const auto RootMotionBehavior : { EOculusXRBodyRetargetingRootMotionBehavior::CombineToRoot, EOculusXRBodyRetargetingRootMotionBehavior::ZeroOutRootTranslationHipYaw })
+	{
+		const FOculusXRRetargetSkeletonEOculusXRBoneID Expected = Factory::FromOculusXRBodyState(State, Skeleton, TrackingSpaceToComponentSpace, RootMotionBehavior);
+		Factory::FillFromOculusXRBodyState(State, Skeleton, TrackingSpaceToComponentSpace, RootMotionBehavior, JointData);
+
+		TestEqual("Joint count should match", JointData.Num(), Expected.GetNumBones());
+		for (int i = 0; i < FMath::Min(JointData.Num(), Expected.GetNumBones()); ++i)
+		{
+			TestEqual("Bone ID should match", static_cast<uint8>(JointData[i].BoneId), static_cast<uint8>(Expected.GetBoneId(i)));
+			TestEqual("Parent index should match", JointData[i].ParentIdx, Expected.GetParentBoneIndex(i));
+			TestTrue("Component transform should match", JointData[i].ComponentTransform.Equals(Expected.GetComponentTransform(i)));
+			TestTrue("Local transform should match", JointData[i].LocalTransform.Equals(Expected.GetLocalTransform(i)));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFillFromBodyStateBenchmark, "OculusXRRetargetingTests.FFillFromBodyStateBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+inline bool FFillFromBodyStateBenchmark::RunTest(const FString& Parameters)
+{
+	// Mirrors and NPC guides, each retargeted every frame
+	constexpr int NumAvatars = 16;
+	constexpr int NumFrames = 500;
+	const auto RootMotionBehavior = EOculusXRBodyRetargetingRootMotionBehavior::CombineToRoot;
+
+	FOculusXRBodySkeleton Skeleton;
+	FOculusXRBodyState State;
+	CreateBodySkeletonAndState(static_cast<int>(EOculusXRBoneID::COUNT), Skeleton, State);
+	const FTransform TrackingSpaceToComponentSpace = FTransform::Identity;
+
+	int NumJoints = 0;
+	const double FactoryStart = FPlatformTime::Seconds();
+	for (int Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int Avatar = 0; Avatar < NumAvatars; ++Avatar)
+		{
+			NumJoints += Factory::FromOculusXRBodyState(State, Skeleton, TrackingSpaceToComponentSpace, RootMotionBehavior).GetNumBones();
+		}
+	}
+	const double FactorySeconds = FPlatformTime::Seconds() - FactoryStart;
+
+	TArray<TArray<TOculusXRRetargetSkeletonJoint<EOculusXRBoneID>>> AvatarJointData;
+	AvatarJointData.SetNum(NumAvatars);
+	const double FillStart = FPlatformTime::Seconds();
+	for (int Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int Avatar = 0; Avatar < NumAvatars; ++Avatar)
+		{
+			Factory::FillFromOculusXRBodyState(State, Skeleton, TrackingSpaceToComponentSpace, RootMotionBehavior, AvatarJointData[Avatar]);
+			NumJoints -= AvatarJointData[Avatar].Num();
+		}
+	}
+	const double FillSeconds = FPlatformTime::Seconds() - FillStart;
+
+	TestEqual("Both paths should produce the same number of joints", NumJoints, 0);
+	AddInfo(FString::Printf(TEXT("%d avatars, %d frames: FromOculusXRBodyState %.3f ms/frame, FillFromOculusXRBodyState %.3f ms/frame"),
+		NumAvatars, NumFrames, FactorySeconds * 1000.0 / NumFrames, FillSeconds * 1000.0 / NumFrames));
+
+	return true;
+}
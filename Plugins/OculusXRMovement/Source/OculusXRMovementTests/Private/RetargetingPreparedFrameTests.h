@@ -0,0 +1,207 @@
+/*
+Copyright (c) Meta Platforms, Inc. and affiliates.
+All rights reserved.
+
+This source code is licensed under the license found in the
+LICENSE file in the root directory of this source tree.
+*/
+
+#pragma once
+
+#include "Animation/Skeleton.h"
+#include "Async/ParallelFor.h"
+#include "BoneContainer.h"
+#include "BonePose.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "OculusXRAnimNodeBodyRetargeter.h"
+#include "OculusXRMovementTypes.h"
+#include "ReferenceSkeleton.h"
+#include "UObject/Package.h"
+
+// These tests check that a frame prepared for the retargeting batch produces the same pose as retargeting the
+// frame inline, and measure both paths for a crowd of avatars.
+
+// Retargets against a made up body skeleton instead of the one of the tracked body
+class FPreparedFrameTestRetargeter : public FOculusXRAnimNodeBodyRetargeter
+{
+public:
+	FOculusXRBodySkeleton BodySkeleton;
+
+protected:
+	virtual bool GetBodySkeleton(FOculusXRBodySkeleton& OutSkeleton, const float WorldScale) const override
+	{
+		OutSkeleton = BodySkeleton;
+		return true;
+	}
+};
+
+// Target skeleton, bone container and mapping that every bone of the body maps to one target bone of the same hierarchy
+struct FPreparedFrameTestAvatar
+{
+	static constexpr int NumBones = static_cast<int>(EOculusXRBoneID::COUNT);
+
+	FPreparedFrameTestAvatar()
+	{
+		Skeleton = NewObject<USkeleton>(GetTransientPackage());
+		{
+			FReferenceSkeletonModifier Modifier(Skeleton);
+			for (int i = 0; i < NumBones; ++i)
+			{
+				const FName BoneName(TEXT("Bone"), i + 1);
+				Modifier.Add(FMeshBoneInfo(BoneName, BoneName.ToString(), i - 1), FTransform(FVector(0.0f, 0.0f, i == 0 ? 0.0f : 10.0f)));
+				BoneMapping.Add(static_cast<EOculusXRBoneID>(i), BoneName);
+			}
+		}
+
+		TArray<FBoneIndexType> RequiredBones;
+		for (int i = 0; i < NumBones; ++i)
+		{
+			RequiredBones.Add(i);
+		}
+		BoneContainer.InitializeTo(RequiredBones, UE::Anim::FCurveFilterSettings(), *Skeleton);
+
+		Component = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+	}
+
+	TSharedRef<FPreparedFrameTestRetargeter> CreateRetargeter(const EOculusXRBodyRetargetingMode RetargetingMode) const
+	{
+		TSharedRef<FPreparedFrameTestRetargeter> Retargeter = MakeShared<FPreparedFrameTestRetargeter>();
+		Retargeter->BodySkeleton.NumBones = NumBones;
+		Retargeter->BodySkeleton.Bones.SetNum(NumBones);
+		for (int i = 0; i < NumBones; ++i)
+		{
+			FOculusXRBodySkeletonBone& Bone = Retargeter->BodySkeleton.Bones[i];
+			Bone.BoneId = static_cast<EOculusXRBoneID>(i);
+			Bone.ParentBoneIndex = i == 0 ? EOculusXRBoneID::None : static_cast<EOculusXRBoneID>(i - 1);
+			Bone.Orientation = FRotator::ZeroRotator;
+			Bone.Position = FVector(0.0f, 0.0f, 12.0f * i);
+		}
+		Retargeter->Initialize(RetargetingMode, EOculusXRBodyRetargetingRootMotionBehavior::CombineToRoot, EOculusXRAxis::Y, &BoneMapping);
+		return Retargeter;
+	}
+
+	// Tracked body that moves a little every frame
+	static FOculusXRBodyState CreateBodyState(const int Frame)
+	{
+		FOculusXRBodyState State;
+		State.IsActive = true;
+		State.Joints.SetNum(NumBones);
+		for (int i = 0; i < NumBones; ++i)
+		{
+			FOculusXRBodyJoint& Joint = State.Joints[i];
+			Joint.bIsValid = true;
+			Joint.Orientation = FRotator(2.0f * i + Frame, 3.0f * Frame, 0.5f * i);
+			Joint.Position = FVector(0.5f * i + Frame, 0.0f, 13.0f * i);
+		}
+		return State;
+	}
+
+	FCompactPose CreatePose() const
+	{
+		FCompactPose Pose;
+		Pose.SetBoneContainer(&BoneContainer);
+		Pose.ResetToRefPose();
+		return Pose;
+	}
+
+	USkeleton* Skeleton = nullptr;
+	USkeletalMeshComponent* Component = nullptr;
+	FBoneContainer BoneContainer;
+	TMap<EOculusXRBoneID, FName> BoneMapping;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPreparedFrameMatchesInlineRetargeting, "OculusXRRetargetingTests.FPreparedFrameMatchesInlineRetargeting", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::SmokeFilter)
+inline bool FPreparedFrameMatchesInlineRetargeting::RunTest(const FString& Parameters)
+{
+	const FPreparedFrameTestAvatar Avatar;
+	const float WorldScale = 100.0f;
+
+	for (const auto RetargetingMode : { EOculusXRBodyRetargetingMode::RotationAndPositions, EOculusXRBodyRetargetingMode::RotationOnlyUniformScale })
+	{
+		const TSharedRef<FPreparedFrameTestRetargeter> Inline = Avatar.CreateRetargeter(RetargetingMode);
+		const TSharedRef<FPreparedFrameTestRetargeter> Prepared = Avatar.CreateRetargeter(RetargetingMode);
+
+		// The first frame always retargets inline, it builds the retarget plan
+		FCompactPose InlinePose = Avatar.CreatePose();
+		FCompactPose PreparedPose = Avatar.CreatePose();
+		TestTrue("First frame should retarget inline", Inline->RetargetFromBodyState(FPreparedFrameTestAvatar::CreateBodyState(0), Avatar.Component, WorldScale, InlinePose));
+		TestTrue("First frame should retarget inline", Prepared->RetargetFromBodyState(FPreparedFrameTestAvatar::CreateBodyState(0), Avatar.Component, WorldScale, PreparedPose));
+
+		for (int Frame = 1; Frame < 4; ++Frame)
+		{
+			const FOculusXRBodyState BodyState = FPreparedFrameTestAvatar::CreateBodyState(Frame);
+			InlinePose.ResetToRefPose();
+			PreparedPose.ResetToRefPose();
+
+			TestTrue("Inline frame should retarget", Inline->RetargetFromBodyState(BodyState, Avatar.Component, WorldScale, InlinePose));
+			TestTrue("Frame should be prepared", Prepared->PrepareFrame(BodyState));
+			TestTrue("Prepared frame should retarget", Prepared->RetargetPreparedFrame(Avatar.Component, WorldScale, PreparedPose));
+
+			for (const FCompactPoseBoneIndex BoneIndex : InlinePose.ForEachBoneIndex())
+			{
+				TestTrue("Prepared bone transform should match inline", PreparedPose[BoneIndex].Equals(InlinePose[BoneIndex]));
+			}
+
+			// A prepared frame is only applied once
+			TestFalse("Prepared frame should be consumed", Prepared->RetargetPreparedFrame(Avatar.Component, WorldScale, PreparedPose));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMultiAvatarRetargetingBenchmark, "OculusXRRetargetingTests.FMultiAvatarRetargetingBenchmark", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+inline bool FMultiAvatarRetargetingBenchmark::RunTest(const FString& Parameters)
+{
+	// A crowd of recorded or mirrored avatars, each retargeted every frame
+	constexpr int NumAvatars = 32;
+	constexpr int NumFrames = 100;
+	const float WorldScale = 100.0f;
+
+	const FPreparedFrameTestAvatar Avatar;
+	TArray<TSharedRef<FPreparedFrameTestRetargeter>> Retargeters;
+	TArray<FCompactPose> Poses;
+	for (int i = 0; i < NumAvatars; ++i)
+	{
+		Retargeters.Add(Avatar.CreateRetargeter(EOculusXRBodyRetargetingMode::RotationAndPositions));
+		Poses.Add(Avatar.CreatePose());
+		Retargeters[i]->RetargetFromBodyState(FPreparedFrameTestAvatar::CreateBodyState(0), Avatar.Component, WorldScale, Poses[i]);
+	}
+
+	int NumRetargeted = 0;
+	const double InlineStart = FPlatformTime::Seconds();
+	for (int Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		const FOculusXRBodyState BodyState = FPreparedFrameTestAvatar::CreateBodyState(Frame);
+		for (int i = 0; i < NumAvatars; ++i)
+		{
+			Poses[i].ResetToRefPose();
+			NumRetargeted += Retargeters[i]->RetargetFromBodyState(BodyState, Avatar.Component, WorldScale, Poses[i]) ? 1 : 0;
+		}
+	}
+	const double InlineSeconds = FPlatformTime::Seconds() - InlineStart;
+
+	// What FOculusXRBodyRetargetingJobs does: prepare all avatars in parallel, then each evaluation applies its frame
+	const double BatchStart = FPlatformTime::Seconds();
+	for (int Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		const FOculusXRBodyState BodyState = FPreparedFrameTestAvatar::CreateBodyState(Frame);
+		ParallelFor(NumAvatars, [&Retargeters, &BodyState](int32 Index) {
+			Retargeters[Index]->PrepareFrame(BodyState);
+		});
+		for (int i = 0; i < NumAvatars; ++i)
+		{
+			Poses[i].ResetToRefPose();
+			NumRetargeted -= Retargeters[i]->RetargetPreparedFrame(Avatar.Component, WorldScale, Poses[i]) ? 1 : 0;
+		}
+	}
+	const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+	TestEqual("Both paths should retarget every avatar", NumRetargeted, 0);
+	AddInfo(FString::Printf(TEXT("%d avatars, %d frames, %d worker threads: inline %.3f ms/frame, batch %.3f ms/frame"),
+		NumAvatars, NumFrames, FTaskGraphInterface::Get().GetNumWorkerThreads(), InlineSeconds * 1000.0 / NumFrames, BatchSeconds * 1000.0 / NumFrames));
+
+	return true;
+}